@@ -103,6 +103,44 @@ typedef Texture Texture2D;
 // TextureCubemap, same as Texture
 typedef Texture TextureCubemap;
 
+// TextureStream, pixel buffers ring for asynchronous texture updates
+typedef struct {
+    Texture2D texture;      // Texture updated by the stream (not owned)
+    int bufferCount;        // Number of pixel buffers in the ring
+    int current;            // Pixel buffer index of last update (-1 if none)
+    unsigned int *pboIds;   // OpenGL Pixel Buffer Objects ids
+    void **fences;          // GPU sync objects, last transfer of every pixel buffer
+    void *mapped;           // Pixel buffer data currently mapped (NULL if none)
+} TextureStream;
+
+// ImageReadback, pixel buffers ring for asynchronous screen/texture readback
+typedef struct {
+    int width;              // Readback image width
+    int height;             // Readback image height
+    int format;             // Readback image format (PixelFormat type)
+    int bufferCount;        // Number of pixel buffers in the ring
+    int first;              // Pixel buffer index of oldest pending request
+    int pending;            // Number of pending requests
+    unsigned int *pboIds;   // OpenGL Pixel Buffer Objects ids
+    void **fences;          // GPU sync objects, one per pending request
+    bool *flipped;          // Request data flipped vertically (screen readback)
+} ImageReadback;
+
+// FrameTimeStats, frame times statistics over last frames (times in seconds)
+typedef struct {
+    int frameCount;         // Number of frames sampled (last frames kept, up to 256)
+    int hitchCount;         // Number of frames over hitch threshold since last reset
+    float mean;             // Frame time average
+    float p50;              // Frame time median
+    float p95;              // Frame time 95th percentile
+    float p99;              // Frame time 99th percentile
+    float max;              // Frame time maximum
+    float update;           // Update time average (from previous frame end to BeginDrawing())
+    float draw;             // Draw time average (from BeginDrawing() to buffers swap)
+    float swap;             // Buffers swap time average
+    float wait;             // Wait time average (target FPS)
+} FrameTimeStats;
+
 // GlyphInfo, font characters glyphs info
 typedef struct {
     int value;              // Character value (Unicode)
@@ -171,6 +209,13 @@ typedef struct {
     float params[4];        // Material generic parameters (if required)
 } Material;
 
+// InstanceBuffer, per-instance data for instanced drawing, stored in VRAM (GPU)
+typedef struct {
+    unsigned int vboId;     // OpenGL Vertex Buffer Object id (transforms, colors and custom data blocks)
+    int capacity;           // Maximum number of instances
+    int flags;              // Instance data stored along transforms (InstanceDataFlags)
+} InstanceBuffer;
+
 // Model, meshes, materials and animation data
 typedef struct {
     Matrix transform;       // Local transform matrix
@@ -198,7 +243,8 @@ typedef enum {
     FLAG_WINDOW_TRANSPARENT = 0x00000010,   // Set to allow transparent framebuffer
     FLAG_WINDOW_HIGHDPI     = 0x00002000,   // Set to support HighDPI
     FLAG_MSAA_4X_HINT       = 0x00000020,   // Set to try enabling MSAA 4X
-    FLAG_INTERLACED_HINT    = 0x00010000    // Set to try enabling interlaced video format (for V3D)
+    FLAG_INTERLACED_HINT    = 0x00010000,   // Set to try enabling interlaced video format (for V3D)
+    FLAG_WINDOW_HEADLESS    = 0x00020000    // Set to render offscreen without window (EGL context, fbo as screen), requires SUPPORT_HEADLESS_EGL
 } ConfigFlags;
 
 // Keyboard keys (US keyboard layout)
@@ -387,7 +433,10 @@ typedef enum {
     SHADER_LOC_MAP_CUBEMAP,         // Shader location: samplerCube texture: cubemap
     SHADER_LOC_MAP_IRRADIANCE,      // Shader location: samplerCube texture: irradiance
     SHADER_LOC_MAP_PREFILTER,       // Shader location: samplerCube texture: prefilter
-    SHADER_LOC_MAP_BRDF             // Shader location: sampler2d texture: brdf
+    SHADER_LOC_MAP_BRDF,            // Shader location: sampler2d texture: brdf
+    SHADER_LOC_BLOCK_CAMERA,        // Shader location: uniform block: camera matrices (view, projection)
+    SHADER_LOC_INSTANCE_COLOR,      // Shader location: vertex attribute: instance color
+    SHADER_LOC_INSTANCE_CUSTOM      // Shader location: vertex attribute: instance custom data (vec4)
 } ShaderLocationIndex;
 
 #define SHADER_LOC_MAP_DIFFUSE      SHADER_LOC_MAP_ALBEDO
@@ -414,6 +463,12 @@ typedef enum {
     SHADER_ATTRIB_VEC4              // Shader attribute type: vec4 (4 float)
 } ShaderAttributeDataType;
 
+// Instance buffer data flags (transforms are always stored)
+typedef enum {
+    INSTANCE_DATA_COLOR = 1,        // Instance data: color (4 unsigned char), shader location: SHADER_LOC_INSTANCE_COLOR
+    INSTANCE_DATA_CUSTOM = 2        // Instance data: custom (Vector4), shader location: SHADER_LOC_INSTANCE_CUSTOM
+} InstanceDataFlags;
+
 // Pixel formats
 // NOTE: Support depends on OpenGL version and platform
 typedef enum {
@@ -552,6 +607,11 @@ RLAPI void SetTargetFPS(int fps);                                 // Set target
 RLAPI int GetFPS(void);                                           // Get current FPS
 int GetCPUusage(void);
 RLAPI float GetFrameTime(void);                                   // Get time in seconds for last frame drawn (delta time)
+RLAPI float GetFrameJitter(void);                                 // Get frame pacing jitter in seconds (standard deviation of frame end time over target FPS deadline)
+RLAPI FrameTimeStats GetFrameTimeStats(void);                     // Get frame time statistics over last frames (average, percentiles, maximum, hitches)
+RLAPI void ResetFrameTimeStats(void);                             // Reset frame time statistics (frames sampled and hitch counter)
+RLAPI void SetFrameHitchThreshold(float sec);                     // Set frame time counted as hitch (0 for default: twice target frame time or frame time average)
+RLAPI bool ExportFrameTimeStats(const char *fileName);            // Export frame time statistics and frames sampled as CSV or JSON (by file extension), returns true on success
 RLAPI double GetTime(void);                                       // Get elapsed time in seconds since InitGraph()
 
 // Misc. functions
@@ -664,6 +724,11 @@ RLAPI Image LoadImageAnim(const char *fileName, int *frames);
 RLAPI Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. '.png'
 RLAPI Image LoadImageFromTexture(Texture2D texture);                                                     // Load image from GPU texture data
 RLAPI Image LoadImageFromScreen(void);                                                                   // Load image from screen buffer and (screenshot)
+RLAPI ImageReadback LoadImageReadback(int width, int height, int format, int bufferCount);               // Load image readback for asynchronous screen/texture readback (2-3 buffers recommended)
+RLAPI void UnloadImageReadback(ImageReadback readback);                                                  // Unload image readback (pending requests are discarded)
+RLAPI bool RequestScreenReadback(ImageReadback *readback);                                               // Request screen buffer readback (readback format must be RGBA 32bit), false if all buffers pending
+RLAPI bool RequestTextureReadback(ImageReadback *readback, Texture2D texture);                           // Request texture readback (texture size and format must match), false if all buffers pending
+RLAPI bool PollImageReadback(ImageReadback *readback, Image *image);                                     // Get oldest requested image if completed by GPU (no wait), image must be unloaded
 RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
 
 // Image generation functions
@@ -735,6 +800,15 @@ RLAPI void UnloadTexture(Texture2D texture);
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RLAPI void UpdateTextureRec(Texture2D texture, rayRect rec, const void *pixels);                       // Update GPU texture rectangle with new data
 
+// Texture streaming functions
+// NOTE: Texture updates are transferred through a ring of pixel buffers and do not block the CPU
+RLAPI TextureStream LoadTextureStream(Texture2D texture, int bufferCount);                               // Load texture stream for asynchronous updates (2-3 buffers recommended)
+RLAPI void UnloadTextureStream(TextureStream stream);                                                    // Unload texture stream (texture is not unloaded)
+RLAPI void *BeginTextureStreamUpdate(TextureStream *stream);                                             // Begin texture stream update, returns pixel buffer to write full texture data (texture.format)
+RLAPI void EndTextureStreamUpdate(TextureStream *stream);                                                // End texture stream update, transfer to texture is queued
+RLAPI void UpdateTextureStream(TextureStream *stream, const void *pixels);                               // Update texture stream with new data (copied, asynchronous transfer)
+RLAPI bool IsTextureStreamUpdated(TextureStream stream);                                                 // Check if last texture stream update has been completed by GPU
+
 // Texture configuration functions
 RLAPI void GenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
 RLAPI void SetTextureFilter(Texture2D texture, int filter);                                              // Set texture scaling filter mode
@@ -854,8 +928,13 @@ RLAPI void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis,
 RLAPI void UploadMesh(Mesh *mesh, bool dynamic);                                            // Upload mesh vertex data in GPU and provide VAO/VBO ids
 RLAPI void UpdateMeshBuffer(Mesh mesh, int index, void *data, int dataSize, int offset);    // Update mesh vertex data in GPU for a specific buffer index
 RLAPI void UnloadMesh(Mesh mesh);                                                           // Unload mesh data from CPU and GPU
+RLAPI InstanceBuffer LoadInstanceBuffer(int capacity, int flags);                           // Load instance buffer for instanced drawing (flags: InstanceDataFlags)
+RLAPI void UpdateInstanceBuffer(InstanceBuffer buffer, const Matrix *transforms, const Color *colors, const Vector4 *custom, int offset, int count); // Update instance buffer data for a range of instances
+RLAPI void UnloadInstanceBuffer(InstanceBuffer buffer);                                     // Unload instance buffer from GPU memory (VRAM)
 RLAPI void DrawMesh(Mesh mesh, Material material, Matrix transform);                        // Draw a 3d mesh with material and transform
-RLAPI void DrawMeshInstanced(Mesh mesh, Material material, Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
+RLAPI void DrawMeshInstanced(Mesh mesh, Material material, Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms (internal instance buffer, default rlgl context only)
+RLAPI void DrawMeshInstancedBuffer(Mesh mesh, Material material, InstanceBuffer buffer, int instances); // Draw multiple mesh instances with material and instances data from instance buffer
+RLAPI void DrawMeshList(Mesh *meshes, Material material, Matrix *transforms, int count);      // Draw multiple meshes with material and different transforms (single indirect draw if supported, default rlgl context only)
 
 // Mesh generation functions
 RLAPI Mesh GenMeshCube(float width, float height, float length);                            // Generate cuboid mesh
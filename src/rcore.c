@@ -1,6 +1,8 @@
 #include "utils.h"
 #include "raylib.h"                 // Declares module functions
 #include "rlgl.h"                   // OpenGL abstraction layer to OpenGL 1.1, 3.3+ or ES2
+#include <stdlib.h>                 // Required for: qsort() [Used in GetFrameTimeStats()]
+#include <stdio.h>                  // Required for: snprintf() [Used in ExportFrameTimeStats()]
 #include <string.h>                 // Required for: strrchr(), strcmp(), strlen()
 #include <time.h>                   // Required for: time() [Used in InitTimer()]
 #include <math.h>                   // Required for: tan() [Used in BeginMode3D()], atan2f() [Used in LoadVrStereoConfig()]
@@ -9,13 +11,36 @@
                                 // NOTE: Already provided by rlgl implementation (on glad.h)
 #include "GLFW/glfw3.h"         // GLFW3 library: Windows, OpenGL context and Input management
                                 // NOTE: GLFW3 already includes gl.h (OpenGL) headers
-#define GLFW_EXPOSE_NATIVE_WIN32
-#include "GLFW/glfw3native.h"       // WARNING: It requires customization to avoid windows.h inclusion!
+#if defined(_WIN32)
+    #define GLFW_EXPOSE_NATIVE_WIN32
+    #include "GLFW/glfw3native.h"   // WARNING: It requires customization to avoid windows.h inclusion!
+#endif
+
+// Headless rendering support (FLAG_WINDOW_HEADLESS), no window or display server required
+// NOTE: Mesa EGL surfaceless platform also works on CPU-only systems (llvmpipe software rasterizer)
+#if defined(SUPPORT_HEADLESS_EGL)
+    #include <EGL/egl.h>            // EGL library: OpenGL context without window (surfaceless or pbuffer)
+    #include <EGL/eglext.h>         // EGL extensions: eglGetPlatformDisplayEXT(), EGL_PLATFORM_SURFACELESS_MESA
+#endif
+
+// Frame pacing sleep: high resolution waitable timer on Windows, monotonic clock absolute sleep (clock_nanosleep()) otherwise
+// NOTE: Windows timer functions are declared by windows.h (included by glfw3native.h), older SDKs miss the high resolution flag
+#if defined(_WIN32)
+    #ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+        #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION   0x00000002
+    #endif
+#else
+    #include <errno.h>                  // Required for: EINTR
+#endif
 
 #define MAX_KEYBOARD_KEYS            512        // Maximum number of keyboard keys supported
 #define MAX_MOUSE_BUTTONS              8        // Maximum number of mouse buttons supported
 #define MAX_KEY_PRESSED_QUEUE         16        // Maximum number of keys in the key input queue
 #define MAX_CHAR_PRESSED_QUEUE        16        // Maximum number of characters in the char input queue
+#define MAX_FRAME_TIME_SAMPLES       256        // Maximum number of frames timings kept for statistics (ring buffer)
+
+#define FRAME_PACING_SPIN_MIN     0.00005       // Minimum busy wait before a wait deadline (seconds)
+#define FRAME_PACING_SPIN_MAX     0.004         // Maximum busy wait before a wait deadline (seconds), also initial one
 
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
@@ -28,6 +53,7 @@
 //----------------------------------------------------------------------------------
 typedef struct { int x; int y; } Point;
 typedef struct { unsigned int width; unsigned int height; } Size;
+typedef struct { float update; float draw; float swap; float wait; } FrameTimeSample;    // Frame timings (seconds)
 
 // Core global state context data
 typedef struct CoreData {
@@ -47,6 +73,15 @@ typedef struct CoreData {
         Size render;                        // Framebuffer width and height (render area, including black bars if required)
         Point renderOffset;                 // Offset from render area (must be divided by 2)
         Matrix screenScale;                 // Matrix to scale screen (framebuffer rendering)
+
+        struct {
+            void *display;                  // EGL display (EGLDisplay)
+            void *context;                  // EGL context (EGLContext)
+            void *surface;                  // EGL pbuffer surface (EGLSurface), only required if surfaceless context is not supported
+            unsigned int fboId;             // Framebuffer used as screen (rlgl default framebuffer)
+            unsigned int colorId;           // Framebuffer color texture
+            bool rlglReady;                 // rlgl initialized on device context (closed before context is destroyed)
+        } Headless;                         // Headless device data (FLAG_WINDOW_HEADLESS)
     } Window;
     struct {
         const char *basePath;               // Base path for data storage
@@ -84,6 +119,23 @@ typedef struct CoreData {
         double draw;                        // Time measure for frame draw
         double frame;                       // Time measure for one frame
         double target;                      // Desired time for one frame, if 0 not applied
+        double base;                        // Headless timer base time (monotonic clock), GLFW timer is not available
+        double deadline;                    // Next frame deadline (absolute time), frames are scheduled on it to avoid drift
+        double spinMargin;                  // Busy wait time before deadlines, adapted to measured sleep overshoot
+        double oversleepMean;               // Sleep overshoot average (exponential moving average)
+        double oversleepDeviation;          // Sleep overshoot mean deviation (exponential moving average)
+        double deadlineErrorMean;           // Frame end delay over deadline average (exponential moving average)
+        double deadlineErrorVariance;       // Frame end delay over deadline variance (exponential moving average), jitter is its square root
+        void *timer;                        // High resolution waitable timer (Windows only, NULL if not available)
+        double swap;                        // Time measure for buffers swap (included in draw)
+        double wait;                        // Time measure for frame wait (target FPS)
+
+        FrameTimeSample samples[MAX_FRAME_TIME_SAMPLES];    // Last frames timings (ring buffer)
+        int sampleIndex;                    // Ring buffer position of next sample
+        int sampleCount;                    // Number of samples stored
+        double sampleSum;                   // Sum of stored samples frame time (average in constant time)
+        int hitchCount;                     // Frames over hitch threshold since last reset
+        double hitchThreshold;              // Frame time counted as hitch (0 for default)
     } Time;                                 // Mesure in seconds
 } CoreData;
 
@@ -91,12 +143,19 @@ static CoreData CORE = { 0 };               // Global CORE state context
 
 extern void LoadFontDefault(void);          // [Module: text] Loads default font on InitGraph()
 extern void UnloadFontDefault(void);        // [Module: text] Unloads default font from GPU memory
+extern void UnloadModelsBuffers(void);      // [Module: models] Unloads internal models buffers from GPU memory (mesh arena, instance buffer)
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static void InitTimer(void);                            // Initialize timer (hi-resolution if available)
 static bool InitGraphicsDevice(int width, int height);  // Initialize graphics device
+static bool InitHeadlessDevice(int width, int height);  // Initialize headless graphics device (no window, fbo as screen)
+static void CloseHeadlessDevice(void);                  // Close headless graphics device
+static double GetHeadlessTime(void);                    // Get headless timer time in seconds
+static void WaitTimeUntil(double time);                 // Wait until time, sleeping most of the wait and busy waiting the rest
+static void AddFrameTimeSample(void);                   // Add last frame timings to frame time statistics
+static int CompareFrameTimes(const void *a, const void *b);     // Compare frame times, used to sort samples for percentiles
 static void SetupFramebuffer(int width, int height);    // Setup main framebuffer
 static void SetupViewport(int width, int height);       // Set viewport for a provided width and height
 
@@ -339,11 +398,20 @@ void InitGraph(int width, int height, const char *title)
 void CloseGraph(void)
 {
     UnloadFontDefault();
-    rlglClose();                // De-init rlgl
-    glfwDestroyWindow(CORE.Window.handle);
-    glfwTerminate();
+    UnloadModelsBuffers();
+    if ((CORE.Window.flags & FLAG_WINDOW_HEADLESS) > 0) CloseHeadlessDevice();     // rlgl is also closed, after screen fbo
+    else
+    {
+        rlglClose();            // De-init rlgl
+        glfwDestroyWindow(CORE.Window.handle);
+        glfwTerminate();
+    }
     CORE.Window.ready = false;
+#if defined(_WIN32)
+    if (CORE.Time.timer != NULL) CloseHandle(CORE.Time.timer);
+    CORE.Time.timer = NULL;
     timeEndPeriod(1);
+#endif
     TRACELOG(LOG_INFO, "Window closed successfully");
 }
 
@@ -351,6 +419,8 @@ void CloseGraph(void)
 bool WindowShouldClose(void)
 {
     if (!CORE.Window.ready) return true;
+    // No window to be closed on headless rendering, program decides when to end
+    if ((CORE.Window.flags & FLAG_WINDOW_HEADLESS) > 0) return CORE.Window.shouldClose;
     // While window minimized, stop loop execution
     while (IsWindowState(FLAG_WINDOW_MINIMIZED) && !IsWindowState(FLAG_WINDOW_ALWAYS_RUN))
         glfwWaitEvents();
@@ -656,6 +726,8 @@ void BeginDrawing(void) {
     CORE.Time.current = GetTime();      // Number of elapsed seconds since InitTimer()
     CORE.Time.usrcalc = CORE.Time.current - CORE.Time.previous;
     CORE.Time.previous = CORE.Time.current;
+    rlResetRenderBatchStats();          // Reset per-frame render batch flush/wait counters
+    rlResetStateCacheStats();           // Reset per-frame GL state cache issued/skipped counters
     rlLoadIdentity();                   // Reset current matrix (modelview)
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling
 }
@@ -663,23 +735,42 @@ void BeginDrawing(void) {
 // End canvas drawing and swap buffers (double buffering)
 void EndDrawing(void) {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlTraceFrame();                 // Mark end of frame on command trace (if capturing)
+    rlUpdateGpuZones();             // End GPU profiling zones frame (results read back some frames later)
+    double swapTime = GetTime();
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
     // Frame time control system
     CORE.Time.current = GetTime();
+    CORE.Time.swap = CORE.Time.current - swapTime;
     CORE.Time.draw = CORE.Time.current - CORE.Time.previous;
     CORE.Time.previous = CORE.Time.current;
     CORE.Time.frame = CORE.Time.usrcalc + CORE.Time.draw;
+    CORE.Time.wait = 0.0;
 
-    // Wait for some milliseconds...
-    if (CORE.Time.frame < CORE.Time.target)
+    // Wait for frame deadline, deadlines are absolute (previous one + target) so wait errors do not accumulate,
+    // a frame longer than target starts a new schedule (no burst of short frames to catch up)
+    if (CORE.Time.target > 0.0)
     {
-        double waitTimeTarget = CORE.Time.target - CORE.Time.frame;
-        WaitTime((float)waitTimeTarget);
-        CORE.Time.current = GetTime();
-        double waitTimeReal = CORE.Time.current - CORE.Time.previous;
-        CORE.Time.previous = CORE.Time.current;
-        CORE.Time.frame += waitTimeReal;    // Total frame time: usrcalc + draw + wait
+        CORE.Time.deadline += CORE.Time.target;
+
+        if (CORE.Time.deadline <= CORE.Time.current) CORE.Time.deadline = CORE.Time.current;
+        else
+        {
+            WaitTimeUntil(CORE.Time.deadline);
+            CORE.Time.current = GetTime();
+
+            // Jitter measures deadline error spread, a constant delay (bias) is not jitter
+            double deadlineError = CORE.Time.current - CORE.Time.deadline;
+            double deviation = deadlineError - CORE.Time.deadlineErrorMean;
+            CORE.Time.deadlineErrorMean += deviation*0.05;
+            CORE.Time.deadlineErrorVariance += (deviation*deviation - CORE.Time.deadlineErrorVariance)*0.05;
+
+            CORE.Time.wait = CORE.Time.current - CORE.Time.previous;
+            CORE.Time.previous = CORE.Time.current;
+            CORE.Time.frame += CORE.Time.wait;  // Total frame time: usrcalc + draw + wait
+        }
     }
+    AddFrameTimeSample();
     PollInputEvents();      // Poll user events (before next frame update)
 }
 
@@ -703,12 +794,15 @@ void BeginMode3D(Camera3D camera)
     Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);  // Setup Camera view
     rlMultMatrixf(MatrixToFloat(matView));      // Multiply modelview matrix by view matrix (camera)
     rlEnableDepthTest();            // Enable DEPTH_TEST for 3D
+    rlSetCameraUniforms(rlGetMatrixModelview(), rlGetMatrixProjection());  // Upload camera matrices once for all meshes (camera uniform block)
+    rlBeginGpuZone("Mode3D");       // Measure 3D mode GPU time (if GPU profiling zones enabled)
 }
 
 // Ends 3D mode and returns to default 2D orthographic mode
 void EndMode3D(void)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlEndGpuZone();                 // End 3D mode GPU zone
     rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
     rlPopMatrix();                  // Restore previous matrix (projection) from matrix stack
     rlMatrixMode(RL_MODELVIEW);     // Switch back to modelview matrix
@@ -757,12 +851,15 @@ Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode)
         shader.locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
         shader.locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
         shader.locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+        shader.locs[SHADER_LOC_INSTANCE_COLOR] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR);
+        shader.locs[SHADER_LOC_INSTANCE_CUSTOM] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_CUSTOM);
         // Get handles to GLSL uniform locations (vertex shader)
         shader.locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
         shader.locs[SHADER_LOC_MATRIX_VIEW] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW);
         shader.locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
         shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
         shader.locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
+        shader.locs[SHADER_LOC_BLOCK_CAMERA] = rlGetLocationUniformBlock(shader.id, RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_CAMERA, RL_DEFAULT_CAMERA_UNIFORM_BINDING);
         // Get handles to GLSL uniform locations (fragment shader)
         shader.locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
         shader.locs[SHADER_LOC_MAP_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);  // SHADER_LOC_MAP_ALBEDO
@@ -841,15 +938,10 @@ Vector2 GetWorldToScreenEx(Vector3 position, Camera camera, int width, int heigh
     return (Vector2){ (ndcPos.x + 1.0f)/2.0f*(float)width, (ndcPos.y + 1.0f)/2.0f*(float)height };
 }
 
-// Wait for some milliseconds (stop program execution)
-// NOTE: Sleep() granularity could be around 10 ms, it means, Sleep() could
-// take longer than expected... for that reason we use the busy wait loop
+// Wait for some seconds (stop program execution)
+// NOTE: Most of the wait is slept, only the last part (measured sleep overshoot) is busy waited
 void WaitTime(float sec) {
-    double previousTime = glfwGetTime();
-    Sleep((unsigned int)(sec * 950.0f + 0.5f));
-    double currentTime;
-    do { currentTime = glfwGetTime(); }
-    while ((currentTime - previousTime) < sec);
+    if (sec > 0.0f) WaitTimeUntil(GetTime() + sec);
 }
 // Set target FPS (maximum)
 void SetTargetFPS(int fps) {
@@ -862,8 +954,109 @@ int GetFPS(void) { return (int)roundf(1.0f / GetFrameTime()); }
 int GetCPUusage(void) { return (int)roundf(100.0f * (CORE.Time.usrcalc + CORE.Time.draw) / CORE.Time.frame); }
 // Get time in seconds for last frame drawn (delta time)
 float GetFrameTime(void) { return (float)CORE.Time.frame; }
+// Get frame pacing jitter in seconds (standard deviation of frames end time over their deadline, target FPS waits only)
+float GetFrameJitter(void) { return (float)sqrt(CORE.Time.deadlineErrorVariance); }
+
+// Get frame time statistics over last frames (average, percentiles, maximum, hitches)
+// NOTE: Percentiles are nearest-rank over a sorted copy of the samples, cost is paid on query only
+FrameTimeStats GetFrameTimeStats(void)
+{
+    FrameTimeStats stats = { 0 };
+    float frameTimes[MAX_FRAME_TIME_SAMPLES] = { 0 };
+    int count = CORE.Time.sampleCount;
+
+    stats.frameCount = count;
+    stats.hitchCount = CORE.Time.hitchCount;
+    if (count == 0) return stats;
+
+    for (int i = 0; i < count; i++)
+    {
+        FrameTimeSample sample = CORE.Time.samples[i];
+        frameTimes[i] = sample.update + sample.draw + sample.swap + sample.wait;
+        stats.update += sample.update;
+        stats.draw += sample.draw;
+        stats.swap += sample.swap;
+        stats.wait += sample.wait;
+    }
+
+    qsort(frameTimes, count, sizeof(float), CompareFrameTimes);
+
+    stats.mean = (float)(CORE.Time.sampleSum/count);
+    stats.p50 = frameTimes[(count*50 + 99)/100 - 1];
+    stats.p95 = frameTimes[(count*95 + 99)/100 - 1];
+    stats.p99 = frameTimes[(count*99 + 99)/100 - 1];
+    stats.max = frameTimes[count - 1];
+    stats.update /= count;
+    stats.draw /= count;
+    stats.swap /= count;
+    stats.wait /= count;
+
+    return stats;
+}
+
+// Reset frame time statistics (frames sampled and hitch counter)
+void ResetFrameTimeStats(void)
+{
+    CORE.Time.sampleIndex = 0;
+    CORE.Time.sampleCount = 0;
+    CORE.Time.sampleSum = 0.0;
+    CORE.Time.hitchCount = 0;
+}
+
+// Set frame time counted as hitch (0 for default: twice target frame time or frame time average)
+void SetFrameHitchThreshold(float sec) { CORE.Time.hitchThreshold = (sec > 0.0f)? sec : 0.0; }
+
+// Export frame time statistics and frames sampled as CSV or JSON (by file extension)
+// NOTE: Times are exported in milliseconds, frames from oldest to newest
+bool ExportFrameTimeStats(const char *fileName)
+{
+    bool success = false;
+    bool json = false;
+
+    if (IsFileExtension(fileName, ".json")) json = true;
+    else if (!IsFileExtension(fileName, ".csv"))
+    {
+        TRACELOG(LOG_WARNING, "TIMER: [%s] Frame time statistics file format not supported", fileName);
+        return success;
+    }
+
+    FrameTimeStats stats = GetFrameTimeStats();
+    int size = 1024 + CORE.Time.sampleCount*256;
+    char *text = (char *)RL_CALLOC(size, sizeof(char));
+    int length = 0;
+
+    if (json)
+    {
+        length += snprintf(text + length, size - length, "{\n    \"frameCount\": %i,\n    \"hitchCount\": %i,\n", stats.frameCount, stats.hitchCount);
+        length += snprintf(text + length, size - length, "    \"mean\": %.4f,\n    \"p50\": %.4f,\n    \"p95\": %.4f,\n    \"p99\": %.4f,\n    \"max\": %.4f,\n",
+            stats.mean*1000.0f, stats.p50*1000.0f, stats.p95*1000.0f, stats.p99*1000.0f, stats.max*1000.0f);
+        length += snprintf(text + length, size - length, "    \"update\": %.4f,\n    \"draw\": %.4f,\n    \"swap\": %.4f,\n    \"wait\": %.4f,\n    \"frames\": [",
+            stats.update*1000.0f, stats.draw*1000.0f, stats.swap*1000.0f, stats.wait*1000.0f);
+    }
+    else length += snprintf(text + length, size - length, "frame,update,draw,swap,wait,total\n");
+
+    int first = (CORE.Time.sampleIndex - CORE.Time.sampleCount + MAX_FRAME_TIME_SAMPLES)%MAX_FRAME_TIME_SAMPLES;
+
+    for (int i = 0; i < CORE.Time.sampleCount; i++)
+    {
+        FrameTimeSample sample = CORE.Time.samples[(first + i)%MAX_FRAME_TIME_SAMPLES];
+        float total = sample.update + sample.draw + sample.swap + sample.wait;
+
+        if (json) length += snprintf(text + length, size - length, "%s\n        { \"update\": %.4f, \"draw\": %.4f, \"swap\": %.4f, \"wait\": %.4f, \"total\": %.4f }",
+            (i > 0)? "," : "", sample.update*1000.0f, sample.draw*1000.0f, sample.swap*1000.0f, sample.wait*1000.0f, total*1000.0f);
+        else length += snprintf(text + length, size - length, "%i,%.4f,%.4f,%.4f,%.4f,%.4f\n",
+            i, sample.update*1000.0f, sample.draw*1000.0f, sample.swap*1000.0f, sample.wait*1000.0f, total*1000.0f);
+    }
+
+    if (json) snprintf(text + length, size - length, "\n    ]\n}\n");
+
+    success = SaveFileText(fileName, text);
+    RL_FREE(text);
+
+    return success;
+}
 // Get elapsed time measure in seconds since InitTimer()/glfwInit()
-double GetTime(void) { return glfwGetTime(); }
+double GetTime(void) { return ((CORE.Window.flags & FLAG_WINDOW_HEADLESS) > 0)? GetHeadlessTime() : glfwGetTime(); }
 
 // Setup window configuration flags (view FLAGS)
 // NOTE: This function is expected to be called before window creation,
@@ -976,7 +1169,7 @@ Vector2 GetMouseDelta(void) {
 // Set mouse position XY
 void SetMousePosition(int x, int y) {
     CORE.Input.Mouse.currentPosition = (Vector2){ (float)x, (float)y };
-    glfwSetCursorPos(CORE.Window.handle, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
+    if ((CORE.Window.flags & FLAG_WINDOW_HEADLESS) == 0) glfwSetCursorPos(CORE.Window.handle, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
 }
 
 // Set mouse offset
@@ -1009,6 +1202,8 @@ void SetMouseCursor(int cursor) {
 // NOTE: returns false in case graphic device could not be created
 static bool InitGraphicsDevice(int width, int height)
 {
+    if ((CORE.Window.flags & FLAG_WINDOW_HEADLESS) > 0) return InitHeadlessDevice(width, height);
+
     CORE.Window.screen.width = width;            // User desired width
     CORE.Window.screen.height = height;          // User desired height
     CORE.Window.screenScale = MatrixIdentity();  // No draw scaling required by default
@@ -1239,14 +1434,248 @@ static void SetupFramebuffer(int width, int height)
     }
 }
 
+// Initialize headless graphics device: OpenGL context without window and fbo used as screen
+// NOTE: Screen size must be provided (no display to query), rendering is done at screen size (no scaling)
+// Drawn frames are read back by the program with LoadImageFromScreen() or RequestScreenReadback()
+static bool InitHeadlessDevice(int width, int height)
+{
+#if defined(SUPPORT_HEADLESS_EGL)
+    if ((width <= 0) || (height <= 0))
+    {
+        TRACELOG(LOG_WARNING, "HEADLESS: Screen size is required, no display available");
+        return false;
+    }
+
+    CORE.Window.screen.width = width;
+    CORE.Window.screen.height = height;
+    CORE.Window.display = CORE.Window.screen;
+    CORE.Window.render = CORE.Window.screen;
+    CORE.Window.currentFbo = CORE.Window.screen;
+    CORE.Window.screenScale = MatrixIdentity();
+    if ((CORE.Window.flags & FLAG_MSAA_4X_HINT) > 0) TRACELOG(LOG_WARNING, "HEADLESS: MSAA x4 not supported, screen fbo is not multisampled");
+
+    // Mesa surfaceless platform does not require any display server or GPU device, default display is used otherwise
+    EGLDisplay display = EGL_NO_DISPLAY;
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (getPlatformDisplay != NULL) display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    if (display == EGL_NO_DISPLAY) display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if ((display == EGL_NO_DISPLAY) || !eglInitialize(display, NULL, NULL))
+    {
+        TRACELOG(LOG_WARNING, "HEADLESS: Failed to initialize EGL display");
+        return false;
+    }
+    CORE.Window.Headless.display = display;
+
+    // Surfaceless context avoids any EGL surface, a small pbuffer is just required to make context current otherwise
+    const char *extensions = eglQueryString(display, EGL_EXTENSIONS);
+    bool surfaceless = ((extensions != NULL) && (strstr(extensions, "EGL_KHR_surfaceless_context") != NULL));
+
+    const EGLint configAttribs[] = {
+        EGL_SURFACE_TYPE, surfaceless? 0 : EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE
+    };
+    EGLConfig config = NULL;
+    EGLint configCount = 0;
+    if (!eglBindAPI(EGL_OPENGL_API) || !eglChooseConfig(display, configAttribs, &config, 1, &configCount) || (configCount == 0))
+    {
+        TRACELOG(LOG_WARNING, "HEADLESS: Failed to find an OpenGL capable EGL config");
+        CloseHeadlessDevice();
+        return false;
+    }
+
+    const EGLint contextAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    CORE.Window.Headless.context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+
+    if (!surfaceless)
+    {
+        const EGLint surfaceAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+        CORE.Window.Headless.surface = eglCreatePbufferSurface(display, config, surfaceAttribs);
+    }
+
+    if ((CORE.Window.Headless.context == EGL_NO_CONTEXT) || (!surfaceless && (CORE.Window.Headless.surface == EGL_NO_SURFACE)) ||
+        !eglMakeCurrent(display, CORE.Window.Headless.surface, CORE.Window.Headless.surface, CORE.Window.Headless.context))
+    {
+        TRACELOG(LOG_WARNING, "HEADLESS: Failed to create OpenGL 3.3 core context (EGL error: 0x%04x)", eglGetError());
+        CloseHeadlessDevice();
+        return false;
+    }
+
+    // Timer base, GetTime() is valid from now on
+    CORE.Time.base = 0.0;
+    CORE.Time.base = GetHeadlessTime();
+
+    TRACELOG(LOG_INFO, "HEADLESS: Device initialized successfully (%s context)", surfaceless? "surfaceless" : "pbuffer");
+    TRACELOG(LOG_INFO, "    > Screen size:  %i x %i", CORE.Window.screen.width, CORE.Window.screen.height);
+
+    // Load OpenGL extensions and initialize OpenGL context (states and resources)
+    rlLoadExtensions((void *)eglGetProcAddress);
+    rlglInit(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
+    CORE.Window.Headless.rlglReady = true;
+
+    // Screen fbo: color texture and depth renderbuffer, binded as default framebuffer
+    CORE.Window.Headless.fboId = rlLoadFramebuffer(width, height);
+    CORE.Window.Headless.colorId = rlLoadTexture(NULL, width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    rlFramebufferAttach(CORE.Window.Headless.fboId, CORE.Window.Headless.colorId, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+    rlFramebufferAttach(CORE.Window.Headless.fboId, rlLoadTextureDepth(width, height, true), RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+
+    if (!rlFramebufferComplete(CORE.Window.Headless.fboId))
+    {
+        TRACELOG(LOG_WARNING, "HEADLESS: Failed to create screen framebuffer");
+        CloseHeadlessDevice();
+        return false;
+    }
+
+    rlSetDefaultFramebuffer(CORE.Window.Headless.fboId);
+
+    SetupViewport(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
+    ClearBackground(RAYWHITE);
+
+    return true;
+#else
+    TRACELOG(LOG_WARNING, "HEADLESS: Headless rendering not supported, library must be built with SUPPORT_HEADLESS_EGL");
+    return false;
+#endif
+}
+
+// Close headless graphics device: screen fbo, rlgl and EGL context
+// NOTE: It also releases a partially initialized device, OpenGL resources are unloaded while context is still current
+static void CloseHeadlessDevice(void)
+{
+#if defined(SUPPORT_HEADLESS_EGL)
+    if (CORE.Window.Headless.fboId != 0)
+    {
+        rlSetDefaultFramebuffer(0);
+        rlUnloadFramebuffer(CORE.Window.Headless.fboId);    // Depth renderbuffer is also unloaded
+        rlUnloadTexture(CORE.Window.Headless.colorId);
+        CORE.Window.Headless.fboId = 0;
+        CORE.Window.Headless.colorId = 0;
+    }
+
+    if (CORE.Window.Headless.rlglReady)
+    {
+        rlglClose();
+        CORE.Window.Headless.rlglReady = false;
+    }
+
+    EGLDisplay display = (EGLDisplay)CORE.Window.Headless.display;
+    if (display != EGL_NO_DISPLAY)
+    {
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (CORE.Window.Headless.surface != EGL_NO_SURFACE) eglDestroySurface(display, (EGLSurface)CORE.Window.Headless.surface);
+        if (CORE.Window.Headless.context != EGL_NO_CONTEXT) eglDestroyContext(display, (EGLContext)CORE.Window.Headless.context);
+        eglTerminate(display);
+    }
+
+    CORE.Window.Headless.display = NULL;
+    CORE.Window.Headless.context = NULL;
+    CORE.Window.Headless.surface = NULL;
+#endif
+}
+
+// Get headless timer time in seconds since headless device initialization
+// NOTE: Monotonic clock, not affected by system time changes
+static double GetHeadlessTime(void)
+{
+    double time = 0.0;
+#if defined(SUPPORT_HEADLESS_EGL)
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    time = (double)ts.tv_sec + (double)ts.tv_nsec*1e-9 - CORE.Time.base;
+#endif
+    return time;
+}
+
 // Initialize hi-resolution timer. Get time as double
 static void InitTimer(void) {
-    MMRESULT result = timeBeginPeriod(1);
+#if defined(_WIN32)
+    timeBeginPeriod(1);     // Sleep() resolution to 1 ms, only used if high resolution waitable timer is not available
+    // High resolution waitable timer, requires Windows 10 1803 (NULL returned on older versions)
+    CORE.Time.timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+#endif
+    CORE.Time.spinMargin = FRAME_PACING_SPIN_MAX;
     CORE.Time.previous = GetTime();
 }
 
+// Add last frame timings to frame time statistics
+// NOTE: Oldest sample is overwritten when ring buffer is full, hitch threshold defaults to
+// twice target frame time (twice frame time average if no target FPS)
+static void AddFrameTimeSample(void)
+{
+    double threshold = CORE.Time.hitchThreshold;
+    if ((threshold <= 0.0) && (CORE.Time.target > 0.0)) threshold = 2.0*CORE.Time.target;
+    else if ((threshold <= 0.0) && (CORE.Time.sampleCount > 0)) threshold = 2.0*CORE.Time.sampleSum/CORE.Time.sampleCount;
+
+    if ((threshold > 0.0) && (CORE.Time.frame > threshold)) CORE.Time.hitchCount++;
+
+    FrameTimeSample *sample = &CORE.Time.samples[CORE.Time.sampleIndex];
+
+    if (CORE.Time.sampleCount == MAX_FRAME_TIME_SAMPLES) CORE.Time.sampleSum -= (double)sample->update + sample->draw + sample->swap + sample->wait;
+    else CORE.Time.sampleCount++;
+
+    sample->update = (float)CORE.Time.usrcalc;
+    sample->draw = (float)(CORE.Time.draw - CORE.Time.swap);
+    sample->swap = (float)CORE.Time.swap;
+    sample->wait = (float)CORE.Time.wait;
+
+    CORE.Time.sampleSum += (double)sample->update + sample->draw + sample->swap + sample->wait;
+    CORE.Time.sampleIndex = (CORE.Time.sampleIndex + 1)%MAX_FRAME_TIME_SAMPLES;
+}
+
+// Compare frame times, used to sort samples for percentiles
+static int CompareFrameTimes(const void *a, const void *b)
+{
+    float timeA = *(const float *)a;
+    float timeB = *(const float *)b;
+    return (timeA > timeB) - (timeA < timeB);
+}
+
+// Wait until time, sleeping most of the wait and busy waiting the rest
+// NOTE: Busy wait margin is adapted to measured sleep overshoot (average plus 4 mean deviations),
+// usually below 0.1 ms on Linux and 0.5 ms with Windows high resolution timer
+static void WaitTimeUntil(double time) {
+    double currentTime = GetTime();
+    double sleepTime = time - currentTime - CORE.Time.spinMargin;
+
+    if (sleepTime > 0.0)
+    {
+#if defined(_WIN32)
+        if (CORE.Time.timer != NULL)
+        {
+            LARGE_INTEGER dueTime = { 0 };
+            dueTime.QuadPart = -(LONGLONG)(sleepTime*1e7);     // Relative time in 100 ns units
+            if (SetWaitableTimer(CORE.Time.timer, &dueTime, 0, NULL, NULL, FALSE)) WaitForSingleObject(CORE.Time.timer, INFINITE);
+        }
+        else Sleep((unsigned long)(sleepTime*1000.0));
+#else
+        // NOTE: Sleep is scheduled on absolute monotonic time, not delayed if thread is interrupted
+        struct timespec ts = { 0 };
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        long long wakeTime = (long long)ts.tv_sec*1000000000LL + ts.tv_nsec + (long long)(sleepTime*1e9);
+        ts.tv_sec = (time_t)(wakeTime/1000000000LL);
+        ts.tv_nsec = (long)(wakeTime%1000000000LL);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) { }
+#endif
+        double oversleep = GetTime() - (currentTime + sleepTime);
+        CORE.Time.oversleepMean += (oversleep - CORE.Time.oversleepMean)*0.1;
+        CORE.Time.oversleepDeviation += (fabs(oversleep - CORE.Time.oversleepMean) - CORE.Time.oversleepDeviation)*0.1;
+
+        CORE.Time.spinMargin = CORE.Time.oversleepMean + 4.0*CORE.Time.oversleepDeviation;
+        if (CORE.Time.spinMargin < FRAME_PACING_SPIN_MIN) CORE.Time.spinMargin = FRAME_PACING_SPIN_MIN;
+        else if (CORE.Time.spinMargin > FRAME_PACING_SPIN_MAX) CORE.Time.spinMargin = FRAME_PACING_SPIN_MAX;
+    }
+
+    while (GetTime() < time) { }
+}
+
 // Swap back buffer with front buffer (screen drawing)
-void SwapScreenBuffer(void) { glfwSwapBuffers(CORE.Window.handle); }
+// NOTE: On headless rendering screen is an fbo, no swap required (frame is read back by the program)
+void SwapScreenBuffer(void) { if ((CORE.Window.flags & FLAG_WINDOW_HEADLESS) == 0) glfwSwapBuffers(CORE.Window.handle); }
 
 // Register all input events
 void PollInputEvents(void)
@@ -1265,7 +1694,7 @@ void PollInputEvents(void)
     // Register previous mouse position
     CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
     CORE.Window.resizedLastFrame = false;
-    glfwPollEvents();       // Register keyboard/mouse events (callbacks)... and window events!
+    if ((CORE.Window.flags & FLAG_WINDOW_HEADLESS) == 0) glfwPollEvents();       // Register keyboard/mouse events (callbacks)... and window events!
 }
 
 // GLFW3 Error Callback, runs on GLFW3 error
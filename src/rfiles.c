@@ -20,7 +20,7 @@ static char **dirFilesPath = NULL;          // Store directory files paths as st
 static int dirFileCount = 0;                // Count directory files strings
 
 // Check if the file exists
-bool FileExists(const char *fileName) { return (_access(fileName, 0) != -1); }
+bool FileExists(const char *fileName) { return (ACCESS(fileName, 0) != -1); }
 
 // Check file extension
 // NOTE: Extensions checking is not case-sensitive
@@ -5,9 +5,61 @@
 #define GLAD_FREE RL_FREE
 #define GLAD_GL_IMPLEMENTATION
 #include "external/glad.h"      // GLAD extensions loading library, includes OpenGL headers
-#include <stdlib.h>                     // Required for: malloc(), free()
+#include <stdlib.h>                     // Required for: malloc(), free(), qsort()
 #include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
+#include <stddef.h>                     // Required for: offsetof() [Used in interleaved batch vertex layout]
+#include <stdio.h>                      // Required for: snprintf() [Used in shader cache file names]
+#include <limits.h>                     // Required for: INT_MAX [Used in command trace replay data validation]
+
+// SIMD instruction sets used on batch vertex transformation, selected at runtime by CPU support
+// NOTE: Define RLGL_NO_SIMD to use scalar transformation only (comparison or debugging)
+#if defined(RLGL_NO_SIMD)
+    // Scalar batch vertex transformation only
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define RLGL_SIMD_SSE2
+    #include <emmintrin.h>              // Required for: SSE2 intrinsics, _MM_TRANSPOSE4_PS()
+    #if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+        #define RLGL_SIMD_AVX2
+        #include <immintrin.h>          // Required for: AVX intrinsics
+        #if defined(_MSC_VER)
+            #include <intrin.h>         // Required for: __cpuid(), __cpuidex(), _xgetbv()
+        #endif
+    #endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define RLGL_SIMD_NEON
+    #include <arm_neon.h>               // Required for: NEON intrinsics
+#endif
+
+// Thread local storage, used for per-thread command buffer recording
+#if defined(_MSC_VER)
+    #define RLGL_THREAD_LOCAL __declspec(thread)
+#else
+    #define RLGL_THREAD_LOCAL __thread
+#endif
+
+// Software rasterizer worker threads (persistent, parked between flushes) and shared tiles counter
+#if defined(_WIN32)
+    #include <process.h>                // Required for: _beginthreadex()
+    __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+    __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+    __declspec(dllimport) void *__stdcall CreateSemaphoreA(void *attributes, long initialCount, long maximumCount, const char *name);
+    __declspec(dllimport) int __stdcall ReleaseSemaphore(void *semaphore, long releaseCount, long *previousCount);
+#else
+    #include <pthread.h>                // Required for: pthread_create(), pthread_join(), pthread_cond_wait()
+#endif
+#if defined(_MSC_VER)
+    #include <intrin.h>                 // Required for: _InterlockedExchangeAdd()
+    #define RLGL_ATOMIC_FETCH_ADD(ptr, value) _InterlockedExchangeAdd((volatile long *)(ptr), (value))
+#else
+    #define RLGL_ATOMIC_FETCH_ADD(ptr, value) __sync_fetch_and_add((ptr), (value))
+#endif
+
+#if defined(RLGL_SIMD_AVX2) && (defined(__GNUC__) || defined(__clang__))
+    #define RLGL_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define RLGL_TARGET_AVX2
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -17,6 +69,24 @@
 
 #define RLGL_RENDER_TEXTURES_HINT
 
+#define RLGL_CACHE_TEXTURE_SLOTS    16          // Texture slots tracked by GL state cache (binds on upper slots are always issued)
+#define RLGL_CACHE_UNKNOWN  0xFFFFFFFF          // GL state cache value unknown, next change is always issued
+
+#define RLGL_MAX_GPU_ZONE_DEPTH     16          // Maximum GPU zones nesting depth (deeper zones are not measured)
+
+#define RLGL_TRACE_VERSION          1           // Command trace file format version
+#define RLGL_TRACE_MAX_RESOURCES    1024        // Maximum textures and shaders alive on command trace replay
+#define RLGL_TRACE_ACTIVE   ((RLGL.Trace.file != NULL) && (RLGL.Trace.suspended == 0))  // Command trace capture active (not suspended)
+
+#define RLGL_SOFTWARE_TILE_SIZE     64          // Software rasterizer screen tile size in pixels (triangles are binned by tile)
+#define RLGL_SOFTWARE_MAX_THREADS   32          // Software rasterizer maximum threads
+#define RLGL_SOFTWARE_MIN_PARALLEL  64          // Software rasterizer minimum binned triangles to wake worker threads
+
+#define RLGL_TEXTURE_SLOT_LOCATION  15          // Vertex attribute location of render batch texture slot (vertexTexSlot)
+#if (RL_DEFAULT_BATCH_TEXTURE_SLOTS < 1) || (RL_DEFAULT_BATCH_TEXTURE_SLOTS > 8)
+    #error "RL_DEFAULT_BATCH_TEXTURE_SLOTS must be in the range 1..8 (default shader samplers)"
+#endif
+
 #ifndef GL_SHADING_LANGUAGE_VERSION
     #define GL_SHADING_LANGUAGE_VERSION         0x8B8C
 #endif
@@ -63,12 +133,127 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
+// Command trace record types
+// NOTE: Every record is the type byte followed by its fixed data (and variable data for some records)
+typedef enum {
+    RLGL_TRACE_FRAME = 1,               // End of frame
+    RLGL_TRACE_MATRIX_MODE,             // int mode
+    RLGL_TRACE_PUSH_MATRIX,
+    RLGL_TRACE_POP_MATRIX,
+    RLGL_TRACE_LOAD_IDENTITY,
+    RLGL_TRACE_TRANSLATE,               // float x, y, z
+    RLGL_TRACE_ROTATE,                  // float angle, x, y, z
+    RLGL_TRACE_SCALE,                   // float x, y, z
+    RLGL_TRACE_MULT_MATRIX,             // float matf[16]
+    RLGL_TRACE_FRUSTUM,                 // double left, right, bottom, top, znear, zfar
+    RLGL_TRACE_ORTHO,                   // double left, right, bottom, top, znear, zfar
+    RLGL_TRACE_VIEWPORT,                // int x, y, width, height
+    RLGL_TRACE_SET_MODELVIEW,           // Matrix view
+    RLGL_TRACE_SET_PROJECTION,          // Matrix projection
+    RLGL_TRACE_BEGIN,                   // int mode
+    RLGL_TRACE_END,
+    RLGL_TRACE_VERTEX,                  // float x, y, z
+    RLGL_TRACE_VERTEX_BULK,             // int positionSize, count, flags + positions, texcoords, colors
+    RLGL_TRACE_TEXCOORD,                // float x, y
+    RLGL_TRACE_NORMAL,                  // float x, y, z
+    RLGL_TRACE_COLOR,                   // unsigned char r, g, b, a
+    RLGL_TRACE_SET_TEXTURE,             // unsigned int id
+    RLGL_TRACE_DRAW_BATCH,
+    RLGL_TRACE_CHECK_LIMIT,             // int vCount
+    RLGL_TRACE_DRAW_SORTING,            // int enabled
+    RLGL_TRACE_DRAW_LAYER,              // int layer, ordered
+    RLGL_TRACE_STATE,                   // int state, enabled
+    RLGL_TRACE_SCISSOR,                 // int x, y, width, height
+    RLGL_TRACE_LINE_WIDTH,              // float width
+    RLGL_TRACE_CLEAR_COLOR,             // unsigned char r, g, b, a
+    RLGL_TRACE_CLEAR_SCREEN,
+    RLGL_TRACE_BLEND_MODE,              // int mode
+    RLGL_TRACE_BLEND_FACTORS,           // int src, dst, equation
+    RLGL_TRACE_LOAD_TEXTURE,            // unsigned int id, int width, height, format, mipmaps, size + data
+    RLGL_TRACE_UPDATE_TEXTURE,          // unsigned int id, int offsetX, offsetY, width, height, format, size + data
+    RLGL_TRACE_UNLOAD_TEXTURE,          // unsigned int id
+    RLGL_TRACE_GEN_MIPMAPS,             // unsigned int id, int width, height, format
+    RLGL_TRACE_TEXTURE_PARAMETERS,      // unsigned int id, int param, value
+    RLGL_TRACE_LOAD_SHADER,             // unsigned int id, int vsSize, fsSize + vsCode, fsCode
+    RLGL_TRACE_UNLOAD_SHADER,           // unsigned int id
+    RLGL_TRACE_SET_SHADER,              // unsigned int id, int locs[RL_MAX_SHADER_LOCATIONS]
+    RLGL_TRACE_ENABLE_SHADER,           // unsigned int id
+    RLGL_TRACE_DISABLE_SHADER,
+    RLGL_TRACE_SET_UNIFORM,             // int location, type, count, size + data
+    RLGL_TRACE_SET_UNIFORM_MATRIX,      // int location, Matrix mat
+    RLGL_TRACE_SET_UNIFORM_SAMPLER,     // int location, unsigned int id
+} rlTraceCommandType;
+
+// Command trace render states (RLGL_TRACE_STATE)
+typedef enum {
+    RLGL_TRACE_STATE_BLEND = 0,
+    RLGL_TRACE_STATE_DEPTH_TEST,
+    RLGL_TRACE_STATE_DEPTH_MASK,
+    RLGL_TRACE_STATE_CULL_FACE,
+    RLGL_TRACE_STATE_SCISSOR_TEST,
+    RLGL_TRACE_STATE_WIRE_MODE,
+    RLGL_TRACE_STATE_SMOOTH_LINES,
+} rlTraceStateType;
+
+// Command trace file header
+typedef struct rlTraceHeader {
+    char signature[4];                  // Trace file signature: "rlTR"
+    int version;                        // Trace format version (RLGL_TRACE_VERSION)
+    int framebufferWidth;               // Default framebuffer width on capture
+    int framebufferHeight;              // Default framebuffer height on capture
+    unsigned int defaultTextureId;      // Default texture id on capture (mapped to default texture on replay)
+    unsigned int defaultShaderId;       // Default shader id on capture (mapped to default shader on replay)
+} rlTraceHeader;
+
+// Command trace replay resource (texture or shader)
+typedef struct rlTraceResource {
+    unsigned int traceId;               // Resource id on capture
+    unsigned int id;                    // Resource id on replay
+    int *locs;                          // Shader locations (shaders only)
+} rlTraceResource;
+
+// Software rasterizer texture, pixels are read back from GPU on first use
+typedef struct rlSoftwareTexture {
+    unsigned int id;                    // Texture id
+    int width;                          // Texture base width
+    int height;                         // Texture base height
+    unsigned char *pixels;              // Texture pixels (RGBA, swizzle applied)
+    int wrapS;                          // Texture wrap mode on s coordinate (OpenGL value)
+    int wrapT;                          // Texture wrap mode on t coordinate (OpenGL value)
+    bool linear;                        // Bilinear filtering (magnification filter, mipmaps are not used)
+} rlSoftwareTexture;
+
+// Software rasterizer vertex (clip space)
+typedef struct rlSoftwareVertex {
+    float x, y, z, w;                   // Vertex position (clip space)
+    float u, v;                         // Vertex texture coordinates
+    float color[4];                     // Vertex color (0..255)
+} rlSoftwareVertex;
+
+// Software rasterizer triangle, setup in window coordinates
+// NOTE: Edge i is the edge opposite to vertex i, its edge function A*x + B*y + C is positive inside the triangle
+typedef struct rlSoftwareTriangle {
+    float edgeA[3];                     // Edge functions x coefficient
+    float edgeB[3];                     // Edge functions y coefficient
+    float edgeC[3];                     // Edge functions constant
+    bool topLeft[3];                    // Edge is a top or left edge (pixel centers exactly on it are covered)
+    float invArea;                      // Inverse of edge functions sum (barycentric coordinates scale)
+    float z[3];                         // Vertex depth (window coordinates)
+    float invW[3];                      // Vertex inverse clip w (perspective correct interpolation)
+    float u[3], v[3];                   // Vertex texture coordinates
+    float color[3][4];                  // Vertex colors (0..255)
+    int texture;                        // Software texture index (-1 for default white texture)
+    int minX, minY, maxX, maxY;         // Pixels bounding box (inclusive, clipped to rasterized area)
+} rlSoftwareTriangle;
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
 
     struct {
         int vertexCounter;                  // Current active render batch vertex counter (generic, used for all batches)
+        unsigned char textureSlot;          // Current draw texture slot (added on glVertex*(), index on draw textureIds[] if textures are folded)
+        int textureFoldVertex;              // Vertex counter when last texture was folded into current draw
         float texcoordx, texcoordy;         // Current active texture coordinate (added on glVertex*())
         float normalx, normaly, normalz;    // Current active normal (added on glVertex*())
         unsigned char colorr, colorg, colorb, colora;   // Current active color (added on glVertex*())
@@ -79,6 +264,8 @@ typedef struct rlglData {
         Matrix projection;                  // Default projection matrix
         Matrix transform;                   // Transform matrix to be used with rlTranslate, rlRotate, rlScale
         bool transformRequired;             // Require transform matrix application to current draw-call vertex (if required)
+        bool transformPending;              // Batch vertex added since transformFirst are still waiting for transform application
+        int transformFirst;                 // First batch vertex of the range pending transform application
         Matrix stack[RL_MAX_MATRIX_STACK_SIZE];// Matrix stack for push/pop
         int stackCounter;                   // Matrix stack counter
 
@@ -86,6 +273,11 @@ typedef struct rlglData {
         unsigned int activeTextureId[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS];    // Active texture ids to be enabled on batch drawing (0 active by default)
         unsigned int defaultVShaderId;      // Default vertex shader id (used by default shader program)
         unsigned int defaultFShaderId;      // Default fragment shader id (used by default shader program)
+        const char *defaultVShaderCode;     // Default vertex shader code (compiled on demand if default program is loaded from shader cache)
+        const char *defaultFShaderCode;     // Default fragment shader code (compiled on demand if default program is loaded from shader cache)
+        unsigned int defaultFShaderTexture0Id;  // Default fragment shader id sampling texture0 only (used by custom vertex shader programs)
+        const char *defaultFShaderTexture0Code; // Default fragment shader code sampling texture0 only (no fragTexSlot input, compiled on demand)
+        char shaderCachePath[512];          // Shader program binaries cache directory (empty if disabled)
         unsigned int defaultShaderId;       // Default shader program id, supports vertex color and diffuse texture
         int *defaultShaderLocs;             // Default shader locations pointer to be used on rendering
         unsigned int currentShaderId;       // Current shader id to be used on rendering (by default, defaultShaderId)
@@ -102,6 +294,18 @@ typedef struct rlglData {
 
         int framebufferWidth;               // Default framebuffer width
         int framebufferHeight;              // Default framebuffer height
+        unsigned int defaultFramebufferId;  // Default framebuffer id (0 = window framebuffer, fbo on headless rendering)
+
+        rlRenderBatchStats batchStats;      // Render batch flush/wait statistics (reset once per frame)
+
+        unsigned int cameraBufferId;        // Camera matrices uniform buffer (RL_DEFAULT_CAMERA_UNIFORM_BINDING)
+        float cameraMatrices[32];           // Camera matrices last uploaded (view, projection)
+        bool cameraBufferValid;             // Camera matrices buffer contains cameraMatrices
+        unsigned int drawIndirectBufferId;  // Draw commands buffer used by rlDrawVertexArrayElementsMulti()
+
+        bool drawSorting;                   // Sort batch draws by layer, texture and mode before drawing
+        int drawLayer;                      // Layer assigned to new batch draws
+        bool drawLayerOrdered;              // New batch draws keep submission order inside their layer
 
     } State;            // Renderer state
     struct {
@@ -119,11 +323,118 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Immutable buffer storage and persistent mapping support (GL_ARB_buffer_storage)
+        bool baseInstance;                  // Draw commands base instance support (OpenGL 4.2)
+        bool multiDrawIndirect;             // Multiple indirect draws in a single call support (GL_ARB_multi_draw_indirect)
+        bool programBinary;                 // Program binaries retrieval and loading support (GL_ARB_get_program_binary)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+    struct {
+        bool active;                        // Display list recording active, batch draws are captured instead of drawn
+        rlBatchVertex *vertices;            // Captured vertex data (interleaved layout)
+        int vertexCount;                    // Captured vertex count
+        int vertexCapacity;                 // Captured vertex array capacity
+        unsigned int *indices;              // Captured indices (quads converted to triangles)
+        int indexCount;                     // Captured index count
+        int indexCapacity;                  // Captured index array capacity
+        rlDisplayListDraw *draws;           // Captured draws
+        int drawCount;                      // Captured draw count
+        int drawCapacity;                   // Captured draws array capacity
+
+    } Record;           // Display list recording data
+    struct {
+        unsigned int shaderId;              // Shader program in use
+        unsigned int textureSlot;           // Active texture slot
+        unsigned int textureId[RLGL_CACHE_TEXTURE_SLOTS];   // Texture 2D bound on every slot
+        unsigned int cubemapId[RLGL_CACHE_TEXTURE_SLOTS];   // Texture cubemap bound on every slot
+        unsigned int vaoId;                 // Vertex array bound
+        unsigned int vboId;                 // Vertex buffer bound (GL_ARRAY_BUFFER)
+        unsigned int eboId;                 // Element buffer bound (GL_ELEMENT_ARRAY_BUFFER, part of VAO state)
+        unsigned int blend;                 // Color blending enabled
+        unsigned int depthTest;             // Depth test enabled
+        unsigned int depthMask;             // Depth write enabled
+        unsigned int cullFace;              // Backface culling enabled
+        unsigned int scissorTest;           // Scissor test enabled
+        unsigned int blendSrcFactor;        // Blending source factor
+        unsigned int blendDstFactor;        // Blending destination factor
+        unsigned int blendEquation;         // Blending equation
+
+        rlStateCacheStats stats;            // Issued/skipped state changes (reset once per frame)
+    } Cache;            // GL state cache, shadow copy of OpenGL state set by rlgl (RLGL_CACHE_UNKNOWN if not known)
+    struct {
+        bool enabled;                       // GPU profiling zones enabled
+        unsigned int *queries;              // Timestamp queries, begin/end pairs for every frame in flight
+        int zoneIds[RL_GPU_ZONE_FRAMES][RL_MAX_GPU_ZONE_QUERIES];  // Zone measured by every queries pair
+        int queryCount[RL_GPU_ZONE_FRAMES]; // Queries pairs used on every frame in flight
+        unsigned int lastQuery[RL_GPU_ZONE_FRAMES]; // Last query issued on every frame in flight
+        int frame;                          // Frame in flight being recorded
+        int stack[RLGL_MAX_GPU_ZONE_DEPTH]; // Begun zones queries pairs (-1 if not measured)
+        int depth;                          // Begun zones count
+        rlGpuZone zones[RL_MAX_GPU_ZONES];  // Zones names and results of last completed frame
+        int zoneCount;                      // Zones count
+    } Profiler;         // GPU profiling zones data
+    struct {
+        FILE *file;                         // Trace file being captured (NULL if capture not active)
+        int suspended;                      // Capture suspended, commands issued internally by other commands are not traced
+        unsigned int *textureIds;           // Textures available on trace (loaded while capturing or captured on first use)
+        int textureCount;                   // Textures available on trace count
+        int textureCapacity;                // Textures available on trace array capacity
+        int frameCount;                     // Frames captured
+    } Trace;            // Command trace capture data
+    struct {
+        bool enabled;                       // Software rasterizer enabled, batch draws are rasterized on CPU instead of drawn
+        int width;                          // Software buffers width
+        int height;                         // Software buffers height
+        unsigned char *color;               // Color buffer (RGBA, bottom-up rows as OpenGL framebuffer)
+        float *depth;                       // Depth buffer (window depth, cleared to 1.0f)
+        int threadCount;                    // Rasterizer threads (rendering thread included)
+        int viewport[4];                    // Current viewport (x, y, width, height), tracked while disabled too
+        int scissor[4];                     // Current scissor area (x, y, width, height), tracked while disabled too
+        unsigned char clearColor[4];        // Current clear color, tracked while disabled too
+        float lineWidth;                    // Current line width, tracked while disabled too (0 = default)
+
+        rlSoftwareTexture *textures;        // Textures read back from GPU
+        int textureCount;                   // Textures read back count
+        int textureCapacity;                // Textures read back array capacity
+        rlSoftwareVertex *vertices;         // Batch vertex transformed to clip space
+        int vertexCapacity;                 // Batch vertex array capacity
+        rlSoftwareTriangle *triangles;      // Triangles setup for rasterization
+        int triangleCount;                  // Triangles setup count
+        int triangleCapacity;               // Triangles array capacity
+        int tilesX;                         // Screen tiles on x
+        int tilesY;                         // Screen tiles on y
+        int *binOffsets;                    // Tile bins first triangle reference (tiles count + 1)
+        int *binCursors;                    // Tile bins fill cursors (tiles count)
+        int *binTriangles;                  // Tile bins triangle references (submission order inside every bin)
+        int binCapacity;                    // Tile bins triangle references array capacity
+        volatile int nextTile;              // Next tile to be rasterized by any thread
+
+        int workerCount;                    // Worker threads started (threadCount - 1, unless some could not be started)
+        volatile bool workersQuit;          // Worker threads must exit (software rasterizer disabled)
+#if defined(_WIN32)
+        void *workers[RLGL_SOFTWARE_MAX_THREADS];   // Worker threads handles
+        void *workStart;                    // Semaphore released once by worker woken for a flush
+        void *workDone;                     // Semaphore released by every woken worker when no tile is left
+#else
+        pthread_t workers[RLGL_SOFTWARE_MAX_THREADS];   // Worker threads
+        pthread_mutex_t workMutex;          // Protects workPending and workDoneCount
+        pthread_cond_t workStartCond;       // Signaled when work is pending (or workers must exit)
+        pthread_cond_t workDoneCond;        // Signaled when a woken worker is done
+        int workPending;                    // Workers to be woken for current flush
+        int workDoneCount;                  // Woken workers done for current flush
+#endif
+
+        int clipRect[4];                    // Rasterized area (min x, min y, max x, max y, inclusive), viewport and scissor
+        bool depthTest;                     // Depth test enabled (GL_LEQUAL)
+        bool depthMask;                     // Depth write enabled
+        bool blend;                         // Color blending enabled
+        int blendSrcFactor;                 // Blending source factor (OpenGL value)
+        int blendDstFactor;                 // Blending destination factor (OpenGL value)
+        int blendEquation;                  // Blending equation (OpenGL value)
+    } Software;         // Software rasterizer data
 } rlglData;
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
@@ -131,14 +442,96 @@ typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-static rlglData RLGL = { 0 };
+static rlglData rlglDefaultContext = { 0 };     // Default rlgl context (initialized by rlglInit() on InitGraph())
+static RLGL_THREAD_LOCAL rlglData *rlglCurrentContext = &rlglDefaultContext;    // rlgl context current on calling thread
+static RLGL_THREAD_LOCAL rlCommandBuffer *threadCommandBuffer = NULL;   // Command buffer recording on calling thread (NULL if not recording)
+
+#define RLGL (*rlglCurrentContext)      // Current rlgl context data
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static unsigned int rlLoadShaderProgramCache(const char *vsCode, const char *fsCode, unsigned long long *hash);  // Load shader program binary from shader cache (0 if not available)
+static void rlSaveShaderProgramCache(unsigned int id, unsigned long long hash);   // Save shader program binary to shader cache
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
+static void *rlLoadBatchVertexBuffer(unsigned int *id, const void *data, int size); // Load and bind a render batch vertex buffer
+static void rlSetBatchVertexAttributes(rlVertexBuffer *buffer);     // Bind render batch vertex buffers to shader attributes
+static void rlSetInterleavedVertexAttributes(unsigned int vboId);   // Bind interleaved vertex buffer to shader attributes
+static void rlVertexBulk(const float *positions, int positionSize, const float *texcoords, const unsigned char *colors, int count); // Add multiple vertex to current batch
+static void rlApplyPendingTransform(void);  // Transform batch vertex added under current transform matrix
+static bool rlGrowRenderBatch(int vertexCount);    // Grow current batch buffer to fit vertex count (if limit allows it)
+static void rlResizeBatchVertexBuffer(rlVertexBuffer *buffer, int elementCount);   // Resize batch vertex buffer, CPU data is kept
+static void rlRecordRenderBatch(rlRenderBatch *batch);    // Capture batch vertex data and draws into current display list recording
+static void rlNextDrawCall(void);           // Close current batch draw call (if not empty) and setup next one
+static int rlCompareDrawCalls(const void *a, const void *b);   // Compare batch draw calls for sorted drawing (qsort() callback)
+static int rlGetBatchTextureSlotUnit(int slot);     // Get texture unit of a render batch texture slot
+static void rlCommandBufferVertex(rlCommandBuffer *buffer, float x, float y, float z, const float *texcoord, const unsigned char *color);  // Add vertex to command buffer
+static rlDrawCall *rlCommandBufferNextDraw(rlCommandBuffer *buffer);    // Close command buffer draw (if not empty) and setup next one
+static void rlTraceCommand(int type, const void *data, int size);  // Write command trace record (type and fixed data)
+static void rlTraceData(const void *data, int size);        // Write command trace record variable data
+static void rlTraceTexture(unsigned int id);        // Write texture to command trace if not available yet (captured from GPU)
+static void rlTraceLoadTexture(unsigned int id, int width, int height, int format, int mipmaps, const void *data, int size);   // Write texture load to command trace
+static void rlTraceLoadShader(unsigned int id, const char *vsCode, const char *fsCode);     // Write shader load to command trace
+static void rlTraceState(int state, bool enabled);  // Write render state change to command trace
+static void rlTraceUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data);   // Write texture update to command trace
+static bool rlTraceRead(const unsigned char **data, const unsigned char *end, void *dst, int size);    // Read command trace record data (4 bytes aligned)
+static int rlTraceTextureDataSize(int width, int height, int format, int mipmaps);  // Get texture data size expected on command trace (-1 if parameters not valid)
+static int rlTraceUniformDataSize(int uniformType, int count);  // Get uniform data size expected on command trace (-1 if parameters not valid)
+static rlTraceResource *rlTraceGetResource(rlTraceResource *resources, int count, unsigned int traceId); // Get replay resource by capture id (NULL if not loaded)
+static unsigned char *rlReadTextureRGBA(unsigned int id, int *width, int *height, int *params);    // Read texture base level as RGBA with swizzle applied (params: wrap s/t, mag/min filters)
+static void rlSoftwareRenderBatch(rlRenderBatch *batch);    // Rasterize render batch draws into software buffers
+static int rlSoftwareGetTexture(unsigned int id);           // Get software texture index, pixels read back on first use (-1 for default texture)
+static void rlSoftwareReleaseTexture(unsigned int id);      // Release software texture copy (texture updated or unloaded)
+static void rlSoftwareClipRect(int *rect, const int *area); // Intersect pixels rect (min x, min y, max x, max y) with area (x, y, width, height)
+static void rlSoftwareClipTriangle(const rlSoftwareVertex *v0, const rlSoftwareVertex *v1, const rlSoftwareVertex *v2, int texture, bool cull);  // Clip triangle against near/far planes and setup it
+static void rlSoftwareClipLine(const rlSoftwareVertex *v0, const rlSoftwareVertex *v1, int texture);  // Clip line against near/far planes and setup it as two triangles
+static void rlSoftwareSetupTriangle(const rlSoftwareVertex *v0, const rlSoftwareVertex *v1, const rlSoftwareVertex *v2, int texture, bool cull);  // Setup triangle (window coordinates) for rasterization
+static void rlSoftwareRasterize(void);      // Bin setup triangles into tiles and rasterize tiles on rasterizer threads
+static void rlSoftwareRasterizeTiles(void); // Rasterize tiles until no tile left (run by every rasterizer thread)
+static void rlSoftwareStartWorkers(void);   // Start rasterizer worker threads, parked until a flush wakes them
+static void rlSoftwareStopWorkers(void);    // Stop rasterizer worker threads and wait for them
+static int rlSoftwareCoverage(const rlSoftwareTriangle *triangle, const float *rowEdges, int x, float edges[3][4]);    // Get pixels x..x + 3 coverage mask and edge functions values
+static void rlSoftwareShadePixel(const rlSoftwareTriangle *triangle, int x, int y, float e0, float e1, float e2);       // Shade covered pixel: depth test, texture sampling, blending
+static void rlSoftwareSampleTexture(const rlSoftwareTexture *texture, float u, float v, float *texel);  // Sample software texture (nearest or bilinear)
+static void rlSoftwareBlendFactors(int factor, const float *src, const float *dst, float *factors);    // Get blending factor values for every color channel
+#if defined(_WIN32)
+static unsigned __stdcall rlSoftwareWorker(void *arg);      // Rasterizer worker thread
+#else
+static void *rlSoftwareWorker(void *arg);   // Rasterizer worker thread
+#endif
+static void rlCacheUseProgram(unsigned int id);             // Use shader program (filtered by GL state cache)
+static void rlCacheActiveTexture(unsigned int slot);        // Select active texture slot (filtered by GL state cache)
+static void rlCacheBindTexture(unsigned int target, unsigned int id);   // Bind texture 2D or cubemap on active slot (filtered by GL state cache)
+static void rlCacheBindVertexArray(unsigned int id);        // Bind vertex array (filtered by GL state cache)
+static void rlCacheBindBuffer(unsigned int target, unsigned int id);    // Bind vertex or element buffer (filtered by GL state cache)
+static void rlCacheCapability(unsigned int cap, bool enabled);  // Enable/disable OpenGL capability (filtered by GL state cache)
+static void rlCacheDepthMask(bool enabled);                 // Enable/disable depth write (filtered by GL state cache)
+static void rlCacheBlendFunction(unsigned int src, unsigned int dst, unsigned int equation);  // Set blending function (filtered by GL state cache)
+static void rlCacheDeleteTextures(int count, const unsigned int *ids);      // Delete textures, cached bindings are cleared
+static void rlCacheDeleteBuffers(int count, const unsigned int *ids);       // Delete buffers, cached bindings are cleared
+static void rlCacheDeleteVertexArrays(int count, const unsigned int *ids);  // Delete vertex arrays, cached bindings are cleared
+static void rlTransformVertexScalar(float *positions, int stride, int count, const Matrix *mat);    // Transform positions, scalar fallback
+#if defined(RLGL_SIMD_SSE2)
+static void rlTransformVertexSSE2(float *positions, int stride, int count, const Matrix *mat);      // Transform positions, 4 vertex per step
+#endif
+#if defined(RLGL_SIMD_AVX2)
+static bool rlCpuSupportsAVX2(void);        // Check AVX2 support on current CPU and OS
+RLGL_TARGET_AVX2 static void rlTransformVertexAVX2(float *positions, int stride, int count, const Matrix *mat);  // Transform positions, 8 vertex per step
+#endif
+#if defined(RLGL_SIMD_NEON)
+static void rlTransformVertexNEON(float *positions, int stride, int count, const Matrix *mat);      // Transform positions, 4 vertex per step
+#endif
+
+// Batch vertex transform kernel, upgraded on rlglInit() depending on CPU support
+#if defined(RLGL_SIMD_SSE2)
+static void (*rlTransformVertex)(float *positions, int stride, int count, const Matrix *mat) = rlTransformVertexSSE2;
+#elif defined(RLGL_SIMD_NEON)
+static void (*rlTransformVertex)(float *positions, int stride, int count, const Matrix *mat) = rlTransformVertexNEON;
+#else
+static void (*rlTransformVertex)(float *positions, int stride, int count, const Matrix *mat) = rlTransformVertexScalar;
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Matrix operations
@@ -147,6 +540,8 @@ static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel
 // Choose the current matrix to be transformed
 void rlMatrixMode(int mode)
 {
+    if (threadCommandBuffer != NULL) return;    // Command buffers only record modelview transforms
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_MATRIX_MODE, &mode, sizeof(int));
     if (mode == RL_PROJECTION) RLGL.State.currentMatrix = &RLGL.State.projection;
     else if (mode == RL_MODELVIEW) RLGL.State.currentMatrix = &RLGL.State.modelview;
     RLGL.State.currentMatrixMode = mode;
@@ -155,6 +550,15 @@ void rlMatrixMode(int mode)
 // Push the current matrix into RLGL.State.stack
 void rlPushMatrix(void)
 {
+    rlCommandBuffer *cmd = threadCommandBuffer;
+    if (cmd != NULL)
+    {
+        if (cmd->stackCounter < RL_MAX_MATRIX_STACK_SIZE) cmd->stack[cmd->stackCounter++] = cmd->transform;
+        else TRACELOG(LOG_ERROR, "RLGL: Command buffer matrix stack overflow (RL_MAX_MATRIX_STACK_SIZE)");
+        return;
+    }
+
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_PUSH_MATRIX, NULL, 0);
     if (RLGL.State.stackCounter >= RL_MAX_MATRIX_STACK_SIZE)
         TRACELOG(LOG_ERROR, "RLGL: Matrix stack overflow (RL_MAX_MATRIX_STACK_SIZE)");
     if (RLGL.State.currentMatrixMode == RL_MODELVIEW) {
@@ -168,6 +572,15 @@ void rlPushMatrix(void)
 // Pop lattest inserted matrix from RLGL.State.stack
 void rlPopMatrix(void)
 {
+    rlCommandBuffer *cmd = threadCommandBuffer;
+    if (cmd != NULL)
+    {
+        if (cmd->stackCounter > 0) cmd->transform = cmd->stack[--cmd->stackCounter];
+        return;
+    }
+
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_POP_MATRIX, NULL, 0);
+    rlApplyPendingTransform();
     if (RLGL.State.stackCounter > 0) {
         Matrix mat = RLGL.State.stack[RLGL.State.stackCounter - 1];
         *RLGL.State.currentMatrix = mat;
@@ -181,18 +594,38 @@ void rlPopMatrix(void)
 
 // Reset current matrix to identity matrix
 void rlLoadIdentity(void) {
+    if (threadCommandBuffer != NULL)
+    {
+        threadCommandBuffer->transform = MatrixIdentity();
+        threadCommandBuffer->transformRequired = false;
+        return;
+    }
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_LOAD_IDENTITY, NULL, 0);
+    rlApplyPendingTransform();
     *RLGL.State.currentMatrix = MatrixIdentity();
 }
 // Multiply the current matrix by a translation matrix
 void rlTranslatef(float x, float y, float z) {
+    rlCommandBuffer *cmd = threadCommandBuffer;
+    if (cmd != NULL) { cmd->transform = MatrixMultiply(MatrixTranslate(x, y, z), cmd->transform); cmd->transformRequired = true; return; }
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_TRANSLATE, (float[3]){ x, y, z }, 3*sizeof(float));
+    rlApplyPendingTransform();
     *RLGL.State.currentMatrix = MatrixMultiply(MatrixTranslate(x, y, z), *RLGL.State.currentMatrix);
 }
 // Multiply the current matrix by a rotation matrix
 void rlRotatef(float angle, float x, float y, float z) {
+    rlCommandBuffer *cmd = threadCommandBuffer;
+    if (cmd != NULL) { cmd->transform = MatrixMultiply(MatrixRotate((Vector3){x, y, z}, angle), cmd->transform); cmd->transformRequired = true; return; }
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_ROTATE, (float[4]){ angle, x, y, z }, 4*sizeof(float));
+    rlApplyPendingTransform();
     *RLGL.State.currentMatrix = MatrixMultiply(MatrixRotate((Vector3){x, y, z}, angle), *RLGL.State.currentMatrix);
 }
 // Multiply the current matrix by a scaling matrix
 void rlScalef(float x, float y, float z) {
+    rlCommandBuffer *cmd = threadCommandBuffer;
+    if (cmd != NULL) { cmd->transform = MatrixMultiply(MatrixScale(x, y, z), cmd->transform); cmd->transformRequired = true; return; }
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_SCALE, (float[3]){ x, y, z }, 3*sizeof(float));
+    rlApplyPendingTransform();
     *RLGL.State.currentMatrix = MatrixMultiply(MatrixScale(x, y, z), *RLGL.State.currentMatrix);
 }
 // Multiply the current matrix by another matrix
@@ -203,12 +636,22 @@ void rlMultMatrixf(float *matf)
                    matf[1], matf[5], matf[9], matf[13],
                    matf[2], matf[6], matf[10], matf[14],
                    matf[3], matf[7], matf[11], matf[15] };
+
+    rlCommandBuffer *cmd = threadCommandBuffer;
+    if (cmd != NULL) { cmd->transform = MatrixMultiply(cmd->transform, mat); cmd->transformRequired = true; return; }
+
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_MULT_MATRIX, matf, 16*sizeof(float));
+
+    rlApplyPendingTransform();
     *RLGL.State.currentMatrix = MatrixMultiply(*RLGL.State.currentMatrix, mat);
 }
 
 // Multiply the current matrix by a perspective matrix generated by parameters
 void rlFrustum(double left, double right, double bottom, double top, double znear, double zfar)
 {
+    if (threadCommandBuffer != NULL) return;    // Command buffers only record modelview transforms
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_FRUSTUM, (double[6]){ left, right, bottom, top, znear, zfar }, 6*sizeof(double));
+
     Matrix matFrustum = { 0 };
 
     float rl = (float)(right - left);
@@ -235,12 +678,16 @@ void rlFrustum(double left, double right, double bottom, double top, double znea
     matFrustum.m14 = -((float)zfar*(float)znear*2.0f)/fn;
     matFrustum.m15 = 0.0f;
 
+    rlApplyPendingTransform();
     *RLGL.State.currentMatrix = MatrixMultiply(*RLGL.State.currentMatrix, matFrustum);
 }
 
 // Multiply the current matrix by an orthographic matrix generated by parameters
 void rlOrtho(double left, double right, double bottom, double top, double znear, double zfar)
 {
+    if (threadCommandBuffer != NULL) return;    // Command buffers only record modelview transforms
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_ORTHO, (double[6]){ left, right, bottom, top, znear, zfar }, 6*sizeof(double));
+
     // NOTE: If left-right and top-botton values are equal it could create a division by zero,
     // response to it is platform/compiler dependant
     Matrix matOrtho = { 0 };
@@ -263,11 +710,18 @@ void rlOrtho(double left, double right, double bottom, double top, double znear,
     matOrtho.m13 = -((float)top + (float)bottom)/tb;
     matOrtho.m14 = -((float)zfar + (float)znear)/fn;
     matOrtho.m15 = 1.0f;
+    rlApplyPendingTransform();
     *RLGL.State.currentMatrix = MatrixMultiply(*RLGL.State.currentMatrix, matOrtho);
 }
 
 // Set the viewport area (transformation from normalized device coordinates to window coordinates)
 void rlViewport(int x, int y, int width, int height) {
+    if (threadCommandBuffer != NULL) return;
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_VIEWPORT, (int[4]){ x, y, width, height }, 4*sizeof(int));
+    RLGL.Software.viewport[0] = x;
+    RLGL.Software.viewport[1] = y;
+    RLGL.Software.viewport[2] = width;
+    RLGL.Software.viewport[3] = height;
     glViewport(x, y, width, height);
 }
 
@@ -277,33 +731,48 @@ void rlViewport(int x, int y, int width, int height) {
 // Initialize drawing mode (how to organize vertex)
 void rlBegin(int mode)
 {
+    rlCommandBuffer *cmd = threadCommandBuffer;
+    if (cmd != NULL)
+    {
+        if ((cmd->drawCount > 0) && (cmd->draws[cmd->drawCount - 1].mode == mode)) return;
+
+        // Empty draw is reused, texture set by rlSetTexture() just before rlBegin() is kept
+        unsigned int textureId = RLGL.State.defaultTextureId;
+        if ((cmd->drawCount > 0) && (cmd->draws[cmd->drawCount - 1].vertexCount == 0)) textureId = cmd->draws[cmd->drawCount - 1].textureId;
+
+        rlDrawCall *draw = rlCommandBufferNextDraw(cmd);
+        draw->mode = mode;
+        draw->textureId = textureId;
+        return;
+    }
+
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_BEGIN, &mode, sizeof(int));
+
     // Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
     // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
-    if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == mode) return;
-    if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0) {
-        // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
-        // that way, following QUADS drawing will keep aligned with index processing
-        // It implies adding some extra alignment vertex at the end of the draw,
-        // those vertex are not processed but they are considered as an additional offset
-        // for the next set of vertex to be drawn
-        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_LINES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount : RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4);
-        else if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_TRIANGLES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4)));
-        else RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = 0;
-        if (!rlCheckRenderBatchLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment)) {
-            RLGL.State.vertexCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment;
-            RLGL.currentBatch->drawCounter++;
-        }
-    }
-    if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
-        rlDrawRenderBatch(RLGL.currentBatch);
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+    if (draw->mode == mode) return;
+
+    // Empty draw is reused, texture set by rlSetTexture() just before rlBegin() is kept
+    // NOTE: Texture could also be folded into current draw after its last vertex, it is kept as well
+    // NOTE: Texture was reset to default one before, rlSetTexture(id); rlBegin(mode) lost the texture when mode changed,
+    // callers drawing untextured vertex must call rlSetTexture(0) after their textured draws (as raylib modules do)
+    bool textureSet = (draw->vertexCount == 0) || ((draw->textureCount > 0) && (RLGL.State.textureFoldVertex == RLGL.State.vertexCounter));
+    unsigned int textureId = textureSet? draw->textureId : RLGL.State.defaultTextureId;
+
+    rlNextDrawCall();
     RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
     RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
-    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = textureId;
 }
 
 // Finish vertex providing
 void rlEnd(void)
 {
+    if (threadCommandBuffer != NULL) { threadCommandBuffer->currentDepth += (1.0f/20000.0f); return; }
+
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_END, NULL, 0);
+
     // NOTE: Depth increment is dependant on rlOrtho(): z-near and z-far values,
     // as well as depth buffer bit-depth (16bit or 24bit or 32bit)
     // Correct increment formula would be: depthInc = (zfar - znear)/pow(2, bits)
@@ -311,53 +780,80 @@ void rlEnd(void)
 
     // Verify internal buffers limits
     // NOTE: This check is combined with usage of rlCheckRenderBatchLimit()
-    if (RLGL.State.vertexCounter >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4 - 4))
+    // NOTE: Buffer is grown if RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS allows it, no draw is forced in that case
+    if ((RLGL.State.vertexCounter >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4 - 4)) &&
+        !rlGrowRenderBatch(RLGL.State.vertexCounter + 4 + 1))
     {
         // WARNING: If we are between rlPushMatrix() and rlPopMatrix() and we need to force a rlDrawRenderBatch(),
         // we need to call rlPopMatrix() before to recover *RLGL.State.currentMatrix (RLGL.State.modelview) for the next forced draw call!
         // If we have multiple matrix pushed, it will require "RLGL.State.stackCounter" pops before launching the draw
+        RLGL.Trace.suspended++;
         for (int i = RLGL.State.stackCounter; i >= 0; i--) rlPopMatrix();
         rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.Trace.suspended--;
     }
 }
 
 // Define one vertex (position)
 // NOTE: Vertex position data is the basic information required for drawing
+// If transform is required, vertex is stored untransformed and the full range is transformed
+// at once when transform matrix changes or batch is drawn (see rlApplyPendingTransform())
 void rlVertex3f(float x, float y, float z)
 {
-    float tx = x;
-    float ty = y;
-    float tz = z;
+    rlCommandBuffer *cmd = threadCommandBuffer;
+    if (cmd != NULL) { rlCommandBufferVertex(cmd, x, y, z, cmd->texcoord, cmd->color); return; }
 
-    // Transform provided vector if required
-    if (RLGL.State.transformRequired)
-    {
-        tx = RLGL.State.transform.m0*x + RLGL.State.transform.m4*y + RLGL.State.transform.m8*z + RLGL.State.transform.m12;
-        ty = RLGL.State.transform.m1*x + RLGL.State.transform.m5*y + RLGL.State.transform.m9*z + RLGL.State.transform.m13;
-        tz = RLGL.State.transform.m2*x + RLGL.State.transform.m6*y + RLGL.State.transform.m10*z + RLGL.State.transform.m14;
-    }
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_VERTEX, (float[3]){ x, y, z }, 3*sizeof(float));
+
+    rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
 
-    // Verify that current vertex buffer elements limit has not been reached
-    if (RLGL.State.vertexCounter < (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
+    // Verify that current vertex buffer elements limit has not been reached (or buffer can grow)
+    if ((RLGL.State.vertexCounter < (buffer->elementCount*4)) || rlGrowRenderBatch(RLGL.State.vertexCounter + 1))
     {
-        // Add vertices
-        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
-        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
-        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 2] = tz;
+        if (RLGL.State.transformRequired && !RLGL.State.transformPending)
+        {
+            RLGL.State.transformPending = true;
+            RLGL.State.transformFirst = RLGL.State.vertexCounter;
+        }
+
+        if (buffer->vertexData != NULL)
+        {
+            // Add vertex position, texcoord and color in one go (interleaved layout)
+            rlBatchVertex *vertex = &buffer->vertexData[RLGL.State.vertexCounter];
+            vertex->x = x;
+            vertex->y = y;
+            vertex->z = z;
+            vertex->u = RLGL.State.texcoordx;
+            vertex->v = RLGL.State.texcoordy;
+            vertex->r = RLGL.State.colorr;
+            vertex->g = RLGL.State.colorg;
+            vertex->b = RLGL.State.colorb;
+            vertex->a = RLGL.State.colora;
+        }
+        else
+        {
+            // Add vertices
+            buffer->vertices[3*RLGL.State.vertexCounter] = x;
+            buffer->vertices[3*RLGL.State.vertexCounter + 1] = y;
+            buffer->vertices[3*RLGL.State.vertexCounter + 2] = z;
+
+            // Add current texcoord
+            buffer->texcoords[2*RLGL.State.vertexCounter] = RLGL.State.texcoordx;
+            buffer->texcoords[2*RLGL.State.vertexCounter + 1] = RLGL.State.texcoordy;
+
+            // Add current color
+            buffer->colors[4*RLGL.State.vertexCounter] = RLGL.State.colorr;
+            buffer->colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
+            buffer->colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
+            buffer->colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
+        }
 
-        // Add current texcoord
-        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter] = RLGL.State.texcoordx;
-        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter + 1] = RLGL.State.texcoordy;
+        // Add current texture slot (folded draw textures)
+        buffer->textureSlots[RLGL.State.vertexCounter] = RLGL.State.textureSlot;
 
         // TODO: Add current normal
         // By default rlVertexBuffer type does not store normals
 
-        // Add current color
-        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter] = RLGL.State.colorr;
-        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
-        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
-        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
-
         RLGL.State.vertexCounter++;
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
@@ -368,19 +864,33 @@ void rlVertex3f(float x, float y, float z)
 // Define one vertex (position)
 void rlVertex2f(float x, float y)
 {
-    rlVertex3f(x, y, RLGL.currentBatch->currentDepth);
+    rlVertex3f(x, y, (threadCommandBuffer != NULL)? threadCommandBuffer->currentDepth : RLGL.currentBatch->currentDepth);
 }
 
 // Define one vertex (position)
 void rlVertex2i(int x, int y)
 {
-    rlVertex3f((float)x, (float)y, RLGL.currentBatch->currentDepth);
+    rlVertex3f((float)x, (float)y, (threadCommandBuffer != NULL)? threadCommandBuffer->currentDepth : RLGL.currentBatch->currentDepth);
+}
+
+// Define multiple vertex (position XY), z is set to current depth
+void rlVertexBulk2f(const float *positions, const float *texcoords, const unsigned char *colors, int count)
+{
+    rlVertexBulk(positions, 2, texcoords, colors, count);
+}
+
+// Define multiple vertex (position XYZ)
+void rlVertexBulk3f(const float *positions, const float *texcoords, const unsigned char *colors, int count)
+{
+    rlVertexBulk(positions, 3, texcoords, colors, count);
 }
 
 // Define one vertex (texture coordinate)
 // NOTE: Texture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
 {
+    if (threadCommandBuffer != NULL) { threadCommandBuffer->texcoord[0] = x; threadCommandBuffer->texcoord[1] = y; return; }
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_TEXCOORD, (float[2]){ x, y }, 2*sizeof(float));
     RLGL.State.texcoordx = x;
     RLGL.State.texcoordy = y;
 }
@@ -389,6 +899,8 @@ void rlTexCoord2f(float x, float y)
 // NOTE: Normals limited to TRIANGLES only?
 void rlNormal3f(float x, float y, float z)
 {
+    if (threadCommandBuffer != NULL) return;    // Normals are not stored by render batch
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_NORMAL, (float[3]){ x, y, z }, 3*sizeof(float));
     RLGL.State.normalx = x;
     RLGL.State.normaly = y;
     RLGL.State.normalz = z;
@@ -397,6 +909,9 @@ void rlNormal3f(float x, float y, float z)
 // Define one vertex (color)
 void rlColor4ub(unsigned char x, unsigned char y, unsigned char z, unsigned char w)
 {
+    rlCommandBuffer *cmd = threadCommandBuffer;
+    if (cmd != NULL) { cmd->color[0] = x; cmd->color[1] = y; cmd->color[2] = z; cmd->color[3] = w; return; }
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_COLOR, (unsigned char[4]){ x, y, z, w }, 4);
     RLGL.State.colorr = x;
     RLGL.State.colorg = y;
     RLGL.State.colorb = z;
@@ -422,6 +937,23 @@ void rlColor3f(float x, float y, float z)
 // Set current texture to use
 void rlSetTexture(unsigned int id)
 {
+    rlCommandBuffer *cmd = threadCommandBuffer;
+    if (cmd != NULL)
+    {
+        if ((id == 0) || ((cmd->drawCount > 0) && (cmd->draws[cmd->drawCount - 1].textureId == id))) return;
+        int mode = (cmd->drawCount > 0)? cmd->draws[cmd->drawCount - 1].mode : RL_QUADS;
+        rlDrawCall *draw = rlCommandBufferNextDraw(cmd);
+        draw->mode = mode;
+        draw->textureId = id;
+        return;
+    }
+
+    if (RLGL_TRACE_ACTIVE)
+    {
+        rlTraceTexture(id);
+        rlTraceCommand(RLGL_TRACE_SET_TEXTURE, &id, sizeof(unsigned int));
+    }
+
     if (id == 0) {
         // NOTE: If quads batch limit is reached, we force a draw call and next batch starts
         if (RLGL.State.vertexCounter >=
@@ -430,26 +962,33 @@ void rlSetTexture(unsigned int id)
             rlDrawRenderBatch(RLGL.currentBatch);
         }
     } else {
-        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id) {
-            if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0) {
-                // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
-                // that way, following QUADS drawing will keep aligned with index processing
-                // It implies adding some extra alignment vertex at the end of the draw,
-                // those vertex are not processed but they are considered as an additional offset
-                // for the next set of vertex to be drawn
-                if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_LINES)
-                    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount : RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4);
-                else if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_TRIANGLES)
-                    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4)));
-                else
-                    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = 0;
+        rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+        if (draw->textureId != id) {
+            // Default shader selects texture by vertex slot, texture switches are folded into current draw
+            // while its textures fit in the slots (display list recording and software rasterizer use one texture by draw)
+            if ((draw->vertexCount > 0) && (RL_DEFAULT_BATCH_TEXTURE_SLOTS > 1) && (RLGL.State.currentShaderId == RLGL.State.defaultShaderId) &&
+                !RLGL.Record.active && !RLGL.Software.enabled)
+            {
+                if (draw->textureCount == 0)
+                {
+                    draw->textureIds[0] = draw->textureId;
+                    draw->textureCount = 1;
+                }
 
-                if (!rlCheckRenderBatchLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment)) {
-                    RLGL.State.vertexCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment;
-                    RLGL.currentBatch->drawCounter++;
+                int slot = 0;
+                while ((slot < draw->textureCount) && (draw->textureIds[slot] != id)) slot++;
+
+                if (slot < RL_DEFAULT_BATCH_TEXTURE_SLOTS)
+                {
+                    if (slot == draw->textureCount) draw->textureIds[draw->textureCount++] = id;
+                    draw->textureId = id;
+                    RLGL.State.textureSlot = (unsigned char)slot;
+                    RLGL.State.textureFoldVertex = RLGL.State.vertexCounter;
+                    return;
                 }
             }
-            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+
+            rlNextDrawCall();
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         }
@@ -459,37 +998,45 @@ void rlSetTexture(unsigned int id)
 // Select and active a texture slot
 void rlActiveTextureSlot(int slot)
 {
-    glActiveTexture(GL_TEXTURE0 + slot);
+    rlCacheActiveTexture(slot);
 }
 
 // Enable texture
 void rlEnableTexture(unsigned int id)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
 }
 
 // Disable texture
 void rlDisableTexture(void)
 {
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
 }
 
 // Enable texture cubemap
 void rlEnableTextureCubemap(unsigned int id)
 {
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, id);
 }
 
 // Disable texture cubemap
 void rlDisableTextureCubemap(void)
 {
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 }
 
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    if (RLGL_TRACE_ACTIVE)
+    {
+        rlTraceTexture(id);
+        rlTraceCommand(RLGL_TRACE_TEXTURE_PARAMETERS, (int[3]){ (int)id, param, value }, 3*sizeof(int));
+    }
+
+    if (RLGL.Software.textureCount > 0) rlSoftwareReleaseTexture(id);
+
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
     switch (param)
     {
         case RL_TEXTURE_WRAP_S:
@@ -518,19 +1065,21 @@ void rlTextureParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
 }
 
 // Enable shader program
 void rlEnableShader(unsigned int id)
 {
-    glUseProgram(id);
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_ENABLE_SHADER, &id, sizeof(unsigned int));
+    rlCacheUseProgram(id);
 }
 
 // Disable shader program
 void rlDisableShader(void)
 {
-    glUseProgram(0);
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_DISABLE_SHADER, NULL, 0);
+    rlCacheUseProgram(0);
 }
 
 // Enable rendering to texture (fbo)
@@ -542,7 +1091,21 @@ void rlEnableFramebuffer(unsigned int id)
 // Disable rendering to texture
 void rlDisableFramebuffer(void)
 {
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.defaultFramebufferId);
+}
+
+// Set default framebuffer, used instead of window framebuffer (i.e. headless rendering)
+// NOTE: Framebuffer is binded right away, it must be unloaded after setting default framebuffer back to 0
+void rlSetDefaultFramebuffer(unsigned int id)
+{
+    RLGL.State.defaultFramebufferId = id;
+    glBindFramebuffer(GL_FRAMEBUFFER, id);
+}
+
+// Get default framebuffer id
+unsigned int rlGetDefaultFramebuffer(void)
+{
+    return RLGL.State.defaultFramebufferId;
 }
 
 // Activate multiple draw color buffers
@@ -581,52 +1144,67 @@ void rlActiveDrawBuffers(int count)
 //----------------------------------------------------------------------------------
 
 // Enable color blending
-void rlEnableColorBlend(void) { glEnable(GL_BLEND); }
+void rlEnableColorBlend(void) { if (RLGL_TRACE_ACTIVE) rlTraceState(RLGL_TRACE_STATE_BLEND, true); rlCacheCapability(GL_BLEND, true); }
 
 // Disable color blending
-void rlDisableColorBlend(void) { glDisable(GL_BLEND); }
+void rlDisableColorBlend(void) { if (RLGL_TRACE_ACTIVE) rlTraceState(RLGL_TRACE_STATE_BLEND, false); rlCacheCapability(GL_BLEND, false); }
 
 // Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
+void rlEnableDepthTest(void) { if (RLGL_TRACE_ACTIVE) rlTraceState(RLGL_TRACE_STATE_DEPTH_TEST, true); rlCacheCapability(GL_DEPTH_TEST, true); }
 
 // Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
+void rlDisableDepthTest(void) { if (RLGL_TRACE_ACTIVE) rlTraceState(RLGL_TRACE_STATE_DEPTH_TEST, false); rlCacheCapability(GL_DEPTH_TEST, false); }
 
 // Enable depth write
-void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); }
+void rlEnableDepthMask(void) { if (RLGL_TRACE_ACTIVE) rlTraceState(RLGL_TRACE_STATE_DEPTH_MASK, true); rlCacheDepthMask(true); }
 
 // Disable depth write
-void rlDisableDepthMask(void) { glDepthMask(GL_FALSE); }
+void rlDisableDepthMask(void) { if (RLGL_TRACE_ACTIVE) rlTraceState(RLGL_TRACE_STATE_DEPTH_MASK, false); rlCacheDepthMask(false); }
 
 // Enable backface culling
-void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
+void rlEnableBackfaceCulling(void) { if (RLGL_TRACE_ACTIVE) rlTraceState(RLGL_TRACE_STATE_CULL_FACE, true); rlCacheCapability(GL_CULL_FACE, true); }
 
 // Disable backface culling
-void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
+void rlDisableBackfaceCulling(void) { if (RLGL_TRACE_ACTIVE) rlTraceState(RLGL_TRACE_STATE_CULL_FACE, false); rlCacheCapability(GL_CULL_FACE, false); }
 
 // Enable scissor test
-void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
+void rlEnableScissorTest(void) { if (RLGL_TRACE_ACTIVE) rlTraceState(RLGL_TRACE_STATE_SCISSOR_TEST, true); rlCacheCapability(GL_SCISSOR_TEST, true); }
 
 // Disable scissor test
-void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
+void rlDisableScissorTest(void) { if (RLGL_TRACE_ACTIVE) rlTraceState(RLGL_TRACE_STATE_SCISSOR_TEST, false); rlCacheCapability(GL_SCISSOR_TEST, false); }
 
 // Scissor test
-void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
+void rlScissor(int x, int y, int width, int height)
+{
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_SCISSOR, (int[4]){ x, y, width, height }, 4*sizeof(int));
+    RLGL.Software.scissor[0] = x;
+    RLGL.Software.scissor[1] = y;
+    RLGL.Software.scissor[2] = width;
+    RLGL.Software.scissor[3] = height;
+    glScissor(x, y, width, height);
+}
 
 // Enable wire mode
 void rlEnableWireMode(void)
 {
+    if (RLGL_TRACE_ACTIVE) rlTraceState(RLGL_TRACE_STATE_WIRE_MODE, true);
     glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 }
 
 // Disable wire mode
 void rlDisableWireMode(void)
 {
+    if (RLGL_TRACE_ACTIVE) rlTraceState(RLGL_TRACE_STATE_WIRE_MODE, false);
     glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
 }
 
 // Set the line drawing width
-void rlSetLineWidth(float width) { glLineWidth(width); }
+void rlSetLineWidth(float width)
+{
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_LINE_WIDTH, &width, sizeof(float));
+    RLGL.Software.lineWidth = width;
+    glLineWidth(width);
+}
 
 // Get the line drawing width
 float rlGetLineWidth(void)
@@ -639,12 +1217,14 @@ float rlGetLineWidth(void)
 // Enable line aliasing
 void rlEnableSmoothLines(void)
 {
+    if (RLGL_TRACE_ACTIVE) rlTraceState(RLGL_TRACE_STATE_SMOOTH_LINES, true);
     glEnable(GL_LINE_SMOOTH);
 }
 
 // Disable line aliasing
 void rlDisableSmoothLines(void)
 {
+    if (RLGL_TRACE_ACTIVE) rlTraceState(RLGL_TRACE_STATE_SMOOTH_LINES, false);
     glDisable(GL_LINE_SMOOTH);
 }
 
@@ -666,9 +1246,97 @@ bool rlIsStereoRenderEnabled(void)
     return RLGL.State.stereoRender;
 }
 
+// Mark all cached OpenGL state as unknown
+// NOTE: Required after any direct OpenGL call changing state tracked by rlgl (binds, enables)
+void rlResetStateCache(void)
+{
+    RLGL.Cache.shaderId = RLGL_CACHE_UNKNOWN;
+    RLGL.Cache.textureSlot = RLGL_CACHE_UNKNOWN;
+    for (int i = 0; i < RLGL_CACHE_TEXTURE_SLOTS; i++)
+    {
+        RLGL.Cache.textureId[i] = RLGL_CACHE_UNKNOWN;
+        RLGL.Cache.cubemapId[i] = RLGL_CACHE_UNKNOWN;
+    }
+    RLGL.Cache.vaoId = RLGL_CACHE_UNKNOWN;
+    RLGL.Cache.vboId = RLGL_CACHE_UNKNOWN;
+    RLGL.Cache.eboId = RLGL_CACHE_UNKNOWN;
+    RLGL.Cache.blend = RLGL_CACHE_UNKNOWN;
+    RLGL.Cache.depthTest = RLGL_CACHE_UNKNOWN;
+    RLGL.Cache.depthMask = RLGL_CACHE_UNKNOWN;
+    RLGL.Cache.cullFace = RLGL_CACHE_UNKNOWN;
+    RLGL.Cache.scissorTest = RLGL_CACHE_UNKNOWN;
+    RLGL.Cache.blendSrcFactor = RLGL_CACHE_UNKNOWN;
+    RLGL.Cache.blendDstFactor = RLGL_CACHE_UNKNOWN;
+    RLGL.Cache.blendEquation = RLGL_CACHE_UNKNOWN;
+}
+
+// Check cached state against OpenGL queries, mismatches are logged
+// NOTE: Queries stall the pipeline, only intended for debugging (RLGL_STATE_CACHE_VALIDATION)
+bool rlValidateStateCache(void)
+{
+    bool valid = true;
+    GLint value = 0;
+
+    #define RLGL_CACHE_CHECK(name, cached, actual) \
+        if (((cached) != RLGL_CACHE_UNKNOWN) && ((cached) != (unsigned int)(actual))) \
+        { \
+            TRACELOG(LOG_WARNING, "RLGL: State cache mismatch on %s: cached %u, OpenGL %u", name, (cached), (unsigned int)(actual)); \
+            valid = false; \
+        }
+
+    glGetIntegerv(GL_CURRENT_PROGRAM, &value); RLGL_CACHE_CHECK("shader program", RLGL.Cache.shaderId, value);
+    glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &value); RLGL_CACHE_CHECK("vertex array", RLGL.Cache.vaoId, value);
+    glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &value); RLGL_CACHE_CHECK("vertex buffer", RLGL.Cache.vboId, value);
+    glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &value); RLGL_CACHE_CHECK("element buffer", RLGL.Cache.eboId, value);
+    RLGL_CACHE_CHECK("color blend", RLGL.Cache.blend, glIsEnabled(GL_BLEND));
+    RLGL_CACHE_CHECK("depth test", RLGL.Cache.depthTest, glIsEnabled(GL_DEPTH_TEST));
+    RLGL_CACHE_CHECK("backface culling", RLGL.Cache.cullFace, glIsEnabled(GL_CULL_FACE));
+    RLGL_CACHE_CHECK("scissor test", RLGL.Cache.scissorTest, glIsEnabled(GL_SCISSOR_TEST));
+    glGetIntegerv(GL_DEPTH_WRITEMASK, &value); RLGL_CACHE_CHECK("depth mask", RLGL.Cache.depthMask, value);
+    glGetIntegerv(GL_BLEND_SRC_RGB, &value); RLGL_CACHE_CHECK("blend source factor", RLGL.Cache.blendSrcFactor, value);
+    glGetIntegerv(GL_BLEND_DST_RGB, &value); RLGL_CACHE_CHECK("blend destination factor", RLGL.Cache.blendDstFactor, value);
+    glGetIntegerv(GL_BLEND_EQUATION_RGB, &value); RLGL_CACHE_CHECK("blend equation", RLGL.Cache.blendEquation, value);
+
+    // Texture bindings are queried on every slot, active slot is restored afterwards
+    GLint activeTexture = 0;
+    glGetIntegerv(GL_ACTIVE_TEXTURE, &activeTexture);
+    RLGL_CACHE_CHECK("active texture slot", RLGL.Cache.textureSlot, activeTexture - GL_TEXTURE0);
+
+    for (int i = 0; i < RLGL_CACHE_TEXTURE_SLOTS; i++)
+    {
+        glActiveTexture(GL_TEXTURE0 + i);
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &value); RLGL_CACHE_CHECK("texture 2D", RLGL.Cache.textureId[i], value);
+        glGetIntegerv(GL_TEXTURE_BINDING_CUBE_MAP, &value); RLGL_CACHE_CHECK("texture cubemap", RLGL.Cache.cubemapId[i], value);
+    }
+    glActiveTexture(activeTexture);
+
+    #undef RLGL_CACHE_CHECK
+
+    return valid;
+}
+
+// Get GL state cache statistics since last reset
+rlStateCacheStats rlGetStateCacheStats(void)
+{
+    return RLGL.Cache.stats;
+}
+
+// Reset GL state cache statistics
+void rlResetStateCacheStats(void)
+{
+    RLGL.Cache.stats.issuedCount = 0;
+    RLGL.Cache.stats.skippedCount = 0;
+}
+
 // Clear color buffer with color
 void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
 {
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_CLEAR_COLOR, (unsigned char[4]){ r, g, b, a }, 4);
+    RLGL.Software.clearColor[0] = r;
+    RLGL.Software.clearColor[1] = g;
+    RLGL.Software.clearColor[2] = b;
+    RLGL.Software.clearColor[3] = a;
+
     // Color values clamp to 0.0f(0) and 1.0f(255)
     float cr = (float)r/255;
     float cg = (float)g/255;
@@ -680,6 +1348,25 @@ void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned ch
 // Clear used screen buffers (color and depth)
 void rlClearScreenBuffers(void)
 {
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_CLEAR_SCREEN, NULL, 0);
+
+    if (RLGL.Software.enabled)
+    {
+        // Software buffers are cleared instead, limited to scissor area as glClear()
+        int rect[4] = { 0, 0, RLGL.Software.width - 1, RLGL.Software.height - 1 };
+        if (RLGL.Cache.scissorTest == 1) rlSoftwareClipRect(rect, RLGL.Software.scissor);
+
+        for (int y = rect[1]; y <= rect[3]; y++)
+        {
+            for (int x = rect[0]; x <= rect[2]; x++)
+            {
+                memcpy(&RLGL.Software.color[4*(y*RLGL.Software.width + x)], RLGL.Software.clearColor, 4);
+                RLGL.Software.depth[y*RLGL.Software.width + x] = 1.0f;
+            }
+        }
+        return;
+    }
+
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);     // Clear used buffers: Color and Depth (Depth is used for 3D)
     //glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);     // Stencil buffer not used...
 }
@@ -707,15 +1394,16 @@ void rlCheckErrors()
 // Set blend mode
 void rlSetBlendMode(int mode)
 {
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_BLEND_MODE, &mode, sizeof(int));
     if (RLGL.State.currentBlendMode != mode) {
         rlDrawRenderBatch(RLGL.currentBatch);
         switch (mode) {
-            case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
-            case RL_BLEND_CUSTOM: glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation); break;
+            case RL_BLEND_ALPHA: rlCacheBlendFunction(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_FUNC_ADD); break;
+            case RL_BLEND_ADDITIVE: rlCacheBlendFunction(GL_SRC_ALPHA, GL_ONE, GL_FUNC_ADD); break;
+            case RL_BLEND_MULTIPLIED: rlCacheBlendFunction(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA, GL_FUNC_ADD); break;
+            case RL_BLEND_ADD_COLORS: rlCacheBlendFunction(GL_ONE, GL_ONE, GL_FUNC_ADD); break;
+            case RL_BLEND_SUBTRACT_COLORS: rlCacheBlendFunction(GL_ONE, GL_ONE, GL_FUNC_SUBTRACT); break;
+            case RL_BLEND_CUSTOM: rlCacheBlendFunction(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor, RLGL.State.glBlendEquation); break;
             default: break;
         }
         RLGL.State.currentBlendMode = mode;
@@ -725,6 +1413,7 @@ void rlSetBlendMode(int mode)
 // Set blending mode factor and equation
 void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation)
 {
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_BLEND_FACTORS, (int[3]){ glSrcFactor, glDstFactor, glEquation }, 3*sizeof(int));
     RLGL.State.glBlendSrcFactor = glSrcFactor;
     RLGL.State.glBlendDstFactor = glDstFactor;
     RLGL.State.glBlendEquation = glEquation;
@@ -737,6 +1426,9 @@ void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation)
 // Initialize rlgl: OpenGL extensions, default buffers/shaders/textures, OpenGL states
 void rlglInit(int width, int height)
 {
+    // Init GL state cache, OpenGL state is unknown until first set by rlgl
+    rlResetStateCache();
+
     // Init default white texture
     unsigned char pixels[4] = { 255, 255, 255, 255 };   // 1 pixel RGBA (4 bytes)
     RLGL.State.defaultTextureId = rlLoadTexture(pixels, 1, 1, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
@@ -754,6 +1446,11 @@ void rlglInit(int width, int height)
     RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
     RLGL.currentBatch = &RLGL.defaultBatch;
 
+    // Init camera matrices uniform buffer, shared by all shaders declaring the camera uniform block
+    RLGL.State.cameraBufferId = rlLoadUniformBuffer(32*sizeof(float), NULL, RL_DYNAMIC_DRAW);
+    RLGL.State.cameraBufferValid = false;
+    rlBindUniformBuffer(RL_DEFAULT_CAMERA_UNIFORM_BINDING, RLGL.State.cameraBufferId);
+
     // Init stack matrices (emulating OpenGL 1.1)
     for (int i = 0; i < RL_MAX_MATRIX_STACK_SIZE; i++) RLGL.State.stack[i] = MatrixIdentity();
 
@@ -763,21 +1460,37 @@ void rlglInit(int width, int height)
     RLGL.State.modelview = MatrixIdentity();
     RLGL.State.currentMatrix = &RLGL.State.modelview;
 
+    // Select batch vertex transform kernel supported by current CPU
+#if defined(RLGL_SIMD_AVX2)
+    if (rlCpuSupportsAVX2())
+    {
+        rlTransformVertex = rlTransformVertexAVX2;
+        TRACELOG(LOG_INFO, "RLGL: Batch vertex transform: AVX2");
+    }
+    else TRACELOG(LOG_INFO, "RLGL: Batch vertex transform: SSE2");
+#elif defined(RLGL_SIMD_SSE2)
+    TRACELOG(LOG_INFO, "RLGL: Batch vertex transform: SSE2");
+#elif defined(RLGL_SIMD_NEON)
+    TRACELOG(LOG_INFO, "RLGL: Batch vertex transform: NEON");
+#else
+    TRACELOG(LOG_INFO, "RLGL: Batch vertex transform: scalar");
+#endif
+
     // Initialize OpenGL default states
     //----------------------------------------------------------
     // Init state: Depth test
     glDepthFunc(GL_LEQUAL);                                 // Type of depth testing to apply
-    glDisable(GL_DEPTH_TEST);                               // Disable depth testing for 2D (only used for 3D)
+    rlCacheCapability(GL_DEPTH_TEST, false);                // Disable depth testing for 2D (only used for 3D)
 
     // Init state: Blending mode
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);      // Color blending function (how colors are mixed)
-    glEnable(GL_BLEND);                                     // Enable color blending (required to work with transparencies)
+    rlCacheBlendFunction(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_FUNC_ADD);   // Color blending function (how colors are mixed)
+    rlCacheCapability(GL_BLEND, true);                      // Enable color blending (required to work with transparencies)
 
     // Init state: Culling
     // NOTE: All shapes/models triangles are drawn CCW
     glCullFace(GL_BACK);                                    // Cull the back face (default)
     glFrontFace(GL_CCW);                                    // Front face are defined counter clockwise (default)
-    glEnable(GL_CULL_FACE);                                 // Enable backface culling
+    rlCacheCapability(GL_CULL_FACE, true);                  // Enable backface culling
 
     // Init state: Cubemap seamless
     glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);                 // Seamless cubemaps (not supported on OpenGL ES 2.0)
@@ -789,7 +1502,7 @@ void rlglInit(int width, int height)
     TRACELOG(LOG_INFO, "RLGL: Default OpenGL state initialized successfully");
 
     // Init state: Color/Depth buffers clear
-    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);                   // Set clear color (black)
+    rlClearColor(0, 0, 0, 255);                             // Set clear color (black)
     glClearDepth(1.0f);                                     // Set clear depth value (default)
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);     // Clear color and depth buffers (depth buffer required for 3D)
 }
@@ -797,12 +1510,78 @@ void rlglInit(int width, int height)
 // Vertex Buffer Object deinitialization (memory free)
 void rlglClose(void)
 {
+    rlEndTraceCapture();
+    rlDisableSoftwareRender();
+    rlDisableGpuZones();
     rlUnloadRenderBatch(RLGL.defaultBatch);
+    rlUnloadUniformBuffer(RLGL.State.cameraBufferId);
+    RLGL.State.cameraBufferId = 0;
+    if (RLGL.State.drawIndirectBufferId != 0) rlUnloadVertexBuffer(RLGL.State.drawIndirectBufferId);
+    RLGL.State.drawIndirectBufferId = 0;
     rlUnloadShaderDefault();          // Unload default shader
-    glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
+    rlCacheDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 }
 
+// Create rlgl context and make it current on calling thread
+// NOTE: Context is initialized on current OpenGL context (default texture, shader, render batch),
+// OpenGL functions, extensions support and default framebuffer are shared with the rlgl context current before
+rlContext *rlCreateContext(int width, int height)
+{
+    rlglData *context = (rlglData *)RL_CALLOC(1, sizeof(rlglData));
+
+    context->ExtSupported = RLGL.ExtSupported;
+    context->State.defaultFramebufferId = RLGL.State.defaultFramebufferId;
+    memcpy(context->State.shaderCachePath, RLGL.State.shaderCachePath, sizeof(context->State.shaderCachePath));
+
+    rlglCurrentContext = context;
+    rlglInit(width, height);
+
+    return context;
+}
+
+// Destroy rlgl context, it must not be current on any other thread
+// NOTE: Calling thread keeps its current context, default context is made current if it was the destroyed one
+void rlDestroyContext(rlContext *context)
+{
+    if ((context == NULL) || (context == &rlglDefaultContext)) return;
+
+    rlglData *previous = rlglCurrentContext;
+
+    rlglCurrentContext = context;
+    rlglClose();
+
+    rlglCurrentContext = (previous == context)? &rlglDefaultContext : previous;
+    rlResetStateCache();        // OpenGL state changed by unloading, cached state is not valid anymore
+    RL_FREE(context);
+}
+
+// Set rlgl context current on calling thread (NULL for default context)
+// NOTE: Pending batch vertex of previous context are not drawn, they are kept for the next time it is current
+void rlSetCurrentContext(rlContext *context)
+{
+    if (context == NULL) context = &rlglDefaultContext;
+    if (context == rlglCurrentContext) return;
+
+    rlglCurrentContext = context;
+
+    // Other rlgl contexts could have changed OpenGL state meanwhile (same OpenGL context),
+    // cached state is not valid anymore
+    rlResetStateCache();
+}
+
+// Get rlgl context current on calling thread
+rlContext *rlGetCurrentContext(void)
+{
+    return rlglCurrentContext;
+}
+
+// Get default rlgl context
+rlContext *rlGetDefaultContext(void)
+{
+    return &rlglDefaultContext;
+}
+
 // Load OpenGL extensions
 // NOTE: External loader function must be provided
 void rlLoadExtensions(void *loader)
@@ -829,6 +1608,18 @@ void rlLoadExtensions(void *loader)
     // NOTE: With GLAD, we can check if an extension is supported using the GLAD_GL_xxx booleans
     if (GLAD_GL_EXT_texture_compression_s3tc) RLGL.ExtSupported.texCompDXT = true;  // Texture compression: DXT
     if (GLAD_GL_ARB_ES3_compatibility) RLGL.ExtSupported.texCompETC2 = true;        // Texture compression: ETC2/EAC
+    if (GLAD_GL_ARB_buffer_storage) RLGL.ExtSupported.bufferStorage = true;         // Persistent mapped buffers
+    if (GLAD_GL_VERSION_4_2) RLGL.ExtSupported.baseInstance = true;                 // Draw commands base instance
+    if (RLGL.ExtSupported.baseInstance && (GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_multi_draw_indirect)) RLGL.ExtSupported.multiDrawIndirect = true;  // Multi draw indirect
+    if (GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_compute_shader) RLGL.ExtSupported.computeShader = true;             // Compute shaders
+    if (GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_shader_storage_buffer_object) RLGL.ExtSupported.ssbo = true;     // Shader storage buffer objects
+    if (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_get_program_binary)
+    {
+        // NOTE: Some drivers expose the functions but no binary format at all
+        GLint formats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        if (formats > 0) RLGL.ExtSupported.programBinary = true;                     // Program binaries (shader cache)
+    }
 
     // Check OpenGL information and capabilities
     //------------------------------------------------------------------------------
@@ -852,6 +1643,8 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.bufferStorage) TRACELOG(LOG_INFO, "GL: Persistent mapped buffers supported");
+    if (RLGL.ExtSupported.programBinary) TRACELOG(LOG_INFO, "GL: Program binaries supported");
 }
 
 // Get default framebuffer width
@@ -881,13 +1674,22 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
 
+#if RL_DEFAULT_BATCH_INTERLEAVED
+        batch.vertexBuffer[i].vertices = NULL;
+        batch.vertexBuffer[i].texcoords = NULL;
+        batch.vertexBuffer[i].colors = NULL;
+        batch.vertexBuffer[i].vertexData = (rlBatchVertex *)RL_CALLOC(bufferElements*4, sizeof(rlBatchVertex));   // 4 vertex by quad
+#else
         batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
         batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
         batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
-        batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
+        batch.vertexBuffer[i].vertexData = NULL;
         for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
         for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
         for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+#endif
+        batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
+        batch.vertexBuffer[i].textureSlots = (unsigned char *)RL_CALLOC(bufferElements*4, sizeof(unsigned char));  // 1 slot by vertex
 
         int k = 0;
 
@@ -918,41 +1720,45 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         {
             // Initialize Quads VAO
             glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId);
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlCacheBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+        if (batch.vertexBuffer[i].vertexData != NULL)
+        {
+            // Quads - Interleaved vertex buffer: position, texcoord and color in a single VBO
+            batch.vertexBuffer[i].vboMapped[0] = rlLoadBatchVertexBuffer(&batch.vertexBuffer[i].vboId[0], batch.vertexBuffer[i].vertexData, bufferElements*4*sizeof(rlBatchVertex));
+            batch.vertexBuffer[i].vboId[1] = 0;
+            batch.vertexBuffer[i].vboId[2] = 0;
+            batch.vertexBuffer[i].vboMapped[1] = NULL;
+            batch.vertexBuffer[i].vboMapped[2] = NULL;
+        }
+        else
+        {
+            // Quads - Vertex buffers, one VBO by vertex attribute
+            batch.vertexBuffer[i].vboMapped[0] = rlLoadBatchVertexBuffer(&batch.vertexBuffer[i].vboId[0], batch.vertexBuffer[i].vertices, bufferElements*3*4*sizeof(float));
+            batch.vertexBuffer[i].vboMapped[1] = rlLoadBatchVertexBuffer(&batch.vertexBuffer[i].vboId[1], batch.vertexBuffer[i].texcoords, bufferElements*2*4*sizeof(float));
+            batch.vertexBuffer[i].vboMapped[2] = rlLoadBatchVertexBuffer(&batch.vertexBuffer[i].vboId[2], batch.vertexBuffer[i].colors, bufferElements*4*4*sizeof(unsigned char));
+        }
+        batch.vertexBuffer[i].syncFence = NULL;
 
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+        // Texture slots buffer, filled on batch draw (not persistently mapped)
+        glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[4]);
+        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(unsigned char), batch.vertexBuffer[i].textureSlots, GL_DYNAMIC_DRAW);
 
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        // Vertex buffers binding and attributes enable
+        rlSetBatchVertexAttributes(&batch.vertexBuffer[i]);
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
+        rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(int), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
     }
 
     TRACELOG(LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
     //--------------------------------------------------------------------------------------------
 
     // Init draw calls tracking system
@@ -965,6 +1771,9 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         //batch.draws[i].vaoId = 0;
         //batch.draws[i].shaderId = 0;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].textureCount = 0;
+        batch.draws[i].layer = RLGL.State.drawLayer;
+        batch.draws[i].layerOrdered = RLGL.State.drawLayerOrdered;
         //batch.draws[i].RLGL.State.projection = MatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = MatrixIdentity();
     }
@@ -978,8 +1787,8 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 void rlUnloadRenderBatch(rlRenderBatch batch)
 {
     // Unbind everything
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, 0);
+    rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
     // Unload all vertex buffers data
     for (int i = 0; i < batch.bufferCount; i++)
@@ -987,28 +1796,35 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         // Unbind VAO attribs data
         if (RLGL.ExtSupported.vao)
         {
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlCacheBindVertexArray(batch.vertexBuffer[i].vaoId);
             glDisableVertexAttribArray(0);
             glDisableVertexAttribArray(1);
             glDisableVertexAttribArray(2);
             glDisableVertexAttribArray(3);
-            glBindVertexArray(0);
+            rlCacheBindVertexArray(0);
         }
 
+        // Release GPU fence, persistently mapped buffers are unmapped on deletion
+        if (batch.vertexBuffer[i].syncFence != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].syncFence);
+
         // Delete VBOs from GPU (VRAM)
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+        // NOTE: Unused buffers (interleaved layout) have id 0, silently ignored by glDeleteBuffers()
+        rlCacheDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+        rlCacheDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
+        rlCacheDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+        rlCacheDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+        rlCacheDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
 
         // Delete VAOs from GPU (VRAM)
-        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+        if (RLGL.ExtSupported.vao) rlCacheDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
 
         // Free vertex arrays memory from CPU (RAM)
         RL_FREE(batch.vertexBuffer[i].vertices);
         RL_FREE(batch.vertexBuffer[i].texcoords);
         RL_FREE(batch.vertexBuffer[i].colors);
+        RL_FREE(batch.vertexBuffer[i].vertexData);
         RL_FREE(batch.vertexBuffer[i].indices);
+        RL_FREE(batch.vertexBuffer[i].textureSlots);
     }
     // Unload arrays
     RL_FREE(batch.vertexBuffer);
@@ -1019,47 +1835,171 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 // NOTE: We require a pointer to reset batch and increase current buffer (multi-buffer)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
+    RLGL.Trace.suspended++;     // Matrices and viewport set internally (stereo rendering) are not traced
+
+    // Vertex added under current transform matrix must be transformed before upload
+    rlApplyPendingTransform();
+
+    // Display list recording: batch content is captured and nothing is uploaded or drawn
+    if (RLGL.Record.active)
+    {
+        rlRecordRenderBatch(batch);
+        RLGL.State.vertexCounter = 0;
+    }
+
+    // Software rasterizer: batch content is rasterized on CPU and nothing is uploaded or drawn
+    if (RLGL.Software.enabled && (RLGL.State.vertexCounter > 0))
+    {
+        RLGL.State.batchStats.flushCount++;
+        RLGL.State.batchStats.vertexCount += RLGL.State.vertexCounter;
+        rlSoftwareRenderBatch(batch);
+        RLGL.State.vertexCounter = 0;
+    }
+
+    bool gpuZone = (RLGL.State.vertexCounter > 0);
+    if (gpuZone) rlBeginGpuZone("rlDrawRenderBatch");
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (change flag required)
     if (RLGL.State.vertexCounter > 0)
     {
-        // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
-
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
-
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
-
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
-
-        // NOTE: glMapBuffer() causes sync issue.
-        // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
-        // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
-        // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
-        // allocated pointer immediately even if GPU is still working with the previous data.
-
-        // Another option: map the buffer object into client's memory
-        // Probably this code could be moved somewhere else...
-        // batch->vertexBuffer[batch->currentBuffer].vertices = (float *)glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-        // if (batch->vertexBuffer[batch->currentBuffer].vertices)
-        // {
-            // Update vertex data
-        // }
-        // glUnmapBuffer(GL_ARRAY_BUFFER);
-
-        // Unbind the current VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+        rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+        RLGL.State.batchStats.flushCount++;
+        RLGL.State.batchStats.vertexCount += RLGL.State.vertexCounter;
+
+        if (buffer->vboMapped[0] != NULL)
+        {
+            // Persistently mapped buffers: the GPU could still be reading this ring buffer from
+            // a previous flush, wait on its fence before overwriting the data
+            if (buffer->syncFence != NULL)
+            {
+                GLenum result = glClientWaitSync((GLsync)buffer->syncFence, 0, 0);
+                if (result == GL_TIMEOUT_EXPIRED)
+                {
+                    RLGL.State.batchStats.waitCount++;
+                    while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync((GLsync)buffer->syncFence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+                }
+                glDeleteSync((GLsync)buffer->syncFence);
+                buffer->syncFence = NULL;
+            }
+
+            if (buffer->vertexData != NULL) memcpy(buffer->vboMapped[0], buffer->vertexData, RLGL.State.vertexCounter*sizeof(rlBatchVertex));
+            else
+            {
+                memcpy(buffer->vboMapped[0], buffer->vertices, RLGL.State.vertexCounter*3*sizeof(float));
+                memcpy(buffer->vboMapped[1], buffer->texcoords, RLGL.State.vertexCounter*2*sizeof(float));
+                memcpy(buffer->vboMapped[2], buffer->colors, RLGL.State.vertexCounter*4*sizeof(unsigned char));
+            }
+        }
+        else if (buffer->vertexData != NULL)
+        {
+            // Interleaved vertex buffer, single orphan and upload
+            rlCacheBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, buffer->elementCount*4*sizeof(rlBatchVertex), NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(rlBatchVertex), buffer->vertexData);
+        }
+        else
+        {
+            // Buffer orphaning: glBufferData() with NULL pointer discards previous storage, so the
+            // driver can hand us new memory instead of stalling until the GPU is done with the old one
+            // Vertex positions buffer
+            rlCacheBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, buffer->elementCount*3*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), buffer->vertices);
+
+            // Texture coordinates buffer
+            rlCacheBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+            glBufferData(GL_ARRAY_BUFFER, buffer->elementCount*2*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), buffer->texcoords);
+
+            // Colors buffer
+            rlCacheBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+            glBufferData(GL_ARRAY_BUFFER, buffer->elementCount*4*4*sizeof(unsigned char), NULL, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), buffer->colors);
+        }
+    }
+    //------------------------------------------------------------------------------------------------------------
+
+    // Setup batch draws order and vertex offsets
+    // NOTE: Draws are stored in submission order, vertex of every draw are contiguous in the buffer
+    //------------------------------------------------------------------------------------------------------------
+    const rlDrawCall *drawOrder[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int drawOffsets[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    GLint rangeFirst[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    GLsizei rangeSize[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    const GLvoid *rangeIndices[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+
+    for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+    {
+        drawOrder[i] = &batch->draws[i];
+        drawOffsets[i] = vertexOffset;
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+    }
+
+    if (RLGL.State.drawSorting && (batch->drawCounter > 1)) qsort((void *)drawOrder, batch->drawCounter, sizeof(rlDrawCall *), rlCompareDrawCalls);
+    //------------------------------------------------------------------------------------------------------------
+
+    // Setup batch draws texture slots
+    // NOTE: Following draws with same mode are grouped while their textures fit in the texture slots,
+    // every group is submitted with a single draw call, default shader selects texture by vertex slot
+    // Custom shaders only sample texture0, so they get a single slot (one group by texture)
+    // Folded draws (several textures, see rlSetTexture()) store vertex slots as index on draw textureIds[],
+    // they are remapped to the group slots
+    //------------------------------------------------------------------------------------------------------------
+    unsigned char drawSlots[RL_DEFAULT_BATCH_DRAWCALLS][RL_DEFAULT_BATCH_TEXTURE_SLOTS] = { 0 };
+    bool drawGroupStart[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    unsigned int slotTextures[RL_DEFAULT_BATCH_TEXTURE_SLOTS] = { 0 };
+    int slotLimit = (RLGL.State.currentShaderId == RLGL.State.defaultShaderId)? RL_DEFAULT_BATCH_TEXTURE_SLOTS : 1;
+    int slotCount = 0;
+    int groupMode = -1;
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+
+    for (int i = 0; i < batch->drawCounter; i++)
+    {
+        const rlDrawCall *draw = drawOrder[i];
+        drawGroupStart[i] = (i == 0);
+
+        if (draw->vertexCount == 0) continue;
+
+        const unsigned int *textures = (draw->textureCount > 0)? draw->textureIds : &draw->textureId;
+        int textureCount = (draw->textureCount > 0)? draw->textureCount : 1;
+
+        int newCount = 0;
+        for (int t = 0; t < textureCount; t++)
+        {
+            int slot = 0;
+            while ((slot < slotCount) && (slotTextures[slot] != textures[t])) slot++;
+            if (slot == slotCount) newCount++;
+        }
+
+        // Mode changed or not enough slots free for draw textures: start a new group
+        if ((draw->mode != groupMode) || ((slotCount + newCount) > slotLimit))
+        {
+            drawGroupStart[i] = true;
+            groupMode = draw->mode;
+            slotCount = 0;
+        }
+
+        for (int t = 0; t < textureCount; t++)
+        {
+            int slot = 0;
+            while ((slot < slotCount) && (slotTextures[slot] != textures[t])) slot++;
+            if (slot == slotCount) slotTextures[slotCount++] = textures[t];
+            drawSlots[i][t] = (unsigned char)slot;
+        }
+
+        unsigned char *vertexSlots = &buffer->textureSlots[drawOffsets[draw - batch->draws]];
+        if (draw->textureCount > 0) for (int v = 0; v < draw->vertexCount; v++) vertexSlots[v] = drawSlots[i][vertexSlots[v]];
+        else memset(vertexSlots, drawSlots[i][0], draw->vertexCount);
+    }
+
+    if (RLGL.State.vertexCounter > 0)
+    {
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[4]);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(unsigned char), buffer->textureSlots);
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, 0);
     }
     //------------------------------------------------------------------------------------------------------------
 
@@ -1088,7 +2028,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         if (RLGL.State.vertexCounter > 0)
         {
             // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
+            rlCacheUseProgram(RLGL.State.currentShaderId);
 
             // Create modelview-projection matrix and upload to shader
             Matrix matMVP = MatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
@@ -1100,25 +2040,11 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             };
             glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
 
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
             else
             {
-                // Bind vertex attrib: position (shader-location = 0)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-
-                // Bind vertex attrib: texcoord (shader-location = 1)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-
-                // Bind vertex attrib: color (shader-location = 3)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+                rlSetBatchVertexAttributes(&batch->vertexBuffer[batch->currentBuffer]);
+                rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
             }
 
             // Setup some default shader values
@@ -1131,47 +2057,108 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             {
                 if (RLGL.State.activeTextureId[i] > 0)
                 {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    rlCacheActiveTexture(1 + i);
+                    rlCacheBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
                 }
             }
 
-            // Activate default sampler2D texture0 (one texture is always active for default batch shader)
-            // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
-
-            for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+            // NOTE: Batch system accumulates calls by texture slots groups, additional textures are enabled for all the draw calls
+            for (int i = 0; i < batch->drawCounter; )
             {
-                // Bind current draw call texture, activated as GL_TEXTURE0 and binded to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                // Collect the draws of the group, every draw texture is binded to its slot texture unit,
+                // contiguous vertex ranges are joined and the rest is submitted with a single glMultiDraw*() call
+                int mode = RL_QUADS;
+                int rangeCount = 0;
 
-                if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
-                else
+                do
                 {
-                    // We need to define the number of indices to be processed: elementCount*6
-                    // NOTE: The final parameter tells the GPU the offset in bytes from the
-                    // start of the index buffer to the location of the first index to process
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
-                }
+                    const rlDrawCall *draw = drawOrder[i];
+                    int offset = drawOffsets[draw - batch->draws];
 
-                vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
-            }
+                    if (draw->vertexCount == 0) continue;
 
-            if (!RLGL.ExtSupported.vao)
+                    // Slot 0 texture is activated as GL_TEXTURE0 and binded to sampler2D texture0 by default
+                    if (draw->textureCount > 0)
+                    {
+                        for (int t = 0; t < draw->textureCount; t++)
+                        {
+                            rlCacheActiveTexture(rlGetBatchTextureSlotUnit(drawSlots[i][t]));
+                            rlCacheBindTexture(GL_TEXTURE_2D, draw->textureIds[t]);
+                        }
+                    }
+                    else
+                    {
+                        rlCacheActiveTexture(rlGetBatchTextureSlotUnit(drawSlots[i][0]));
+                        rlCacheBindTexture(GL_TEXTURE_2D, draw->textureId);
+                    }
+                    mode = draw->mode;
+
+                    if ((rangeCount > 0) && (rangeFirst[rangeCount - 1] + rangeSize[rangeCount - 1] == offset)) rangeSize[rangeCount - 1] += draw->vertexCount;
+                    else
+                    {
+                        rangeFirst[rangeCount] = offset;
+                        rangeSize[rangeCount] = draw->vertexCount;
+                        rangeCount++;
+                    }
+                } while ((++i < batch->drawCounter) && !drawGroupStart[i]);
+
+                if (rangeCount == 0) continue;
+
+                if ((mode == RL_LINES) || (mode == RL_TRIANGLES))
+                {
+                    if (rangeCount == 1) glDrawArrays(mode, rangeFirst[0], rangeSize[0]);
+                    else glMultiDrawArrays(mode, rangeFirst, rangeSize, rangeCount);
+                }
+                else
+                {
+                    // We need to define the number of indices to be processed: elementCount*6
+                    // NOTE: The final parameter tells the GPU the offset in bytes from the
+                    // start of the index buffer to the location of the first index to process
+                    for (int r = 0; r < rangeCount; r++)
+                    {
+                        rangeIndices[r] = (const GLvoid *)(rangeFirst[r]/4*6*sizeof(GLuint));
+                        rangeSize[r] = rangeSize[r]/4*6;
+                    }
+
+                    if (rangeCount == 1) glDrawElements(GL_TRIANGLES, rangeSize[0], GL_UNSIGNED_INT, rangeIndices[0]);
+                    else glMultiDrawElements(GL_TRIANGLES, rangeSize, GL_UNSIGNED_INT, rangeIndices, rangeCount);
+                }
+
+                RLGL.State.batchStats.drawCallCount++;
+            }
+
+            if (!RLGL.ExtSupported.vao)
             {
-                glBindBuffer(GL_ARRAY_BUFFER, 0);
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+                rlCacheBindBuffer(GL_ARRAY_BUFFER, 0);
+                rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
 
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+            // Unbind textures
+            for (int i = slotLimit - 1; i >= 0; i--)
+            {
+                rlCacheActiveTexture(rlGetBatchTextureSlotUnit(i));
+                rlCacheBindTexture(GL_TEXTURE_2D, 0);
+            }
         }
 
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
+        if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0); // Unbind VAO
 
-        glUseProgram(0);    // Unbind shader program
+        rlCacheUseProgram(0);    // Unbind shader program
+
+#if defined(RLGL_STATE_CACHE_VALIDATION)
+        rlValidateStateCache();
+#endif
     }
     //------------------------------------------------------------------------------------------------------------
 
+    // Protect the ring buffer just drawn, it will not be overwritten until the GPU signals this fence
+    if ((RLGL.State.vertexCounter > 0) && (batch->vertexBuffer[batch->currentBuffer].vboMapped[0] != NULL))
+    {
+        batch->vertexBuffer[batch->currentBuffer].syncFence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    if (gpuZone) rlEndGpuZone();
+
     // Reset batch buffers
     //------------------------------------------------------------------------------------------------------------
     // Reset vertex counter for next frame
@@ -1190,6 +2177,9 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].textureCount = 0;
+        batch->draws[i].layer = RLGL.State.drawLayer;
+        batch->draws[i].layerOrdered = RLGL.State.drawLayerOrdered;
     }
 
     // Reset active texture units for next batch
@@ -1197,11 +2187,19 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
     // Reset draws counter to one draw for the batch
     batch->drawCounter = 1;
+    RLGL.State.textureSlot = 0;
     //------------------------------------------------------------------------------------------------------------
 
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+    // Keep next buffer at the high-water mark size reached by any buffer, steady frames don't need to grow again
+    int maxElements = 0;
+    for (int i = 0; i < batch->bufferCount; i++) if (batch->vertexBuffer[i].elementCount > maxElements) maxElements = batch->vertexBuffer[i].elementCount;
+    if (batch->vertexBuffer[batch->currentBuffer].elementCount < maxElements) rlResizeBatchVertexBuffer(&batch->vertexBuffer[batch->currentBuffer], maxElements);
+
+    RLGL.Trace.suspended--;
 }
 
 // Set the active render batch for rlgl
@@ -1215,1068 +2213,4695 @@ void rlSetRenderBatchActive(rlRenderBatch *batch)
 // Update and draw internal render batch
 void rlDrawRenderBatchActive(void)
 {
+    if (threadCommandBuffer != NULL) return;
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_DRAW_BATCH, NULL, 0);
     rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 }
 
-// Check internal buffer overflow for a given number of vertex
-// and force a rlRenderBatch draw call if required
-bool rlCheckRenderBatchLimit(int vCount)
+// Get render batch statistics since last reset
+rlRenderBatchStats rlGetRenderBatchStats(void)
 {
-    bool overflow = false;
-    if ((RLGL.State.vertexCounter + vCount) >=
-        (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
+    rlRenderBatchStats stats = RLGL.State.batchStats;
+
+    stats.bufferElements = 0;
+    for (int i = 0; i < RLGL.currentBatch->bufferCount; i++)
     {
-        int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
-        int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
+        if (RLGL.currentBatch->vertexBuffer[i].elementCount > stats.bufferElements) stats.bufferElements = RLGL.currentBatch->vertexBuffer[i].elementCount;
+    }
 
-        overflow = true;
-        rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
+    return stats;
+}
 
-        // Restore state of last batch so we can continue adding vertices
-        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
-        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentTexture;
-    }
-    return overflow;
+// Reset render batch statistics
+void rlResetRenderBatchStats(void)
+{
+    RLGL.State.batchStats.flushCount = 0;
+    RLGL.State.batchStats.waitCount = 0;
+    RLGL.State.batchStats.drawCallCount = 0;
+    RLGL.State.batchStats.vertexCount = 0;
+    RLGL.State.batchStats.growCount = 0;
 }
 
-// Textures data management
-//-----------------------------------------------------------------------------------------
-// Convert image data to OpenGL texture (returns OpenGL valid Id)
-unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount)
+// Enable sorted batch drawing
+// NOTE: Batch draws are sorted by layer, texture and mode before drawing and draws sharing
+// texture and mode are merged, it reduces state changes but overlapping draws of different
+// textures could change their order, use ordered layers for that content (2D, translucent)
+void rlEnableDrawSorting(void)
 {
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
-    unsigned int id = 0;
-    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
-        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA))) {
-        TRACELOG(LOG_WARNING, "GL: DXT compressed texture format not supported");
-        return id;
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_DRAW_SORTING, (int[1]){ 1 }, sizeof(int));
+    if (!RLGL.State.drawSorting)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.drawSorting = true;
     }
-    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB)) {
-        TRACELOG(LOG_WARNING, "GL: ETC1 compressed texture format not supported");
-        return id;
+}
+
+// Disable sorted batch drawing
+void rlDisableDrawSorting(void)
+{
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_DRAW_SORTING, (int[1]){ 0 }, sizeof(int));
+    if (RLGL.State.drawSorting)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.drawSorting = false;
     }
-    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA))) {
-        TRACELOG(LOG_WARNING, "GL: ETC2 compressed texture format not supported");
-        return id;
+}
+
+// Set layer for next batch draws
+// NOTE: Layers are drawn in ascending order, draws in an ordered layer keep their submission order
+// (only adjacent compatible draws are merged), same ordered flag should be used for a layer
+void rlSetDrawLayer(int layer, bool ordered)
+{
+    rlCommandBuffer *cmd = threadCommandBuffer;
+    if (cmd != NULL)
+    {
+        if ((cmd->layer == layer) && (cmd->layerOrdered == ordered)) return;
+
+        cmd->layer = layer;
+        cmd->layerOrdered = ordered;
+        if (cmd->drawCount > 0)
+        {
+            // Current draw vertex belong to previous layer, continue with same mode and texture on a new draw
+            rlDrawCall previous = cmd->draws[cmd->drawCount - 1];
+            rlDrawCall *draw = rlCommandBufferNextDraw(cmd);
+            draw->mode = previous.mode;
+            draw->textureId = previous.textureId;
+        }
+        return;
     }
-    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA))) {
-        TRACELOG(LOG_WARNING, "GL: PVRT compressed texture format not supported");
-        return id;
+
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_DRAW_LAYER, (int[2]){ layer, ordered }, 2*sizeof(int));
+    if ((RLGL.State.drawLayer == layer) && (RLGL.State.drawLayerOrdered == ordered)) return;
+
+    RLGL.State.drawLayer = layer;
+    RLGL.State.drawLayerOrdered = ordered;
+
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+    if (RLGL.State.drawSorting && (draw->vertexCount > 0))
+    {
+        // Current draw vertex belong to previous layer, continue with same mode and texture on a new draw
+        int mode = draw->mode;
+        unsigned int textureId = draw->textureId;
+
+        rlNextDrawCall();
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = textureId;
     }
-    if ((!RLGL.ExtSupported.texCompASTC) && ((format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA))) {
-        TRACELOG(LOG_WARNING, "GL: ASTC compressed texture format not supported");
-        return id;
+    else
+    {
+        draw->layer = layer;
+        draw->layerOrdered = ordered;
     }
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-    glGenTextures(1, &id);              // Generate texture id
-    glBindTexture(GL_TEXTURE_2D, id);
+}
 
-    int mipWidth = width;
-    int mipHeight = height;
-    int mipOffset = 0;          // Mipmap data offset
+// Load command buffer (CPU only)
+// NOTE: Buffer can be loaded on any thread, vertex and draws arrays grow when required
+rlCommandBuffer rlLoadCommandBuffer(int vertexCapacity)
+{
+    rlCommandBuffer buffer = { 0 };
 
-    // Load the different mipmap levels
-    for (int i = 0; i < mipmapCount; i++)
+    if (vertexCapacity < 4) vertexCapacity = 4;
+    buffer.vertices = (float *)RL_MALLOC(vertexCapacity*3*sizeof(float));
+    buffer.texcoords = (float *)RL_MALLOC(vertexCapacity*2*sizeof(float));
+    buffer.colors = (unsigned char *)RL_MALLOC(vertexCapacity*4*sizeof(unsigned char));
+    buffer.vertexCapacity = vertexCapacity;
+
+    buffer.drawCapacity = 64;
+    buffer.draws = (rlDrawCall *)RL_MALLOC(buffer.drawCapacity*sizeof(rlDrawCall));
+
+    return buffer;
+}
+
+// Unload command buffer
+void rlUnloadCommandBuffer(rlCommandBuffer buffer)
+{
+    RL_FREE(buffer.vertices);
+    RL_FREE(buffer.texcoords);
+    RL_FREE(buffer.colors);
+    RL_FREE(buffer.draws);
+}
+
+// Begin recording into command buffer on calling thread
+// NOTE: Previous content is discarded, recording state starts like an empty render batch (white color, identity transform, layer 0)
+void rlBeginCommandBuffer(rlCommandBuffer *buffer)
+{
+    buffer->vertexCount = 0;
+    buffer->drawCount = 0;
+    buffer->texcoord[0] = 0.0f;
+    buffer->texcoord[1] = 0.0f;
+    buffer->color[0] = 255;
+    buffer->color[1] = 255;
+    buffer->color[2] = 255;
+    buffer->color[3] = 255;
+    buffer->currentDepth = -1.0f;
+    buffer->layer = 0;
+    buffer->layerOrdered = false;
+    buffer->transform = MatrixIdentity();
+    buffer->transformRequired = false;
+    buffer->stackCounter = 0;
+
+    threadCommandBuffer = buffer;
+}
+
+// End recording on calling thread
+void rlEndCommandBuffer(void)
+{
+    threadCommandBuffer = NULL;
+}
+
+// Submit command buffers into active render batch, in array order
+// NOTE: Recorded draws go through the regular batch path (textures, layers, batch limits and current transform),
+// vertex are added in chunks fitting an empty batch buffer, split on primitives boundaries
+void rlSubmitCommandBuffers(const rlCommandBuffer *buffers, int count)
+{
+    if (threadCommandBuffer != NULL)
     {
-        unsigned int mipSize = rlGetPixelDataSize(mipWidth, mipHeight, format);
+        TRACELOG(LOG_WARNING, "RLGL: Command buffers can not be submitted while recording");
+        return;
+    }
 
-        int glInternalFormat, glFormat, glType;
-        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    int layer = RLGL.State.drawLayer;
+    bool layerOrdered = RLGL.State.drawLayerOrdered;
 
-        TRACELOG(LOG_DEBUG, "TEXTURE: Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
+    for (int i = 0; i < count; i++)
+    {
+        const rlCommandBuffer *buffer = &buffers[i];
+        int first = 0;
 
-        if (glInternalFormat != -1)
+        for (int d = 0; d < buffer->drawCount; d++)
         {
-            if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, (unsigned char *)data + mipOffset);
-            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, (unsigned char *)data + mipOffset);
+            const rlDrawCall *draw = &buffer->draws[d];
 
-            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+            if (draw->vertexCount > 0)
             {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+                rlSetDrawLayer(draw->layer, draw->layerOrdered);
+                rlBegin(draw->mode);
+                rlSetTexture(draw->textureId);
+
+                // Chunk size is a multiple of LINES, TRIANGLES and QUADS primitive vertex (12)
+                int chunkSize = ((RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4 - 4)/12)*12;
+
+                for (int offset = first; offset < (first + draw->vertexCount); offset += chunkSize)
+                {
+                    int chunk = first + draw->vertexCount - offset;
+                    if (chunk > chunkSize) chunk = chunkSize;
+
+                    rlCheckRenderBatchLimit(chunk);
+                    rlVertexBulk(&buffer->vertices[3*offset], 3, &buffer->texcoords[2*offset], &buffer->colors[4*offset], chunk);
+                }
+
+                rlEnd();
             }
+
+            first += draw->vertexCount;
         }
+    }
 
-        mipWidth /= 2;
-        mipHeight /= 2;
-        mipOffset += mipSize;
+    rlSetDrawLayer(layer, layerOrdered);
+}
 
-        // Security check for NPOT textures
-        if (mipWidth < 1) mipWidth = 1;
-        if (mipHeight < 1) mipHeight = 1;
-    }
+// Enable GPU profiling zones
+void rlEnableGpuZones(void)
+{
+    if (RLGL.Profiler.enabled) return;
 
-    // Texture parameters configuration
-    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+    RLGL.Profiler.queries = (unsigned int *)RL_CALLOC(RL_GPU_ZONE_FRAMES*RL_MAX_GPU_ZONE_QUERIES*2, sizeof(unsigned int));
+    glGenQueries(RL_GPU_ZONE_FRAMES*RL_MAX_GPU_ZONE_QUERIES*2, RLGL.Profiler.queries);
 
-    // Magnification and minification filters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+    for (int i = 0; i < RL_GPU_ZONE_FRAMES; i++) RLGL.Profiler.queryCount[i] = 0;
+    RLGL.Profiler.frame = 0;
+    RLGL.Profiler.depth = 0;
+    RLGL.Profiler.zoneCount = 0;
+    RLGL.Profiler.enabled = true;
 
-    if (mipmapCount > 1)
+    TRACELOG(LOG_INFO, "RLGL: GPU profiling zones enabled (%i frames latency)", RL_GPU_ZONE_FRAMES);
+}
+
+// Disable GPU profiling zones
+void rlDisableGpuZones(void)
+{
+    if (!RLGL.Profiler.enabled) return;
+
+    glDeleteQueries(RL_GPU_ZONE_FRAMES*RL_MAX_GPU_ZONE_QUERIES*2, RLGL.Profiler.queries);
+    RL_FREE(RLGL.Profiler.queries);
+    RLGL.Profiler.queries = NULL;
+    RLGL.Profiler.enabled = false;
+}
+
+// Check if GPU profiling zones are enabled
+bool rlIsGpuZonesEnabled(void)
+{
+    return RLGL.Profiler.enabled;
+}
+
+// Begin GPU profiling zone
+// NOTE: Zones over RL_MAX_GPU_ZONES names, RL_MAX_GPU_ZONE_QUERIES per frame or RLGL_MAX_GPU_ZONE_DEPTH nesting are not measured
+void rlBeginGpuZone(const char *name)
+{
+    if (!RLGL.Profiler.enabled) return;
+    if (RLGL.Profiler.depth >= RLGL_MAX_GPU_ZONE_DEPTH) { RLGL.Profiler.depth++; return; }
+
+    int zoneId = -1;
+    for (int i = 0; i < RLGL.Profiler.zoneCount; i++)
     {
-        // Activate Trilinear filtering if mipmaps are available
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        if ((RLGL.Profiler.zones[i].name == name) || (strcmp(RLGL.Profiler.zones[i].name, name) == 0)) { zoneId = i; break; }
+    }
+    if ((zoneId == -1) && (RLGL.Profiler.zoneCount < RL_MAX_GPU_ZONES))
+    {
+        zoneId = RLGL.Profiler.zoneCount++;
+        RLGL.Profiler.zones[zoneId].name = name;
+        RLGL.Profiler.zones[zoneId].time = 0.0f;
+        RLGL.Profiler.zones[zoneId].count = 0;
     }
-    // At this point we have the texture loaded in GPU and texture parameters configured
-    // NOTE: If mipmaps were not in data, they are not generated automatically
-
-    // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
 
-    if (id > 0) TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
-    else TRACELOG(LOG_WARNING, "TEXTURE: Failed to load texture");
+    int frame = RLGL.Profiler.frame;
+    int pair = -1;
+    if ((zoneId != -1) && (RLGL.Profiler.queryCount[frame] < RL_MAX_GPU_ZONE_QUERIES))
+    {
+        pair = RLGL.Profiler.queryCount[frame]++;
+        RLGL.Profiler.zoneIds[frame][pair] = zoneId;
+        RLGL.Profiler.lastQuery[frame] = RLGL.Profiler.queries[(frame*RL_MAX_GPU_ZONE_QUERIES + pair)*2];
+        glQueryCounter(RLGL.Profiler.lastQuery[frame], GL_TIMESTAMP);
+    }
 
-    return id;
+    RLGL.Profiler.stack[RLGL.Profiler.depth++] = pair;
 }
 
-// Load depth texture/renderbuffer (to be attached to fbo)
-// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture/WEBGL_depth_texture extensions
-unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
+// End last begun GPU profiling zone
+void rlEndGpuZone(void)
 {
-    unsigned int id = 0;
+    if (!RLGL.Profiler.enabled || (RLGL.Profiler.depth == 0)) return;
 
-    // In case depth textures not supported, we force renderbuffer usage
-    if (!RLGL.ExtSupported.texDepth) useRenderBuffer = true;
+    RLGL.Profiler.depth--;
+    if (RLGL.Profiler.depth >= RLGL_MAX_GPU_ZONE_DEPTH) return;
 
-    // NOTE: We let the implementation to choose the best bit-depth
-    // Possible formats: GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT32 and GL_DEPTH_COMPONENT32F
-    unsigned int glInternalFormat = GL_DEPTH_COMPONENT;
-    if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
+    int frame = RLGL.Profiler.frame;
+    int pair = RLGL.Profiler.stack[RLGL.Profiler.depth];
+    if (pair >= 0)
     {
-        glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
-        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glBindTexture(GL_TEXTURE_2D, 0);
-        TRACELOG(LOG_INFO, "TEXTURE: Depth texture loaded successfully");
-    } else {
-        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
-        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
-        glGenRenderbuffers(1, &id);
-        glBindRenderbuffer(GL_RENDERBUFFER, id);
-        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
-        glBindRenderbuffer(GL_RENDERBUFFER, 0);
-        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
+        RLGL.Profiler.lastQuery[frame] = RLGL.Profiler.queries[(frame*RL_MAX_GPU_ZONE_QUERIES + pair)*2 + 1];
+        glQueryCounter(RLGL.Profiler.lastQuery[frame], GL_TIMESTAMP);
     }
-    return id;
 }
 
-// Load texture cubemap
-// NOTE: Cubemap data is expected to be 6 images in a single data array (one after the other),
-// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
-unsigned int rlLoadTextureCubemap(void *data, int size, int format)
+// End GPU zones frame and read back completed frames
+// NOTE: Oldest frame in flight is read back only if its queries are available, otherwise
+// its results are discarded (previous results are kept) to never stall waiting for the GPU
+void rlUpdateGpuZones(void)
 {
-    unsigned int id = 0;
-    unsigned int dataSize = rlGetPixelDataSize(size, size, format);
-    glGenTextures(1, &id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
-    int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
-    if (glInternalFormat != -1)
+    if (!RLGL.Profiler.enabled) return;
+
+    // Zones still open are ended at frame end, their rlEndGpuZone() does nothing
+    int frame = RLGL.Profiler.frame;
+    for (int i = 0; (i < RLGL.Profiler.depth) && (i < RLGL_MAX_GPU_ZONE_DEPTH); i++)
     {
-        // Load cubemap faces
-        for (unsigned int i = 0; i < 6; i++)
+        int pair = RLGL.Profiler.stack[i];
+        if (pair >= 0)
         {
-            if (data == NULL)
-            {
-                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
-                {
-                    if (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32)
-                    {
-                        // Instead of using a sized internal texture format (GL_RGB16F, GL_RGB32F), we let the driver to choose the better format for us (GL_RGB)
-                        if (RLGL.ExtSupported.texFloat32) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
-                        else TRACELOG(LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
-                    }
-                    else if ((format == RL_PIXELFORMAT_UNCOMPRESSED_R32) || (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
-                    else glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, NULL);
-                }
-                else TRACELOG(LOG_WARNING, "TEXTURES: Empty cubemap creation does not support compressed format");
-            }
-            else
+            RLGL.Profiler.lastQuery[frame] = RLGL.Profiler.queries[(frame*RL_MAX_GPU_ZONE_QUERIES + pair)*2 + 1];
+            glQueryCounter(RLGL.Profiler.lastQuery[frame], GL_TIMESTAMP);
+        }
+        RLGL.Profiler.stack[i] = -1;
+    }
+
+    // Move to next frame in flight, the oldest one
+    frame = (frame + 1)%RL_GPU_ZONE_FRAMES;
+    RLGL.Profiler.frame = frame;
+
+    int count = RLGL.Profiler.queryCount[frame];
+    if (count > 0)
+    {
+        unsigned int *queries = RLGL.Profiler.queries + frame*RL_MAX_GPU_ZONE_QUERIES*2;
+
+        // Queries complete in issue order, last one issued available means all of them are
+        // NOTE: Last pair allocated is not the last issued, outer zones end after the inner ones
+        GLint available = 0;
+        glGetQueryObjectiv(RLGL.Profiler.lastQuery[frame], GL_QUERY_RESULT_AVAILABLE, &available);
+
+        if (available)
+        {
+            for (int i = 0; i < RLGL.Profiler.zoneCount; i++)
             {
-                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
-                else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
+                RLGL.Profiler.zones[i].time = 0.0f;
+                RLGL.Profiler.zones[i].count = 0;
             }
-            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+
+            for (int i = 0; i < count; i++)
             {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+                GLuint64 begin = 0, end = 0;
+                glGetQueryObjectui64v(queries[i*2], GL_QUERY_RESULT, &begin);
+                glGetQueryObjectui64v(queries[i*2 + 1], GL_QUERY_RESULT, &end);
+
+                rlGpuZone *zone = &RLGL.Profiler.zones[RLGL.Profiler.zoneIds[frame][i]];
+                if (end > begin) zone->time += (float)((double)(end - begin)/1000000.0);
+                zone->count++;
             }
         }
     }
 
-    // Set cubemap texture sampling parameters
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
-    if (id > 0) TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
-    else TRACELOG(LOG_WARNING, "TEXTURE: Failed to load cubemap texture");
-    return id;
+    RLGL.Profiler.queryCount[frame] = 0;
 }
 
-// Update already loaded texture in GPU with new data
-// NOTE: We don't know safely if internal texture format is the expected one...
-void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
+// Get GPU zones results of last completed frame
+rlGpuZone *rlGetGpuZones(int *count)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
-    int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
-    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
-        glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, (unsigned char *)data);
-    else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
+    if (count != NULL) *count = RLGL.Profiler.zoneCount;
+    return RLGL.Profiler.zones;
 }
 
-// Get OpenGL internal formats and data type from raylib PixelFormat
-void rlGetGlTextureFormats(int format, int *glInternalFormat, int *glFormat, int *glType)
+// Get GPU zone time of last completed frame (milliseconds)
+float rlGetGpuZoneTime(const char *name)
 {
-    *glInternalFormat = -1;
-    *glFormat = -1;
-    *glType = -1;
-    switch (format)
+    for (int i = 0; i < RLGL.Profiler.zoneCount; i++)
     {
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: if (RLGL.ExtSupported.texCompETC1) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-        default: TRACELOG(LOG_WARNING, "TEXTURE: Current format not supported (%i)", format); break;
+        if (strcmp(RLGL.Profiler.zones[i].name, name) == 0) return RLGL.Profiler.zones[i].time;
     }
+    return 0.0f;
 }
 
-// Unload texture from GPU memory
-void rlUnloadTexture(unsigned int id)
+// Begin display list recording
+// NOTE: Current batch is drawn first, following batch geometry (rlBegin()/rlVertex*()/rlEnd()) is captured
+// with its textures and modes until rlEndRecord(), shader and matrices are the ones active on rlDrawDisplayList()
+void rlBeginRecord(void)
 {
-    glDeleteTextures(1, &id);
+    if (RLGL.Record.active)
+    {
+        TRACELOG(LOG_WARNING, "RLGL: Display list recording already active");
+        return;
+    }
+
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    RLGL.Record.active = true;
+    RLGL.Record.vertexCount = 0;
+    RLGL.Record.indexCount = 0;
+    RLGL.Record.drawCount = 0;
 }
 
-// Generate mipmap data for selected texture
-void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
+// End display list recording and upload captured geometry to VRAM (GPU)
+rlDisplayList rlEndRecord(void)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlDisplayList list = { 0 };
 
-    // Check if texture is power-of-two (POT)
-    bool texIsPOT = false;
+    if (!RLGL.Record.active)
+    {
+        TRACELOG(LOG_WARNING, "RLGL: Display list recording not active");
+        return list;
+    }
 
-    if (((width > 0) && ((width & (width - 1)) == 0)) &&
-        ((height > 0) && ((height & (height - 1)) == 0))) texIsPOT = true;
+    rlDrawRenderBatch(RLGL.currentBatch);   // Capture remaining batch geometry
+    RLGL.Record.active = false;
 
-    if ((texIsPOT) || (RLGL.ExtSupported.texNPOT))
+    if (RLGL.Record.drawCount > 0)
     {
-        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorythm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
-        glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
+        list.vertexCount = RLGL.Record.vertexCount;
+        list.drawCount = RLGL.Record.drawCount;
+        list.draws = (rlDisplayListDraw *)RL_MALLOC(RLGL.Record.drawCount*sizeof(rlDisplayListDraw));
+        memcpy(list.draws, RLGL.Record.draws, RLGL.Record.drawCount*sizeof(rlDisplayListDraw));
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);   // Activate Trilinear filtering for mipmaps
+        if (RLGL.ExtSupported.vao)
+        {
+            glGenVertexArrays(1, &list.vaoId);
+            rlCacheBindVertexArray(list.vaoId);
+        }
 
-        #define MIN(a,b) (((a)<(b))?(a):(b))
-        #define MAX(a,b) (((a)>(b))?(a):(b))
+        glGenBuffers(1, &list.vboId[0]);
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, list.vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, RLGL.Record.vertexCount*sizeof(rlBatchVertex), RLGL.Record.vertices, GL_STATIC_DRAW);
 
-        *mipmaps = 1 + (int)floor(log(MAX(width, height))/log(2));
-        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
-    }
-    else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
+        glGenBuffers(1, &list.vboId[1]);
+        rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, list.vboId[1]);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, RLGL.Record.indexCount*sizeof(unsigned int), RLGL.Record.indices, GL_STATIC_DRAW);
+
+        if (RLGL.ExtSupported.vao)
+        {
+            rlSetInterleavedVertexAttributes(list.vboId[0]);
+            rlCacheBindVertexArray(0);
+        }
+
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, 0);
+        rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+        TRACELOG(LOG_INFO, "RLGL: Display list recorded successfully (%i vertex, %i draws)", list.vertexCount, list.drawCount);
+    }
+    else TRACELOG(LOG_WARNING, "RLGL: Display list recorded without geometry");
+
+    // Captured data is already in VRAM, release RAM
+    RL_FREE(RLGL.Record.vertices);
+    RL_FREE(RLGL.Record.indices);
+    RL_FREE(RLGL.Record.draws);
+    RLGL.Record.vertices = NULL;
+    RLGL.Record.indices = NULL;
+    RLGL.Record.draws = NULL;
+    RLGL.Record.vertexCapacity = 0;
+    RLGL.Record.indexCapacity = 0;
+    RLGL.Record.drawCapacity = 0;
+
+    return list;
 }
 
-// Read texture pixel data
-void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
+// Draw display list with a transform, using current shader and modelview/projection matrices
+// NOTE: Current batch is drawn first to keep drawing order
+void rlDrawDisplayList(rlDisplayList list, Matrix transform)
 {
-    void *pixels = NULL;
-    glBindTexture(GL_TEXTURE_2D, id);
+    if (list.drawCount == 0) return;
+    if (RLGL.Record.active)
+    {
+        TRACELOG(LOG_WARNING, "RLGL: Display list can not be drawn while recording");
+        return;
+    }
 
-    // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
-    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
-    //int width, height, format;
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+    rlDrawRenderBatch(RLGL.currentBatch);
 
-    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding.
-    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting.
-    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
-    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
-    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    Matrix matModelView = MatrixMultiply(transform, RLGL.State.modelview);
 
-    int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
-    unsigned int size = rlGetPixelDataSize(width, height, format);
+    int eyeCount = 1;
+    if (RLGL.State.stereoRender) eyeCount = 2;
 
-    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    rlCacheUseProgram(RLGL.State.currentShaderId);
+
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(list.vaoId);
+    else
     {
-        pixels = RL_MALLOC(size);
-        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
+        rlSetInterleavedVertexAttributes(list.vboId[0]);
+        rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, list.vboId[1]);
     }
-    else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
-    glBindTexture(GL_TEXTURE_2D, 0);
-    return pixels;
-}
-
-// Read screen pixel data (color buffer)
-unsigned char *rlReadScreenPixels(int width, int height)
-{
-    unsigned char *screenData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
-
-    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
-    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
 
-    // Flip image vertically!
-    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
+    // Setup some default shader values
+    glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+    glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);
+    rlCacheActiveTexture(0);
 
-    for (int y = height - 1; y >= 0; y--)
+    for (int eye = 0; eye < eyeCount; eye++)
     {
-        for (int x = 0; x < (width*4); x++)
+        Matrix matMVP = { 0 };
+
+        if (eyeCount == 2)
         {
-            imgData[((height - 1) - y)*width*4 + x] = screenData[(y*width*4) + x];  // Flip line
+            // Setup current eye viewport (half screen width) and eye matrices
+            rlViewport(eye*RLGL.State.framebufferWidth/2, 0, RLGL.State.framebufferWidth/2, RLGL.State.framebufferHeight);
+            matMVP = MatrixMultiply(MatrixMultiply(matModelView, RLGL.State.viewOffsetStereo[eye]), RLGL.State.projectionStereo[eye]);
+        }
+        else matMVP = MatrixMultiply(matModelView, RLGL.State.projection);
+
+        glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, MatrixToFloat(matMVP));
 
-            // Set alpha component value to 255 (no trasparent image retrieval)
-            // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
-            if (((x + 1)%4) == 0) imgData[((height - 1) - y)*width*4 + x] = 255;
+        for (int i = 0; i < list.drawCount; i++)
+        {
+            rlCacheBindTexture(GL_TEXTURE_2D, list.draws[i].textureId);
+            glDrawElements(list.draws[i].mode, list.draws[i].indexCount, GL_UNSIGNED_INT, (GLvoid *)(list.draws[i].indexOffset*sizeof(GLuint)));
+            RLGL.State.batchStats.drawCallCount++;
         }
     }
 
-    RL_FREE(screenData);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
 
-    return imgData;     // NOTE: image data should be freed
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
+    else
+    {
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, 0);
+        rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+
+    rlCacheUseProgram(0);
 }
 
-// Framebuffer management (fbo)
-//-----------------------------------------------------------------------------------------
-// Load a framebuffer to be used for rendering
-// NOTE: No textures attached
-unsigned int rlLoadFramebuffer(int width, int height)
+// Unload display list from VRAM (GPU) and RAM
+void rlUnloadDisplayList(rlDisplayList list)
 {
-    unsigned int fboId = 0;
-
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glGenFramebuffers(1, &fboId);       // Create the framebuffer object
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
-#endif
-
-    return fboId;
+    if (RLGL.ExtSupported.vao) rlCacheDeleteVertexArrays(1, &list.vaoId);
+    rlCacheDeleteBuffers(2, list.vboId);
+    RL_FREE(list.draws);
 }
 
-// Attach color buffer texture to an fbo (unloads previous attachment)
-// NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
-void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel)
+// Begin command trace capture into a file
+// NOTE: Pending batch vertex are drawn first, current matrices, viewport and blend mode are written as trace start state
+bool rlBeginTraceCapture(const char *fileName)
 {
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+    if (RLGL.Trace.file != NULL) rlEndTraceCapture();
 
-    switch (attachType)
+    FILE *file = fopen(fileName, "wb");
+    if (file == NULL)
     {
-        case RL_ATTACHMENT_COLOR_CHANNEL0:
-        case RL_ATTACHMENT_COLOR_CHANNEL1:
-        case RL_ATTACHMENT_COLOR_CHANNEL2:
-        case RL_ATTACHMENT_COLOR_CHANNEL3:
-        case RL_ATTACHMENT_COLOR_CHANNEL4:
-        case RL_ATTACHMENT_COLOR_CHANNEL5:
-        case RL_ATTACHMENT_COLOR_CHANNEL6:
-        case RL_ATTACHMENT_COLOR_CHANNEL7:
-        {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER) glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_RENDERBUFFER, texId);
-            else if (texType >= RL_ATTACHMENT_CUBEMAP_POSITIVE_X) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_CUBE_MAP_POSITIVE_X + texType, texId, mipLevel);
+        TRACELOG(LOG_WARNING, "RLGL: [%s] Failed to open command trace file", fileName);
+        return false;
+    }
 
-        } break;
-        case RL_ATTACHMENT_DEPTH:
-        {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, texId);
+    rlDrawRenderBatch(RLGL.currentBatch);
+    if (RLGL.State.stackCounter > 0) TRACELOG(LOG_WARNING, "RLGL: Command trace capture started with pushed matrices, replay could differ");
 
-        } break;
-        case RL_ATTACHMENT_STENCIL:
-        {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, texId);
+    RLGL.Trace.file = file;
+    RLGL.Trace.textureCount = 0;
+    RLGL.Trace.frameCount = 0;
 
-        } break;
-        default: break;
-    }
+    rlTraceHeader header = { { 'r', 'l', 'T', 'R' }, RLGL_TRACE_VERSION, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight,
+        RLGL.State.defaultTextureId, RLGL.State.defaultShaderId };
+    fwrite(&header, sizeof(rlTraceHeader), 1, file);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-#endif
-}
+    int viewport[4] = { 0 };
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    rlTraceCommand(RLGL_TRACE_VIEWPORT, viewport, 4*sizeof(int));
+    rlTraceCommand(RLGL_TRACE_SET_PROJECTION, &RLGL.State.projection, sizeof(Matrix));
+    rlTraceCommand(RLGL_TRACE_SET_MODELVIEW, &RLGL.State.modelview, sizeof(Matrix));
+    rlTraceCommand(RLGL_TRACE_MATRIX_MODE, &RLGL.State.currentMatrixMode, sizeof(int));
+    rlTraceCommand(RLGL_TRACE_BLEND_MODE, &RLGL.State.currentBlendMode, sizeof(int));
 
-// Verify render texture is complete
-bool rlFramebufferComplete(unsigned int id)
-{
-    bool result = false;
-    glBindFramebuffer(GL_FRAMEBUFFER, id);
-    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
-    if (status != GL_FRAMEBUFFER_COMPLETE) {
-        switch (status) {
-            case GL_FRAMEBUFFER_UNSUPPORTED: TRACELOG(LOG_WARNING, "FBO: [ID %i] Framebuffer is unsupported", id); break;
-            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: TRACELOG(LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete attachment", id); break;
-            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: TRACELOG(LOG_WARNING, "FBO: [ID %i] Framebuffer has a missing attachment", id); break;
-            default: break;
-        }
-    }
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    result = (status == GL_FRAMEBUFFER_COMPLETE);
-    return result;
+    TRACELOG(LOG_INFO, "RLGL: [%s] Command trace capture started", fileName);
+
+    return true;
 }
 
-// Unload framebuffer from GPU memory
-// NOTE: All attached textures/cubemaps/renderbuffers are also deleted
-void rlUnloadFramebuffer(unsigned int id)
+// End command trace capture, trace file is closed
+void rlEndTraceCapture(void)
 {
-    // Query depth attachment to automatically delete texture/renderbuffer
-    int depthType = 0, depthId = 0;
-    glBindFramebuffer(GL_FRAMEBUFFER, id);   // Bind framebuffer to query depth texture type
-    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &depthType);
-    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &depthId);
+    if (RLGL.Trace.file == NULL) return;
 
-    unsigned int depthIdU = (unsigned int)depthId;
-    if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_RENDERBUFFER) glDeleteTextures(1, &depthIdU);
-    // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
-    // the texture image is automatically detached from the currently bound framebuffer.
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glDeleteFramebuffers(1, &id);
-    TRACELOG(LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
-}
+    fclose(RLGL.Trace.file);
+    RLGL.Trace.file = NULL;
 
-// Vertex data management
-//-----------------------------------------------------------------------------------------
-// Load a new attributes buffer
-unsigned int rlLoadVertexBuffer(void *buffer, int size, bool dynamic)
-{
-    unsigned int id = 0;
-    glGenBuffers(1, &id);
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-    glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
-    return id;
-}
+    RL_FREE(RLGL.Trace.textureIds);
+    RLGL.Trace.textureIds = NULL;
+    RLGL.Trace.textureCount = 0;
+    RLGL.Trace.textureCapacity = 0;
 
-// Load a new attributes element buffer
-unsigned int rlLoadVertexBufferElement(void *buffer, int size, bool dynamic)
-{
-    unsigned int id = 0;
-    glGenBuffers(1, &id);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
-    return id;
+    TRACELOG(LOG_INFO, "RLGL: Command trace capture finished (%i frames)", RLGL.Trace.frameCount);
 }
 
-// Enable vertex buffer (VBO)
-void rlEnableVertexBuffer(unsigned int id)
+// Check if command trace capture is active
+bool rlIsTraceCapturing(void)
 {
-    glBindBuffer(GL_ARRAY_BUFFER, id);
+    return (RLGL.Trace.file != NULL);
 }
 
-// Disable vertex buffer (VBO)
-void rlDisableVertexBuffer(void)
+// Mark end of frame on command trace
+void rlTraceFrame(void)
 {
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    if (RLGL_TRACE_ACTIVE)
+    {
+        rlTraceCommand(RLGL_TRACE_FRAME, NULL, 0);
+        RLGL.Trace.frameCount++;
+    }
 }
 
-// Enable vertex buffer element (VBO element)
-void rlEnableVertexBufferElement(unsigned int id)
+// Replay command trace frames, as fast as possible
+// NOTE: Textures and shaders loaded by the trace are kept across loops and unloaded at the end,
+// textures loaded before capture are replayed from their captured pixels, shaders loaded before capture
+// are replaced by default shader, render batch statistics are reset
+rlTraceStats rlReplayTrace(const char *fileName, int loops)
 {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
-}
+    rlTraceStats stats = { 0 };
 
-// Disable vertex buffer element (VBO element)
-void rlDisableVertexBufferElement(void)
-{
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-}
+    if (RLGL.Trace.file != NULL)
+    {
+        TRACELOG(LOG_WARNING, "RLGL: Command trace can not be replayed while capturing");
+        return stats;
+    }
 
-// Update vertex buffer with new data
-// NOTE: dataSize and offset must be provided in bytes
-void rlUpdateVertexBuffer(unsigned int id, void *data, int dataSize, int offset)
-{
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-    glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
-}
+    unsigned int fileSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+    if (fileData == NULL) return stats;
 
-// Update vertex buffer elements with new data
-// NOTE: dataSize and offset must be provided in bytes
-void rlUpdateVertexBufferElements(unsigned int id, void *data, int dataSize, int offset)
-{
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
-    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
-}
+    rlTraceHeader header = { 0 };
+    if (fileSize >= sizeof(rlTraceHeader)) memcpy(&header, fileData, sizeof(rlTraceHeader));
 
-// Enable vertex array object (VAO)
-bool rlEnableVertexArray(unsigned int vaoId)
-{
-    bool result = false;
+    if ((memcmp(header.signature, "rlTR", 4) != 0) || (header.version != RLGL_TRACE_VERSION))
+    {
+        TRACELOG(LOG_WARNING, "RLGL: [%s] Command trace file not valid or version not supported", fileName);
+        UnloadFileData(fileData);
+        return stats;
+    }
+
+    rlTraceResource *textures = (rlTraceResource *)RL_CALLOC(RLGL_TRACE_MAX_RESOURCES, sizeof(rlTraceResource));
+    rlTraceResource *shaders = (rlTraceResource *)RL_CALLOC(RLGL_TRACE_MAX_RESOURCES, sizeof(rlTraceResource));
+    int textureCount = 0;
+    int shaderCount = 0;
+
+    const unsigned char *end = fileData + fileSize;
+    bool valid = true;
+
+    rlDrawRenderBatch(RLGL.currentBatch);
+    rlResetRenderBatchStats();
+
+    for (int loop = 0; (loop < loops) && valid; loop++)
+    {
+        const unsigned char *data = fileData + sizeof(rlTraceHeader);
+
+        rlSetShader(RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs);
+        double frameStart = GetTime();
+
+        while ((data < end) && valid)
+        {
+            int type = 0;
+            int values[8] = { 0 };
+            float floats[16] = { 0 };
+            double doubles[6] = { 0 };
+            Matrix mat = { 0 };
+
+            valid = rlTraceRead(&data, end, &type, sizeof(int));
+
+            switch (type)
+            {
+                case RLGL_TRACE_FRAME:
+                {
+                    double frameTime = GetTime() - frameStart;
+
+                    if ((stats.frameCount == 0) || (frameTime < stats.frameTimeMin)) stats.frameTimeMin = frameTime;
+                    if (frameTime > stats.frameTimeMax) stats.frameTimeMax = frameTime;
+                    stats.cpuTime += frameTime;
+                    stats.frameCount++;
+
+                    stats.drawCallCount += RLGL.State.batchStats.drawCallCount;
+                    stats.flushCount += RLGL.State.batchStats.flushCount;
+                    stats.vertexCount += RLGL.State.batchStats.vertexCount;
+                    rlResetRenderBatchStats();
+
+                    frameStart = GetTime();
+                } break;
+                case RLGL_TRACE_MATRIX_MODE: if ((valid = rlTraceRead(&data, end, values, sizeof(int)))) rlMatrixMode(values[0]); break;
+                case RLGL_TRACE_PUSH_MATRIX: rlPushMatrix(); break;
+                case RLGL_TRACE_POP_MATRIX: rlPopMatrix(); break;
+                case RLGL_TRACE_LOAD_IDENTITY: rlLoadIdentity(); break;
+                case RLGL_TRACE_TRANSLATE: if ((valid = rlTraceRead(&data, end, floats, 3*sizeof(float)))) rlTranslatef(floats[0], floats[1], floats[2]); break;
+                case RLGL_TRACE_ROTATE: if ((valid = rlTraceRead(&data, end, floats, 4*sizeof(float)))) rlRotatef(floats[0], floats[1], floats[2], floats[3]); break;
+                case RLGL_TRACE_SCALE: if ((valid = rlTraceRead(&data, end, floats, 3*sizeof(float)))) rlScalef(floats[0], floats[1], floats[2]); break;
+                case RLGL_TRACE_MULT_MATRIX: if ((valid = rlTraceRead(&data, end, floats, 16*sizeof(float)))) rlMultMatrixf(floats); break;
+                case RLGL_TRACE_FRUSTUM: if ((valid = rlTraceRead(&data, end, doubles, 6*sizeof(double)))) rlFrustum(doubles[0], doubles[1], doubles[2], doubles[3], doubles[4], doubles[5]); break;
+                case RLGL_TRACE_ORTHO: if ((valid = rlTraceRead(&data, end, doubles, 6*sizeof(double)))) rlOrtho(doubles[0], doubles[1], doubles[2], doubles[3], doubles[4], doubles[5]); break;
+                case RLGL_TRACE_VIEWPORT: if ((valid = rlTraceRead(&data, end, values, 4*sizeof(int)))) rlViewport(values[0], values[1], values[2], values[3]); break;
+                case RLGL_TRACE_SET_MODELVIEW: if ((valid = rlTraceRead(&data, end, &mat, sizeof(Matrix)))) rlSetMatrixModelview(mat); break;
+                case RLGL_TRACE_SET_PROJECTION: if ((valid = rlTraceRead(&data, end, &mat, sizeof(Matrix)))) rlSetMatrixProjection(mat); break;
+                case RLGL_TRACE_BEGIN: if ((valid = rlTraceRead(&data, end, values, sizeof(int)))) rlBegin(values[0]); break;
+                case RLGL_TRACE_END: rlEnd(); break;
+                case RLGL_TRACE_VERTEX: if ((valid = rlTraceRead(&data, end, floats, 3*sizeof(float)))) rlVertex3f(floats[0], floats[1], floats[2]); break;
+                case RLGL_TRACE_VERTEX_BULK:
+                {
+                    if (!(valid = rlTraceRead(&data, end, values, 3*sizeof(int)))) break;
+                    if (!(valid = (((values[0] == 2) || (values[0] == 3)) && (values[1] >= 0) && (values[1] <= INT_MAX/16) && ((values[2] & ~3) == 0)))) break;
+
+                    // NOTE: Vertex data is used in place, records data is 4 bytes aligned
+                    const float *positions = (const float *)data;
+                    valid = rlTraceRead(&data, end, NULL, values[1]*values[0]*sizeof(float));
+                    const float *texcoords = (values[2] & 1)? (const float *)data : NULL;
+                    if (valid && (texcoords != NULL)) valid = rlTraceRead(&data, end, NULL, values[1]*2*sizeof(float));
+                    const unsigned char *colors = (values[2] & 2)? data : NULL;
+                    if (valid && (colors != NULL)) valid = rlTraceRead(&data, end, NULL, values[1]*4);
+
+                    if (valid) rlVertexBulk(positions, values[0], texcoords, colors, values[1]);
+                } break;
+                case RLGL_TRACE_TEXCOORD: if ((valid = rlTraceRead(&data, end, floats, 2*sizeof(float)))) rlTexCoord2f(floats[0], floats[1]); break;
+                case RLGL_TRACE_NORMAL: if ((valid = rlTraceRead(&data, end, floats, 3*sizeof(float)))) rlNormal3f(floats[0], floats[1], floats[2]); break;
+                case RLGL_TRACE_COLOR:
+                {
+                    unsigned char color[4] = { 0 };
+                    if ((valid = rlTraceRead(&data, end, color, 4))) rlColor4ub(color[0], color[1], color[2], color[3]);
+                } break;
+                case RLGL_TRACE_SET_TEXTURE:
+                case RLGL_TRACE_TEXTURE_PARAMETERS:
+                case RLGL_TRACE_UPDATE_TEXTURE:
+                case RLGL_TRACE_GEN_MIPMAPS:
+                case RLGL_TRACE_SET_UNIFORM_SAMPLER:
+                {
+                    int count = 1;
+                    if (type == RLGL_TRACE_TEXTURE_PARAMETERS) count = 3;
+                    else if (type == RLGL_TRACE_UPDATE_TEXTURE) count = 7;
+                    else if (type == RLGL_TRACE_GEN_MIPMAPS) count = 4;
+                    else if (type == RLGL_TRACE_SET_UNIFORM_SAMPLER) count = 2;
+                    if (!(valid = rlTraceRead(&data, end, values, count*sizeof(int)))) break;
+
+                    // Captured texture id mapped to replay texture id (texture id is second value for uniform sampler)
+                    unsigned int traceId = (type == RLGL_TRACE_SET_UNIFORM_SAMPLER)? (unsigned int)values[1] : (unsigned int)values[0];
+                    unsigned int id = RLGL.State.defaultTextureId;
+                    rlTraceResource *texture = rlTraceGetResource(textures, textureCount, traceId);
+                    if (traceId == 0) id = 0;
+                    else if (texture != NULL) id = texture->id;
+
+                    if (type == RLGL_TRACE_SET_TEXTURE) rlSetTexture(id);
+                    else if (type == RLGL_TRACE_TEXTURE_PARAMETERS) rlTextureParameters(id, values[1], values[2]);
+                    else if (type == RLGL_TRACE_GEN_MIPMAPS) rlGenTextureMipmaps(id, values[1], values[2], values[3], &values[4]);
+                    else if (type == RLGL_TRACE_SET_UNIFORM_SAMPLER) rlSetUniformSampler(values[0], id);
+                    else
+                    {
+                        const void *pixels = data;
+                        if (!(valid = ((values[5] < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (values[6] == rlTraceTextureDataSize(values[3], values[4], values[5], 1))))) break;
+                        if ((valid = rlTraceRead(&data, end, NULL, values[6]))) rlUpdateTexture(id, values[1], values[2], values[3], values[4], values[5], pixels);
+                    }
+                } break;
+                case RLGL_TRACE_DRAW_BATCH: rlDrawRenderBatchActive(); break;
+                case RLGL_TRACE_CHECK_LIMIT: if ((valid = rlTraceRead(&data, end, values, sizeof(int)))) rlCheckRenderBatchLimit(values[0]); break;
+                case RLGL_TRACE_DRAW_SORTING:
+                {
+                    if (!(valid = rlTraceRead(&data, end, values, sizeof(int)))) break;
+                    if (values[0]) rlEnableDrawSorting();
+                    else rlDisableDrawSorting();
+                } break;
+                case RLGL_TRACE_DRAW_LAYER: if ((valid = rlTraceRead(&data, end, values, 2*sizeof(int)))) rlSetDrawLayer(values[0], values[1]); break;
+                case RLGL_TRACE_STATE:
+                {
+                    if (!(valid = rlTraceRead(&data, end, values, 2*sizeof(int)))) break;
+
+                    switch (values[0])
+                    {
+                        case RLGL_TRACE_STATE_BLEND: if (values[1]) rlEnableColorBlend(); else rlDisableColorBlend(); break;
+                        case RLGL_TRACE_STATE_DEPTH_TEST: if (values[1]) rlEnableDepthTest(); else rlDisableDepthTest(); break;
+                        case RLGL_TRACE_STATE_DEPTH_MASK: if (values[1]) rlEnableDepthMask(); else rlDisableDepthMask(); break;
+                        case RLGL_TRACE_STATE_CULL_FACE: if (values[1]) rlEnableBackfaceCulling(); else rlDisableBackfaceCulling(); break;
+                        case RLGL_TRACE_STATE_SCISSOR_TEST: if (values[1]) rlEnableScissorTest(); else rlDisableScissorTest(); break;
+                        case RLGL_TRACE_STATE_WIRE_MODE: if (values[1]) rlEnableWireMode(); else rlDisableWireMode(); break;
+                        case RLGL_TRACE_STATE_SMOOTH_LINES: if (values[1]) rlEnableSmoothLines(); else rlDisableSmoothLines(); break;
+                        default: break;
+                    }
+                } break;
+                case RLGL_TRACE_SCISSOR: if ((valid = rlTraceRead(&data, end, values, 4*sizeof(int)))) rlScissor(values[0], values[1], values[2], values[3]); break;
+                case RLGL_TRACE_LINE_WIDTH: if ((valid = rlTraceRead(&data, end, floats, sizeof(float)))) rlSetLineWidth(floats[0]); break;
+                case RLGL_TRACE_CLEAR_COLOR:
+                {
+                    unsigned char color[4] = { 0 };
+                    if ((valid = rlTraceRead(&data, end, color, 4))) rlClearColor(color[0], color[1], color[2], color[3]);
+                } break;
+                case RLGL_TRACE_CLEAR_SCREEN: rlClearScreenBuffers(); break;
+                case RLGL_TRACE_BLEND_MODE: if ((valid = rlTraceRead(&data, end, values, sizeof(int)))) rlSetBlendMode(values[0]); break;
+                case RLGL_TRACE_BLEND_FACTORS: if ((valid = rlTraceRead(&data, end, values, 3*sizeof(int)))) rlSetBlendFactors(values[0], values[1], values[2]); break;
+                case RLGL_TRACE_LOAD_TEXTURE:
+                {
+                    if (!(valid = rlTraceRead(&data, end, values, 6*sizeof(int)))) break;
+
+                    // Texture data is optional, but it must contain all the mipmaps if available
+                    int size = rlTraceTextureDataSize(values[1], values[2], values[3], values[4]);
+                    if (!(valid = ((size >= 0) && ((values[5] == 0) || (values[5] == size))))) break;
+
+                    const void *pixels = (values[5] > 0)? data : NULL;
+                    if (!(valid = rlTraceRead(&data, end, NULL, values[5]))) break;
+
+                    // Textures loaded on previous loops are reused
+                    if (rlTraceGetResource(textures, textureCount, values[0]) != NULL) break;
+
+                    if (textureCount < RLGL_TRACE_MAX_RESOURCES)
+                    {
+                        textures[textureCount].traceId = values[0];
+                        textures[textureCount].id = rlLoadTexture((void *)pixels, values[1], values[2], values[3], values[4]);
+                        textureCount++;
+                    }
+                    else TRACELOG(LOG_WARNING, "RLGL: Command trace replay textures limit reached (RLGL_TRACE_MAX_RESOURCES)");
+                } break;
+                case RLGL_TRACE_UNLOAD_TEXTURE:
+                {
+                    if (!(valid = rlTraceRead(&data, end, values, sizeof(int)))) break;
+
+                    rlTraceResource *texture = rlTraceGetResource(textures, textureCount, values[0]);
+                    if (texture != NULL)
+                    {
+                        rlUnloadTexture(texture->id);
+                        *texture = textures[textureCount - 1];
+                        textureCount--;
+                    }
+                } break;
+                case RLGL_TRACE_LOAD_SHADER:
+                {
+                    if (!(valid = rlTraceRead(&data, end, values, 3*sizeof(int)))) break;
+
+                    const char *vsCode = (values[1] > 0)? (const char *)data : NULL;
+                    if (!(valid = rlTraceRead(&data, end, NULL, values[1]))) break;
+                    const char *fsCode = (values[2] > 0)? (const char *)data : NULL;
+                    if (!(valid = rlTraceRead(&data, end, NULL, values[2]))) break;
+
+                    // Code strings must be null terminated
+                    if (!(valid = (((vsCode == NULL) || (vsCode[values[1] - 1] == '\0')) && ((fsCode == NULL) || (fsCode[values[2] - 1] == '\0'))))) break;
+
+                    // Shaders loaded on previous loops are reused
+                    if (rlTraceGetResource(shaders, shaderCount, values[0]) != NULL) break;
+
+                    if (shaderCount < RLGL_TRACE_MAX_RESOURCES)
+                    {
+                        shaders[shaderCount].traceId = values[0];
+                        shaders[shaderCount].id = rlLoadShaderCode(vsCode, fsCode);
+                        shaders[shaderCount].locs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+                        shaderCount++;
+                    }
+                    else TRACELOG(LOG_WARNING, "RLGL: Command trace replay shaders limit reached (RLGL_TRACE_MAX_RESOURCES)");
+                } break;
+                case RLGL_TRACE_UNLOAD_SHADER:
+                {
+                    if (!(valid = rlTraceRead(&data, end, values, sizeof(int)))) break;
+
+                    rlTraceResource *shader = rlTraceGetResource(shaders, shaderCount, values[0]);
+                    if (shader != NULL)
+                    {
+                        if (RLGL.State.currentShaderId == shader->id) rlSetShader(RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs);
+                        rlUnloadShaderProgram(shader->id);
+                        RL_FREE(shader->locs);
+                        *shader = shaders[shaderCount - 1];
+                        shaderCount--;
+                    }
+                } break;
+                case RLGL_TRACE_SET_SHADER:
+                case RLGL_TRACE_ENABLE_SHADER:
+                {
+                    if (!(valid = rlTraceRead(&data, end, values, sizeof(int)))) break;
+
+                    // Captured shader id mapped to replay shader id, shaders not loaded by the trace use default shader
+                    rlTraceResource *shader = rlTraceGetResource(shaders, shaderCount, values[0]);
+                    unsigned int id = (shader != NULL)? shader->id : RLGL.State.defaultShaderId;
+
+                    if (type == RLGL_TRACE_ENABLE_SHADER) rlEnableShader(id);
+                    else
+                    {
+                        int *locs = RLGL.State.defaultShaderLocs;
+                        if (shader != NULL)
+                        {
+                            valid = rlTraceRead(&data, end, shader->locs, RL_MAX_SHADER_LOCATIONS*sizeof(int));
+                            locs = shader->locs;
+                        }
+                        else valid = rlTraceRead(&data, end, NULL, RL_MAX_SHADER_LOCATIONS*sizeof(int));
+
+                        if (valid) rlSetShader(id, locs);
+                    }
+                } break;
+                case RLGL_TRACE_DISABLE_SHADER: rlDisableShader(); break;
+                case RLGL_TRACE_SET_UNIFORM:
+                {
+                    if (!(valid = rlTraceRead(&data, end, values, 4*sizeof(int)))) break;
+                    if (!(valid = (values[3] == rlTraceUniformDataSize(values[1], values[2])))) break;
+
+                    const void *value = data;
+                    if ((valid = rlTraceRead(&data, end, NULL, values[3]))) rlSetUniform(values[0], value, values[1], values[2]);
+                } break;
+                case RLGL_TRACE_SET_UNIFORM_MATRIX:
+                {
+                    if ((valid = rlTraceRead(&data, end, values, sizeof(int)) && rlTraceRead(&data, end, &mat, sizeof(Matrix)))) rlSetUniformMatrix(values[0], mat);
+                } break;
+                default: valid = false; break;
+            }
+        }
+
+        if (!valid) TRACELOG(LOG_WARNING, "RLGL: [%s] Command trace replay stopped, trace data not valid", fileName);
+    }
+
+    // Trace resources are unloaded, renderer is left with default state
+    rlDrawRenderBatch(RLGL.currentBatch);
+    rlSetShader(RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs);
+
+    for (int i = 0; i < textureCount; i++) rlUnloadTexture(textures[i].id);
+    for (int i = 0; i < shaderCount; i++)
+    {
+        rlUnloadShaderProgram(shaders[i].id);
+        RL_FREE(shaders[i].locs);
+    }
+
+    RL_FREE(textures);
+    RL_FREE(shaders);
+    UnloadFileData(fileData);
+
+    if (stats.frameCount > 0)
+    {
+        TRACELOG(LOG_INFO, "RLGL: [%s] Command trace replayed: %i frames, %.3f ms/frame (min: %.3f ms, max: %.3f ms), %i draw calls, %lld vertex",
+            fileName, stats.frameCount, stats.cpuTime*1000.0/stats.frameCount, stats.frameTimeMin*1000.0, stats.frameTimeMax*1000.0, stats.drawCallCount, stats.vertexCount);
+    }
+
+    return stats;
+}
+
+// Enable software rasterizer, following batch draws are rasterized on CPU into software color/depth buffers
+// NOTE: Pending batch vertex are drawn by OpenGL first, viewport is set to the whole software buffers
+bool rlEnableSoftwareRender(int width, int height, int threadCount)
+{
+    if ((width <= 0) || (height <= 0))
+    {
+        TRACELOG(LOG_WARNING, "RLGL: Software rasterizer buffers size not valid (%ix%i)", width, height);
+        return false;
+    }
+
+    rlDisableSoftwareRender();
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    RLGL.Software.width = width;
+    RLGL.Software.height = height;
+    RLGL.Software.color = (unsigned char *)RL_MALLOC(width*height*4);
+    RLGL.Software.depth = (float *)RL_MALLOC(width*height*sizeof(float));
+    RLGL.Software.threadCount = (threadCount < 1)? 1 : ((threadCount > RLGL_SOFTWARE_MAX_THREADS)? RLGL_SOFTWARE_MAX_THREADS : threadCount);
+    rlSoftwareStartWorkers();
+
+    RLGL.Software.tilesX = (width + RLGL_SOFTWARE_TILE_SIZE - 1)/RLGL_SOFTWARE_TILE_SIZE;
+    RLGL.Software.tilesY = (height + RLGL_SOFTWARE_TILE_SIZE - 1)/RLGL_SOFTWARE_TILE_SIZE;
+    RLGL.Software.binOffsets = (int *)RL_CALLOC(RLGL.Software.tilesX*RLGL.Software.tilesY + 1, sizeof(int));
+    RLGL.Software.binCursors = (int *)RL_CALLOC(RLGL.Software.tilesX*RLGL.Software.tilesY, sizeof(int));
+
+    for (int i = 0; i < width*height; i++)
+    {
+        memcpy(&RLGL.Software.color[4*i], RLGL.Software.clearColor, 4);
+        RLGL.Software.depth[i] = 1.0f;
+    }
+
+    RLGL.Software.viewport[0] = 0;
+    RLGL.Software.viewport[1] = 0;
+    RLGL.Software.viewport[2] = width;
+    RLGL.Software.viewport[3] = height;
+    RLGL.Software.enabled = true;
+
+    TRACELOG(LOG_INFO, "RLGL: Software rasterizer enabled (%ix%i, %i threads)", width, height, RLGL.Software.threadCount);
+
+    return true;
+}
+
+// Disable software rasterizer, pending batch vertex are rasterized first
+void rlDisableSoftwareRender(void)
+{
+    if (!RLGL.Software.enabled) return;
+
+    rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.Software.enabled = false;
+    rlSoftwareStopWorkers();
+
+    for (int i = 0; i < RLGL.Software.textureCount; i++) RL_FREE(RLGL.Software.textures[i].pixels);
+    RL_FREE(RLGL.Software.textures);
+    RL_FREE(RLGL.Software.vertices);
+    RL_FREE(RLGL.Software.triangles);
+    RL_FREE(RLGL.Software.binOffsets);
+    RL_FREE(RLGL.Software.binCursors);
+    RL_FREE(RLGL.Software.binTriangles);
+    RL_FREE(RLGL.Software.color);
+    RL_FREE(RLGL.Software.depth);
+
+    RLGL.Software.textures = NULL;
+    RLGL.Software.textureCount = 0;
+    RLGL.Software.textureCapacity = 0;
+    RLGL.Software.vertices = NULL;
+    RLGL.Software.vertexCapacity = 0;
+    RLGL.Software.triangles = NULL;
+    RLGL.Software.triangleCount = 0;
+    RLGL.Software.triangleCapacity = 0;
+    RLGL.Software.binOffsets = NULL;
+    RLGL.Software.binCursors = NULL;
+    RLGL.Software.binTriangles = NULL;
+    RLGL.Software.binCapacity = 0;
+    RLGL.Software.color = NULL;
+    RLGL.Software.depth = NULL;
+
+    // Viewport is back to OpenGL framebuffer
+    rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+    TRACELOG(LOG_INFO, "RLGL: Software rasterizer disabled");
+}
+
+// Check if software rasterizer is enabled
+bool rlIsSoftwareRenderEnabled(void)
+{
+    return RLGL.Software.enabled;
+}
+
+// Check internal buffer overflow for a given number of vertex
+// and grow current buffer or force a rlRenderBatch draw call if required
+// NOTE: Returns true only if a draw was forced
+bool rlCheckRenderBatchLimit(int vCount)
+{
+    if (threadCommandBuffer != NULL) return false;      // Command buffers grow as required
+
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_CHECK_LIMIT, &vCount, sizeof(int));
+
+    bool overflow = false;
+    if (((RLGL.State.vertexCounter + vCount) >=
+        (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4)) &&
+        !rlGrowRenderBatch(RLGL.State.vertexCounter + vCount + 1))
+    {
+        int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
+        int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
+
+        overflow = true;
+        rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
+
+        // Restore state of last batch so we can continue adding vertices
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentTexture;
+    }
+    return overflow;
+}
+
+// Textures data management
+//-----------------------------------------------------------------------------------------
+// Convert image data to OpenGL texture (returns OpenGL valid Id)
+unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount)
+{
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+    unsigned int id = 0;
+    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA))) {
+        TRACELOG(LOG_WARNING, "GL: DXT compressed texture format not supported");
+        return id;
+    }
+    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB)) {
+        TRACELOG(LOG_WARNING, "GL: ETC1 compressed texture format not supported");
+        return id;
+    }
+    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA))) {
+        TRACELOG(LOG_WARNING, "GL: ETC2 compressed texture format not supported");
+        return id;
+    }
+    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA))) {
+        TRACELOG(LOG_WARNING, "GL: PVRT compressed texture format not supported");
+        return id;
+    }
+    if ((!RLGL.ExtSupported.texCompASTC) && ((format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA))) {
+        TRACELOG(LOG_WARNING, "GL: ASTC compressed texture format not supported");
+        return id;
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glGenTextures(1, &id);              // Generate texture id
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
+
+    int mipWidth = width;
+    int mipHeight = height;
+    int mipOffset = 0;          // Mipmap data offset
+
+    // Load the different mipmap levels
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        unsigned int mipSize = rlGetPixelDataSize(mipWidth, mipHeight, format);
+
+        int glInternalFormat, glFormat, glType;
+        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+        TRACELOG(LOG_DEBUG, "TEXTURE: Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
+
+        if (glInternalFormat != -1)
+        {
+            if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, (unsigned char *)data + mipOffset);
+            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, (unsigned char *)data + mipOffset);
+
+            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+        }
+
+        mipWidth /= 2;
+        mipHeight /= 2;
+        mipOffset += mipSize;
+
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+    }
+
+    // Texture parameters configuration
+    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+
+    // Magnification and minification filters
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+
+    if (mipmapCount > 1)
+    {
+        // Activate Trilinear filtering if mipmaps are available
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+
+        // Limit sampled levels to provided ones, mipmap chains not reaching 1x1 (i.e. stopped at block size) are complete
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mipmapCount - 1);
+    }
+    // At this point we have the texture loaded in GPU and texture parameters configured
+    // NOTE: If mipmaps were not in data, they are not generated automatically
+
+    // Unbind current texture
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
+
+    if ((id > 0) && RLGL_TRACE_ACTIVE) rlTraceLoadTexture(id, width, height, format, mipmapCount, data, (data != NULL)? mipOffset : 0);
+
+    if (id > 0) TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
+    else TRACELOG(LOG_WARNING, "TEXTURE: Failed to load texture");
+
+    return id;
+}
+
+// Load depth texture/renderbuffer (to be attached to fbo)
+// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture/WEBGL_depth_texture extensions
+unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
+{
+    unsigned int id = 0;
+
+    // In case depth textures not supported, we force renderbuffer usage
+    if (!RLGL.ExtSupported.texDepth) useRenderBuffer = true;
+
+    // NOTE: We let the implementation to choose the best bit-depth
+    // Possible formats: GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT32 and GL_DEPTH_COMPONENT32F
+    unsigned int glInternalFormat = GL_DEPTH_COMPONENT;
+    if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
+    {
+        glGenTextures(1, &id);
+        rlCacheBindTexture(GL_TEXTURE_2D, id);
+        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        rlCacheBindTexture(GL_TEXTURE_2D, 0);
+        TRACELOG(LOG_INFO, "TEXTURE: Depth texture loaded successfully");
+    } else {
+        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
+        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
+        glGenRenderbuffers(1, &id);
+        glBindRenderbuffer(GL_RENDERBUFFER, id);
+        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
+    }
+    return id;
+}
+
+// Load texture cubemap
+// NOTE: Cubemap data is expected to be 6 images in a single data array (one after the other),
+// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
+unsigned int rlLoadTextureCubemap(void *data, int size, int format)
+{
+    unsigned int id = 0;
+    unsigned int dataSize = rlGetPixelDataSize(size, size, format);
+    glGenTextures(1, &id);
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    if (glInternalFormat != -1)
+    {
+        // Load cubemap faces
+        for (unsigned int i = 0; i < 6; i++)
+        {
+            if (data == NULL)
+            {
+                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+                {
+                    if (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32)
+                    {
+                        // Instead of using a sized internal texture format (GL_RGB16F, GL_RGB32F), we let the driver to choose the better format for us (GL_RGB)
+                        if (RLGL.ExtSupported.texFloat32) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+                        else TRACELOG(LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
+                    }
+                    else if ((format == RL_PIXELFORMAT_UNCOMPRESSED_R32) || (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
+                    else glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, NULL);
+                }
+                else TRACELOG(LOG_WARNING, "TEXTURES: Empty cubemap creation does not support compressed format");
+            }
+            else
+            {
+                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
+                else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
+            }
+            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+        }
+    }
+
+    // Set cubemap texture sampling parameters
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    if (id > 0) TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
+    else TRACELOG(LOG_WARNING, "TEXTURE: Failed to load cubemap texture");
+    return id;
+}
+
+// Update already loaded texture in GPU with new data
+// NOTE: We don't know safely if internal texture format is the expected one...
+void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
+{
+    // NOTE: Update from a pixel buffer (NULL data) is traced by rlUpdateTextureFromPixelBuffer()
+    if (RLGL_TRACE_ACTIVE && (data != NULL) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)) rlTraceUpdateTexture(id, offsetX, offsetY, width, height, format, data);
+
+    if (RLGL.Software.textureCount > 0) rlSoftwareReleaseTexture(id);
+
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, (unsigned char *)data);
+    else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
+}
+
+// Get OpenGL internal formats and data type from raylib PixelFormat
+void rlGetGlTextureFormats(int format, int *glInternalFormat, int *glFormat, int *glType)
+{
+    *glInternalFormat = -1;
+    *glFormat = -1;
+    *glType = -1;
+    switch (format)
+    {
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: if (RLGL.ExtSupported.texCompETC1) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+        default: TRACELOG(LOG_WARNING, "TEXTURE: Current format not supported (%i)", format); break;
+    }
+}
+
+// Unload texture from GPU memory
+void rlUnloadTexture(unsigned int id)
+{
+    if (RLGL_TRACE_ACTIVE)
+    {
+        // Texture is not available anymore, id could be reused by next loaded texture
+        for (int i = 0; i < RLGL.Trace.textureCount; i++)
+        {
+            if (RLGL.Trace.textureIds[i] == id)
+            {
+                RLGL.Trace.textureIds[i] = RLGL.Trace.textureIds[RLGL.Trace.textureCount - 1];
+                RLGL.Trace.textureCount--;
+                rlTraceCommand(RLGL_TRACE_UNLOAD_TEXTURE, &id, sizeof(unsigned int));
+                break;
+            }
+        }
+    }
+
+    if (RLGL.Software.textureCount > 0) rlSoftwareReleaseTexture(id);
+
+    rlCacheDeleteTextures(1, &id);
+}
+
+// Generate mipmap data for selected texture
+void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
+{
+    if (RLGL_TRACE_ACTIVE)
+    {
+        rlTraceTexture(id);
+        rlTraceCommand(RLGL_TRACE_GEN_MIPMAPS, (int[4]){ (int)id, width, height, format }, 4*sizeof(int));
+    }
+
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
+
+    // Check if texture is power-of-two (POT)
+    bool texIsPOT = false;
+
+    if (((width > 0) && ((width & (width - 1)) == 0)) &&
+        ((height > 0) && ((height & (height - 1)) == 0))) texIsPOT = true;
+
+    if ((texIsPOT) || (RLGL.ExtSupported.texNPOT))
+    {
+        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorythm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
+        glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);   // Activate Trilinear filtering for mipmaps
+
+        #define MIN(a,b) (((a)<(b))?(a):(b))
+        #define MAX(a,b) (((a)>(b))?(a):(b))
+
+        *mipmaps = 1 + (int)floor(log(MAX(width, height))/log(2));
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
+
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
+}
+
+// Read texture pixel data
+void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
+{
+    void *pixels = NULL;
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
+
+    // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
+    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
+    //int width, height, format;
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+
+    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding.
+    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting.
+    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
+    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    unsigned int size = rlGetPixelDataSize(width, height, format);
+
+    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        pixels = RL_MALLOC(size);
+        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
+    return pixels;
+}
+
+// Read screen pixel data (color buffer)
+unsigned char *rlReadScreenPixels(int width, int height)
+{
+    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
+
+    if (RLGL.Software.enabled)
+    {
+        // Software color buffer rows are stored bottom-up too, pixels out of buffer are zeroed
+        memset(imgData, 0, width*height*4);
+        int rowSize = ((width < RLGL.Software.width)? width : RLGL.Software.width)*4;
+        for (int y = 0; (y < height) && (y < RLGL.Software.height); y++) memcpy(&imgData[y*width*4], &RLGL.Software.color[y*RLGL.Software.width*4], rowSize);
+    }
+    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
+    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
+    else glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, imgData);
+
+    // Flip image vertically (in place)
+    rlFlipScreenPixels(imgData, imgData, width, height);
+
+    return imgData;     // NOTE: image data should be freed
+}
+
+// Flip screen pixel data vertically and set alpha to 255, in a single pass
+// NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+// Destination can be the same as source (flipped in place)
+void rlFlipScreenPixels(void *dst, const void *src, int width, int height)
+{
+    // Pixels are processed as 32 bit words, alpha mask is independent of endianness
+    const unsigned char alphaBytes[4] = { 0, 0, 0, 255 };
+    unsigned int alpha = 0;
+    memcpy(&alpha, alphaBytes, 4);
+
+    const unsigned int *srcPixels = (const unsigned int *)src;
+    unsigned int *dstPixels = (unsigned int *)dst;
+
+    for (int y = 0; y < (height + 1)/2; y++)
+    {
+        const unsigned int *srcTop = srcPixels + y*width;
+        const unsigned int *srcBottom = srcPixels + (height - 1 - y)*width;
+        unsigned int *dstTop = dstPixels + y*width;
+        unsigned int *dstBottom = dstPixels + (height - 1 - y)*width;
+
+        for (int x = 0; x < width; x++)
+        {
+            unsigned int top = srcTop[x];
+            dstTop[x] = srcBottom[x] | alpha;
+            dstBottom[x] = top | alpha;
+        }
+    }
+}
+
+// Read screen pixel data (color buffer) into pixel buffer
+// NOTE: Transfer is queued by the driver, data is available (flipped vertically) once a fence inserted after it is signaled
+void rlReadScreenPixelsToBuffer(int width, int height, unsigned int pboId)
+{
+    rlCacheBindBuffer(GL_PIXEL_PACK_BUFFER, pboId);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, NULL);     // NULL: pixel buffer offset 0
+    rlCacheBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+// Read texture pixel data into pixel buffer
+// NOTE: Transfer is queued by the driver, data is available once a fence inserted after it is signaled
+void rlReadTexturePixelsToBuffer(unsigned int id, int format, unsigned int pboId)
+{
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        rlCacheBindTexture(GL_TEXTURE_2D, id);
+        rlCacheBindBuffer(GL_PIXEL_PACK_BUFFER, pboId);
+        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, NULL);            // NULL: pixel buffer offset 0
+        rlCacheBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        rlCacheBindTexture(GL_TEXTURE_2D, 0);
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
+}
+
+// Framebuffer management (fbo)
+//-----------------------------------------------------------------------------------------
+// Load a framebuffer to be used for rendering
+// NOTE: No textures attached
+unsigned int rlLoadFramebuffer(int width, int height)
+{
+    unsigned int fboId = 0;
+
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glGenFramebuffers(1, &fboId);       // Create the framebuffer object
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.defaultFramebufferId);   // Back to default framebuffer
+#endif
+
+    return fboId;
+}
+
+// Attach color buffer texture to an fbo (unloads previous attachment)
+// NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
+void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+
+    switch (attachType)
+    {
+        case RL_ATTACHMENT_COLOR_CHANNEL0:
+        case RL_ATTACHMENT_COLOR_CHANNEL1:
+        case RL_ATTACHMENT_COLOR_CHANNEL2:
+        case RL_ATTACHMENT_COLOR_CHANNEL3:
+        case RL_ATTACHMENT_COLOR_CHANNEL4:
+        case RL_ATTACHMENT_COLOR_CHANNEL5:
+        case RL_ATTACHMENT_COLOR_CHANNEL6:
+        case RL_ATTACHMENT_COLOR_CHANNEL7:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER) glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_RENDERBUFFER, texId);
+            else if (texType >= RL_ATTACHMENT_CUBEMAP_POSITIVE_X) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_CUBE_MAP_POSITIVE_X + texType, texId, mipLevel);
+
+        } break;
+        case RL_ATTACHMENT_DEPTH:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, texId);
+
+        } break;
+        case RL_ATTACHMENT_STENCIL:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, texId);
+
+        } break;
+        default: break;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.defaultFramebufferId);
+#endif
+}
+
+// Verify render texture is complete
+bool rlFramebufferComplete(unsigned int id)
+{
+    bool result = false;
+    glBindFramebuffer(GL_FRAMEBUFFER, id);
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        switch (status) {
+            case GL_FRAMEBUFFER_UNSUPPORTED: TRACELOG(LOG_WARNING, "FBO: [ID %i] Framebuffer is unsupported", id); break;
+            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: TRACELOG(LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete attachment", id); break;
+            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: TRACELOG(LOG_WARNING, "FBO: [ID %i] Framebuffer has a missing attachment", id); break;
+            default: break;
+        }
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.defaultFramebufferId);
+    result = (status == GL_FRAMEBUFFER_COMPLETE);
+    return result;
+}
+
+// Unload framebuffer from GPU memory
+// NOTE: All attached textures/cubemaps/renderbuffers are also deleted
+void rlUnloadFramebuffer(unsigned int id)
+{
+    // Query depth attachment to automatically delete texture/renderbuffer
+    int depthType = 0, depthId = 0;
+    glBindFramebuffer(GL_FRAMEBUFFER, id);   // Bind framebuffer to query depth texture type
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &depthType);
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &depthId);
+
+    unsigned int depthIdU = (unsigned int)depthId;
+    if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
+    else if (depthType == GL_RENDERBUFFER) rlCacheDeleteTextures(1, &depthIdU);
+    // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
+    // the texture image is automatically detached from the currently bound framebuffer.
+    glBindFramebuffer(GL_FRAMEBUFFER, RLGL.State.defaultFramebufferId);
+    glDeleteFramebuffers(1, &id);
+    TRACELOG(LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
+}
+
+// Vertex data management
+//-----------------------------------------------------------------------------------------
+// Load a new attributes buffer
+unsigned int rlLoadVertexBuffer(void *buffer, int size, bool dynamic)
+{
+    unsigned int id = 0;
+    glGenBuffers(1, &id);
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    return id;
+}
+
+// Load a new attributes element buffer
+unsigned int rlLoadVertexBufferElement(void *buffer, int size, bool dynamic)
+{
+    unsigned int id = 0;
+    glGenBuffers(1, &id);
+    rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    return id;
+}
+
+// Enable vertex buffer (VBO)
+void rlEnableVertexBuffer(unsigned int id)
+{
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, id);
+}
+
+// Disable vertex buffer (VBO)
+void rlDisableVertexBuffer(void)
+{
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// Enable vertex buffer element (VBO element)
+void rlEnableVertexBufferElement(unsigned int id)
+{
+    rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+}
+
+// Disable vertex buffer element (VBO element)
+void rlDisableVertexBufferElement(void)
+{
+    rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+// Update vertex buffer with new data
+// NOTE: dataSize and offset must be provided in bytes
+void rlUpdateVertexBuffer(unsigned int id, void *data, int dataSize, int offset)
+{
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+}
+
+// Orphan vertex buffer storage (reallocated with same size and undefined contents)
+// NOTE: Driver can keep previous storage alive for pending draws, avoiding CPU-GPU sync on next update
+void rlOrphanVertexBuffer(unsigned int id, int size)
+{
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, NULL, GL_DYNAMIC_DRAW);
+}
+
+// Update vertex buffer elements with new data
+// NOTE: dataSize and offset must be provided in bytes
+void rlUpdateVertexBufferElements(unsigned int id, void *data, int dataSize, int offset)
+{
+    rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+}
+
+// Enable vertex array object (VAO)
+bool rlEnableVertexArray(unsigned int vaoId)
+{
+    bool result = false;
+    if (RLGL.ExtSupported.vao)
+    {
+        rlCacheBindVertexArray(vaoId);
+        result = true;
+    }
+    return result;
+}
+
+// Disable vertex array object (VAO)
+void rlDisableVertexArray(void)
+{
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
+}
+
+// Enable vertex attribute index
+void rlEnableVertexAttribute(unsigned int index)
+{
+    glEnableVertexAttribArray(index);
+}
+
+// Disable vertex attribute index
+void rlDisableVertexAttribute(unsigned int index)
+{
+    glDisableVertexAttribArray(index);
+}
+
+// Draw vertex array
+void rlDrawVertexArray(int offset, int count)
+{
+    glDrawArrays(GL_TRIANGLES, offset, count);
+}
+
+// Draw vertex array elements
+void rlDrawVertexArrayElements(int offset, int count, void *buffer)
+{
+    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (unsigned short *)buffer + offset);
+}
+
+// Draw vertex array instanced
+void rlDrawVertexArrayInstanced(int offset, int count, int instances)
+{
+    glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+}
+
+// Draw vertex array elements instanced
+void rlDrawVertexArrayElementsInstanced(int offset, int count, void *buffer, int instances)
+{
+    glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (unsigned short *)buffer + offset, instances);
+}
+
+// Draw multiple element ranges of current vertex array
+// NOTE: Issued as a single glMultiDrawElementsIndirect() if supported, as a loop of draws otherwise,
+// baseInstance is ignored if not supported (check rlIsDrawBaseInstanceSupported())
+void rlDrawVertexArrayElementsMulti(const rlDrawElementsCommand *commands, int count)
+{
+    if (count <= 0) return;
+
+    if (RLGL.ExtSupported.multiDrawIndirect)
+    {
+        if (RLGL.State.drawIndirectBufferId == 0) glGenBuffers(1, &RLGL.State.drawIndirectBufferId);
+
+        // Commands buffer is orphaned on every call, no wait for the GPU to consume previous commands
+        rlCacheBindBuffer(GL_DRAW_INDIRECT_BUFFER, RLGL.State.drawIndirectBufferId);
+        glBufferData(GL_DRAW_INDIRECT_BUFFER, count*sizeof(rlDrawElementsCommand), commands, GL_STREAM_DRAW);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, 0, count, 0);
+        rlCacheBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    }
+    else if (RLGL.ExtSupported.baseInstance)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            glDrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES, commands[i].count, GL_UNSIGNED_INT, (void *)((size_t)commands[i].firstIndex*sizeof(unsigned int)),
+                commands[i].instanceCount, commands[i].baseVertex, commands[i].baseInstance);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < count; i++)
+        {
+            glDrawElementsInstancedBaseVertex(GL_TRIANGLES, commands[i].count, GL_UNSIGNED_INT, (void *)((size_t)commands[i].firstIndex*sizeof(unsigned int)),
+                commands[i].instanceCount, commands[i].baseVertex);
+        }
+    }
+}
+
+// Check draw commands baseInstance support
+bool rlIsDrawBaseInstanceSupported(void)
+{
+    return RLGL.ExtSupported.baseInstance;
+}
+
+// Copy data between GPU buffers
+void rlCopyBufferData(unsigned int srcId, unsigned int dstId, int srcOffset, int dstOffset, int size)
+{
+    rlCacheBindBuffer(GL_COPY_READ_BUFFER, srcId);
+    rlCacheBindBuffer(GL_COPY_WRITE_BUFFER, dstId);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, srcOffset, dstOffset, size);
+    rlCacheBindBuffer(GL_COPY_READ_BUFFER, 0);
+    rlCacheBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+}
+
+// Load vertex array object (VAO)
+unsigned int rlLoadVertexArray(void)
+{
+    unsigned int vaoId = 0;
+    if (RLGL.ExtSupported.vao)
+        glGenVertexArrays(1, &vaoId);
+    return vaoId;
+}
+
+// Set vertex attribute
+void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, void *pointer)
+{
+    glVertexAttribPointer(index, compSize, type, normalized, stride, pointer);
+}
+
+// Set vertex attribute divisor
+void rlSetVertexAttributeDivisor(unsigned int index, int divisor)
+{
+    glVertexAttribDivisor(index, divisor);
+}
+
+// Unload vertex array object (VAO)
+void rlUnloadVertexArray(unsigned int vaoId)
+{
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(vaoId);
-        result = true;
+        rlCacheBindVertexArray(0);
+        rlCacheDeleteVertexArrays(1, &vaoId);
+        TRACELOG(LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
+    }
+}
+
+// Unload vertex buffer (VBO)
+void rlUnloadVertexBuffer(unsigned int vboId)
+{
+    rlCacheDeleteBuffers(1, &vboId);
+    TRACELOG(LOG_INFO, "VBO: Unloaded vertex data from VRAM (GPU)");
+}
+
+// Uniform buffers management
+//-----------------------------------------------------------------------------------------------
+// Load uniform buffer object (UBO)
+unsigned int rlLoadUniformBuffer(unsigned int size, const void *data, int usageHint)
+{
+    unsigned int id = 0;
+    glGenBuffers(1, &id);
+    rlCacheBindBuffer(GL_UNIFORM_BUFFER, id);
+    glBufferData(GL_UNIFORM_BUFFER, size, data, usageHint);
+    rlCacheBindBuffer(GL_UNIFORM_BUFFER, 0);
+    return id;
+}
+
+// Update uniform buffer object data
+void rlUpdateUniformBuffer(unsigned int id, const void *data, unsigned int size, unsigned int offset)
+{
+    rlCacheBindBuffer(GL_UNIFORM_BUFFER, id);
+    glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+    rlCacheBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+// Bind uniform buffer object to a uniform block binding point
+void rlBindUniformBuffer(unsigned int binding, unsigned int id)
+{
+    glBindBufferBase(GL_UNIFORM_BUFFER, binding, id);
+}
+
+// Unload uniform buffer object
+void rlUnloadUniformBuffer(unsigned int id)
+{
+    rlCacheDeleteBuffers(1, &id);
+    TRACELOG(LOG_INFO, "UBO: Unloaded uniform data from VRAM (GPU)");
+}
+
+// Update internal camera matrices buffer
+// NOTE: Matrices are compared with last uploaded ones, so it can be called on every draw for free
+void rlSetCameraUniforms(Matrix view, Matrix projection)
+{
+    if (RLGL.State.cameraBufferId == 0) return;
+
+    float matrices[32] = { 0 };
+    memcpy(matrices, MatrixToFloat(view), 16*sizeof(float));
+    memcpy(matrices + 16, MatrixToFloat(projection), 16*sizeof(float));
+
+    if (RLGL.State.cameraBufferValid && (memcmp(matrices, RLGL.State.cameraMatrices, sizeof(matrices)) == 0)) return;
+
+    rlUpdateUniformBuffer(RLGL.State.cameraBufferId, matrices, sizeof(matrices), 0);
+    memcpy(RLGL.State.cameraMatrices, matrices, sizeof(matrices));
+    RLGL.State.cameraBufferValid = true;
+}
+
+// Compute shader management
+//-----------------------------------------------------------------------------------------------
+// Load compute shader program
+// NOTE: Shader is not required anymore once linked, it is deleted on success and failure
+unsigned int rlLoadComputeShaderProgram(unsigned int shaderId)
+{
+    unsigned int program = 0;
+    if (!RLGL.ExtSupported.computeShader)
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Compute shaders not supported");
+        if (shaderId != 0) glDeleteShader(shaderId);
+        return program;
+    }
+
+    GLint success = 0;
+    program = glCreateProgram();
+    glAttachShader(program, shaderId);
+    glLinkProgram(program);
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE) {
+        TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to link compute shader program", program);
+        int maxLength = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+        if (maxLength > 0) {
+            int length = 0;
+            char *log = RL_CALLOC(maxLength, sizeof(char));
+            glGetProgramInfoLog(program, maxLength, &length, log);
+            TRACELOG(LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
+            RL_FREE(log);
+        }
+        glDeleteProgram(program);       // Shader is detached on program deletion
+        program = 0;
+    } else {
+        glDetachShader(program, shaderId);
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Compute shader program loaded successfully", program);
+    }
+    glDeleteShader(shaderId);
+    return program;
+}
+
+// Dispatch compute shader (equivalent to *draw* for graphics pipeline)
+void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ)
+{
+    if (RLGL.ExtSupported.computeShader) glDispatchCompute(groupX, groupY, groupZ);
+    else TRACELOG(LOG_WARNING, "SHADER: Compute shaders not supported");
+}
+
+// Set memory barrier for previous shader writes
+void rlMemoryBarrier(unsigned int barriers)
+{
+    if (RLGL.ExtSupported.computeShader) glMemoryBarrier(barriers);
+    else TRACELOG(LOG_WARNING, "SHADER: Compute shaders not supported");
+}
+
+// Shader buffer storage object management (ssbo)
+//-----------------------------------------------------------------------------------------------
+// Load shader storage buffer object (SSBO)
+unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHint)
+{
+    unsigned int ssbo = 0;
+    if (!RLGL.ExtSupported.ssbo)
+    {
+        TRACELOG(LOG_WARNING, "SSBO: Shader storage buffer objects not supported");
+        return ssbo;
+    }
+
+    // NOTE: Buffer data is initialized to 0 if not provided
+    void *zeros = (data == NULL)? RL_CALLOC(size, 1) : NULL;
+
+    glGenBuffers(1, &ssbo);
+    rlCacheBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, size, (data != NULL)? data : zeros, usageHint? usageHint : RL_STREAM_COPY);
+    rlCacheBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    RL_FREE(zeros);
+    return ssbo;
+}
+
+// Unload shader storage buffer object (SSBO)
+void rlUnloadShaderBuffer(unsigned int ssboId)
+{
+    rlCacheDeleteBuffers(1, &ssboId);
+}
+
+// Update SSBO buffer data
+void rlUpdateShaderBuffer(unsigned int id, const void *data, unsigned int dataSize, unsigned int offset)
+{
+    if (!RLGL.ExtSupported.ssbo)
+    {
+        TRACELOG(LOG_WARNING, "SSBO: Shader storage buffer objects not supported");
+        return;
+    }
+
+    rlCacheBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, dataSize, data);
+    rlCacheBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+// Bind SSBO buffer to a shader storage binding point
+void rlBindShaderBuffer(unsigned int id, unsigned int index)
+{
+    if (RLGL.ExtSupported.ssbo) glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, id);
+    else TRACELOG(LOG_WARNING, "SSBO: Shader storage buffer objects not supported");
+}
+
+// Read SSBO buffer data (GPU->CPU)
+// NOTE: Waits for pending GPU writes, use it for results retrieval or debug, not on every frame
+void rlReadShaderBuffer(unsigned int id, void *dest, unsigned int count, unsigned int offset)
+{
+    if (!RLGL.ExtSupported.ssbo)
+    {
+        TRACELOG(LOG_WARNING, "SSBO: Shader storage buffer objects not supported");
+        return;
+    }
+
+    rlCacheBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, count, dest);
+    rlCacheBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+// Get SSBO buffer size
+unsigned int rlGetShaderBufferSize(unsigned int id)
+{
+    GLint64 size = 0;
+    if (!RLGL.ExtSupported.ssbo) return 0;
+
+    rlCacheBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glGetBufferParameteri64v(GL_SHADER_STORAGE_BUFFER, GL_BUFFER_SIZE, &size);
+    rlCacheBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    return (size > 0)? (unsigned int)size : 0;
+}
+
+// Bind image texture to an image unit (compute shader image load/store)
+// NOTE: Texture level 0 is bound, format must be an uncompressed format
+void rlBindImageTexture(unsigned int id, unsigned int index, int format, bool readonly)
+{
+    int glInternalFormat = 0, glFormat = 0, glType = 0;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if (!RLGL.ExtSupported.computeShader) TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Image binding not supported (requires compute shaders)", id);
+    else if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)) glBindImageTexture(index, id, 0, GL_FALSE, 0, readonly? GL_READ_ONLY : GL_READ_WRITE, glInternalFormat);
+    else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Image binding not supported for pixel format (%i)", id, format);
+}
+
+// Pixel buffers management
+//-----------------------------------------------------------------------------------------------
+// Load pixel buffer object (pbo)
+// NOTE: Pack buffers receive pixel data from GPU (glReadPixels, glGetTexImage),
+// unpack buffers provide pixel data to GPU (glTexSubImage2D)
+unsigned int rlLoadPixelBuffer(int size, bool pack)
+{
+    unsigned int id = 0;
+    unsigned int target = pack? GL_PIXEL_PACK_BUFFER : GL_PIXEL_UNPACK_BUFFER;
+    glGenBuffers(1, &id);
+    rlCacheBindBuffer(target, id);
+    glBufferData(target, size, NULL, pack? GL_STREAM_READ : GL_STREAM_DRAW);
+    rlCacheBindBuffer(target, 0);
+    return id;
+}
+
+// Map pixel buffer data
+// NOTE: Upload buffers are mapped invalidated (orphaned), so mapping never waits for a pending
+// transfer from previous data; readback buffers should be mapped once its fence is signaled
+void *rlMapPixelBuffer(unsigned int id, int size, bool pack)
+{
+    void *data = NULL;
+    if (pack) {
+        rlCacheBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+        data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+        rlCacheBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    } else {
+        rlCacheBindBuffer(GL_PIXEL_UNPACK_BUFFER, id);
+        data = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        rlCacheBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+    if (data == NULL) TRACELOG(LOG_WARNING, "PBO: [ID %i] Failed to map pixel buffer", id);
+    return data;
+}
+
+// Unmap pixel buffer data
+void rlUnmapPixelBuffer(unsigned int id, bool pack)
+{
+    unsigned int target = pack? GL_PIXEL_PACK_BUFFER : GL_PIXEL_UNPACK_BUFFER;
+    rlCacheBindBuffer(target, id);
+    glUnmapBuffer(target);
+    rlCacheBindBuffer(target, 0);
+}
+
+// Unload pixel buffer object
+void rlUnloadPixelBuffer(unsigned int id)
+{
+    rlCacheDeleteBuffers(1, &id);
+}
+
+// Update GPU texture with pixel buffer data
+// NOTE: Transfer is queued by the driver, pixel buffer must be unmapped and not modified until completed
+// On command trace capture, pixel buffer is mapped for reading and traced as a regular texture update
+void rlUpdateTextureFromPixelBuffer(unsigned int id, int offsetX, int offsetY, int width, int height, int format, unsigned int pboId)
+{
+    if (RLGL_TRACE_ACTIVE && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        rlTraceTexture(id);     // Texture read back (if required) before pixel buffer is bound
+
+        rlCacheBindBuffer(GL_PIXEL_UNPACK_BUFFER, pboId);
+        const void *pixels = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, rlGetPixelDataSize(width, height, format), GL_MAP_READ_BIT);
+        if (pixels != NULL)
+        {
+            rlTraceUpdateTexture(id, offsetX, offsetY, width, height, format, pixels);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        }
+        else TRACELOG(LOG_WARNING, "RLGL: [ID %i] Failed to map pixel buffer, texture update not traced", pboId);
+    }
+
+    rlCacheBindBuffer(GL_PIXEL_UNPACK_BUFFER, pboId);
+    rlUpdateTexture(id, offsetX, offsetY, width, height, format, NULL);     // NULL: pixel buffer offset 0
+    rlCacheBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+// Load fence sync object
+void *rlLoadFence(void)
+{
+    GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();      // Make sure fence reaches GPU, otherwise it could never be signaled
+    return (void *)fence;
+}
+
+// Check if fence has been signaled (no wait)
+bool rlIsFenceSignaled(void *fence)
+{
+    if (fence == NULL) return true;
+    GLenum result = glClientWaitSync((GLsync)fence, 0, 0);
+    return ((result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED));
+}
+
+// Unload fence sync object
+void rlUnloadFence(void *fence)
+{
+    if (fence != NULL) glDeleteSync((GLsync)fence);
+}
+
+// Shaders management
+//-----------------------------------------------------------------------------------------------
+// Load shader from code strings
+// NOTE: If shader string is NULL, using default vertex/fragment shaders
+unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
+{
+    unsigned int id = 0;
+    unsigned long long hash = 0;
+
+    // Custom shader program could be available in shader cache, no compilation required
+    // NOTE: Custom vertex shaders do not provide the batch texture slot, they are linked with texture0 only default fragment shader
+    if ((vsCode != NULL) || (fsCode != NULL)) id = rlLoadShaderProgramCache((vsCode != NULL)? vsCode : RLGL.State.defaultVShaderCode, (fsCode != NULL)? fsCode : RLGL.State.defaultFShaderTexture0Code, &hash);
+    if (id != 0)
+    {
+        if (RLGL_TRACE_ACTIVE) rlTraceLoadShader(id, vsCode, fsCode);
+        return id;
+    }
+
+    // Default shaders are not compiled if default program was loaded from shader cache
+    if ((vsCode == NULL) && (fsCode != NULL) && (RLGL.State.defaultVShaderId == 0)) RLGL.State.defaultVShaderId = rlCompileShader(RLGL.State.defaultVShaderCode, GL_VERTEX_SHADER);
+    if ((fsCode == NULL) && (vsCode != NULL) && (RLGL.State.defaultFShaderTexture0Id == 0)) RLGL.State.defaultFShaderTexture0Id = rlCompileShader(RLGL.State.defaultFShaderTexture0Code, GL_FRAGMENT_SHADER);
+
+    unsigned int vertexShaderId = RLGL.State.defaultVShaderId;
+    unsigned int fragmentShaderId = RLGL.State.defaultFShaderTexture0Id;
+
+    if (vsCode != NULL) vertexShaderId = rlCompileShader(vsCode, GL_VERTEX_SHADER);
+    if (fsCode != NULL) fragmentShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
+
+    if ((vsCode == NULL) && (fsCode == NULL)) {
+        id = RLGL.State.defaultShaderId;
+    } else {
+        id = rlLoadShaderProgram(vertexShaderId, fragmentShaderId);
+        if (id != 0) rlSaveShaderProgramCache(id, hash);
+        if (vertexShaderId != RLGL.State.defaultVShaderId) {
+            // Detach shader before deletion to make sure memory is freed
+            glDetachShader(id, vertexShaderId);
+            glDeleteShader(vertexShaderId);
+        }
+        if (fragmentShaderId != RLGL.State.defaultFShaderTexture0Id) {
+            // Detach shader before deletion to make sure memory is freed
+            glDetachShader(id, fragmentShaderId);
+            glDeleteShader(fragmentShaderId);
+        }
+        if (id == 0) {
+            TRACELOG(LOG_WARNING, "SHADER: Failed to load custom shader code");
+            id = RLGL.State.defaultShaderId;
+        }
+    }
+
+    // Get available shader uniforms
+    // NOTE: This information is useful for debug...
+    int uniformCount = -1;
+    glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformCount);
+    for (int i = 0; i < uniformCount; i++) {
+        int namelen = -1;
+        int num = -1;
+        char name[256] = { 0 };     // Assume no variable names longer than 256
+        GLenum type = GL_ZERO;
+        // Get the name of the uniforms
+        glGetActiveUniform(id, i, sizeof(name) - 1, &namelen, &num, &type, name);
+        name[namelen] = 0;
+        TRACELOG(LOG_DEBUG, "SHADER: [ID %i] Active uniform (%s) set at location: %i", id, name, glGetUniformLocation(id, name));
+    }
+
+    if (RLGL_TRACE_ACTIVE && (id != RLGL.State.defaultShaderId)) rlTraceLoadShader(id, vsCode, fsCode);
+
+    return id;
+}
+
+// Compile custom shader and return shader id
+unsigned int rlCompileShader(const char *shaderCode, int type)
+{
+    unsigned int shader = 0;
+    shader = glCreateShader(type);
+    glShaderSource(shader, 1, &shaderCode, NULL);
+    GLint success = 0;
+    glCompileShader(shader);
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (success == GL_FALSE) {
+        switch (type) {
+            case GL_VERTEX_SHADER: TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to compile vertex shader code", shader); break;
+            case GL_FRAGMENT_SHADER: TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to compile fragment shader code", shader); break;
+            case GL_COMPUTE_SHADER: TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to compile compute shader code", shader); break;
+            //case GL_GEOMETRY_SHADER:
+            default: break;
+        }
+        int maxLength = 0;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+        if (maxLength > 0)
+        {
+            int length = 0;
+            char *log = RL_CALLOC(maxLength, sizeof(char));
+            glGetShaderInfoLog(shader, maxLength, &length, log);
+            TRACELOG(LOG_WARNING, "SHADER: [ID %i] Compile error: %s", shader, log);
+            RL_FREE(log);
+        }
+    } else {
+        switch (type) {
+            case GL_VERTEX_SHADER: TRACELOG(LOG_INFO, "SHADER: [ID %i] Vertex shader compiled successfully", shader); break;
+            case GL_FRAGMENT_SHADER: TRACELOG(LOG_INFO, "SHADER: [ID %i] Fragment shader compiled successfully", shader); break;
+            case GL_COMPUTE_SHADER: TRACELOG(LOG_INFO, "SHADER: [ID %i] Compute shader compiled successfully", shader); break;
+            default: break;
+        }
+    }
+    return shader;
+}
+
+// Load custom shader strings and return program id
+unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+{
+    unsigned int program = 0;
+    GLint success = 0;
+    program = glCreateProgram();
+    glAttachShader(program, vShaderId);
+    glAttachShader(program, fShaderId);
+    // NOTE: Default attribute shader locations must be binded before linking
+    glBindAttribLocation(program, 0, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    glBindAttribLocation(program, 1, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    glBindAttribLocation(program, 2, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    glBindAttribLocation(program, 3, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    glBindAttribLocation(program, 4, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    glBindAttribLocation(program, 5, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    glBindAttribLocation(program, RLGL_TEXTURE_SLOT_LOCATION, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT);
+    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+    if ((RLGL.State.shaderCachePath[0] != '\0') && RLGL.ExtSupported.programBinary) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(program);
+    // NOTE: All uniform variables are intitialised to 0 when a program links
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (success == GL_FALSE) {
+        TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", program);
+        int maxLength = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+        if (maxLength > 0) {
+            int length = 0;
+            char *log = RL_CALLOC(maxLength, sizeof(char));
+            glGetProgramInfoLog(program, maxLength, &length, log);
+            TRACELOG(LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
+            RL_FREE(log);
+        }
+        glDeleteProgram(program);
+        program = 0;
+    } else {
+        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
+        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
+        //GLint binarySize = 0;
+        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", program);
+    }
+    return program;
+}
+
+// Unload shader program
+void rlUnloadShaderProgram(unsigned int id)
+{
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_UNLOAD_SHADER, &id, sizeof(unsigned int));
+    glDeleteProgram(id);
+    TRACELOG(LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
+}
+
+// Set shader program binaries cache directory
+// NOTE: It can be set before rlglInit() so default shader is also cached, directory must exist
+void rlSetShaderCacheDirectory(const char *dirPath)
+{
+    RLGL.State.shaderCachePath[0] = '\0';
+    if (dirPath != NULL) snprintf(RLGL.State.shaderCachePath, sizeof(RLGL.State.shaderCachePath), "%s", dirPath);
+}
+
+// Get shader location uniform
+int rlGetLocationUniform(unsigned int shaderId, const char *uniformName)
+{
+    int location = -1;
+    location = glGetUniformLocation(shaderId, uniformName);
+    if (location == -1) TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to find shader uniform: %s", shaderId, uniformName);
+    else TRACELOG(LOG_INFO, "SHADER: [ID %i] Shader uniform (%s) set at location: %i", shaderId, uniformName, location);
+    return location;
+}
+
+// Get shader uniform block index and assign it a binding point
+// NOTE: Uniform buffers bound to that binding point (rlBindUniformBuffer()) feed the block
+int rlGetLocationUniformBlock(unsigned int shaderId, const char *blockName, unsigned int binding)
+{
+    int location = -1;
+    unsigned int index = glGetUniformBlockIndex(shaderId, blockName);
+    if (index != GL_INVALID_INDEX)
+    {
+        glUniformBlockBinding(shaderId, index, binding);
+        location = (int)index;
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Shader uniform block (%s) set at binding point: %i", shaderId, blockName, binding);
+    }
+    return location;
+}
+
+// Get shader location attribute
+int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
+{
+    int location = -1;
+    location = glGetAttribLocation(shaderId, attribName);
+    if (location == -1) TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to find shader attribute: %s", shaderId, attribName);
+    else TRACELOG(LOG_INFO, "SHADER: [ID %i] Shader attribute (%s) set at location: %i", shaderId, attribName, location);
+    return location;
+}
+
+// Set shader value uniform
+void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
+{
+    if (RLGL_TRACE_ACTIVE)
+    {
+        int size = 0;
+        switch (uniformType)
+        {
+            case RL_SHADER_UNIFORM_VEC2: case RL_SHADER_UNIFORM_IVEC2: size = 2*4*count; break;
+            case RL_SHADER_UNIFORM_VEC3: case RL_SHADER_UNIFORM_IVEC3: size = 3*4*count; break;
+            case RL_SHADER_UNIFORM_VEC4: case RL_SHADER_UNIFORM_IVEC4: size = 4*4*count; break;
+            default: size = 4*count; break;     // RL_SHADER_UNIFORM_FLOAT, RL_SHADER_UNIFORM_INT, RL_SHADER_UNIFORM_SAMPLER2D
+        }
+
+        rlTraceCommand(RLGL_TRACE_SET_UNIFORM, (int[4]){ locIndex, uniformType, count, size }, 4*sizeof(int));
+        rlTraceData(value, size);
+    }
+
+    switch (uniformType)
+    {
+        case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_VEC2: glUniform2fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_VEC3: glUniform3fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_VEC4: glUniform4fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_INT: glUniform1iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_IVEC2: glUniform2iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_IVEC3: glUniform3iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_IVEC4: glUniform4iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_SAMPLER2D: glUniform1iv(locIndex, count, (int *)value); break;
+        default: TRACELOG(LOG_WARNING, "SHADER: Failed to set uniform value, data type not recognized");
+    }
+}
+
+// Set shader value attribute
+void rlSetVertexAttributeDefault(int locIndex, const void *value, int attribType, int count)
+{
+    switch (attribType)
+    {
+        case RL_SHADER_ATTRIB_FLOAT: if (count == 1) glVertexAttrib1fv(locIndex, (float *)value); break;
+        case RL_SHADER_ATTRIB_VEC2: if (count == 2) glVertexAttrib2fv(locIndex, (float *)value); break;
+        case RL_SHADER_ATTRIB_VEC3: if (count == 3) glVertexAttrib3fv(locIndex, (float *)value); break;
+        case RL_SHADER_ATTRIB_VEC4: if (count == 4) glVertexAttrib4fv(locIndex, (float *)value); break;
+        default: TRACELOG(LOG_WARNING, "SHADER: Failed to set attrib default value, data type not recognized");
+    }
+}
+
+// Set shader value uniform matrix
+void rlSetUniformMatrix(int locIndex, Matrix mat)
+{
+    if (RLGL_TRACE_ACTIVE)
+    {
+        rlTraceCommand(RLGL_TRACE_SET_UNIFORM_MATRIX, &locIndex, sizeof(int));
+        rlTraceData(&mat, sizeof(Matrix));
+    }
+
+    float matfloat[16] = {
+        mat.m0, mat.m1, mat.m2, mat.m3,
+        mat.m4, mat.m5, mat.m6, mat.m7,
+        mat.m8, mat.m9, mat.m10, mat.m11,
+        mat.m12, mat.m13, mat.m14, mat.m15
+    };
+    glUniformMatrix4fv(locIndex, 1, false, matfloat);
+}
+
+// Set shader value uniform sampler
+void rlSetUniformSampler(int locIndex, unsigned int textureId)
+{
+    if (RLGL_TRACE_ACTIVE)
+    {
+        rlTraceTexture(textureId);
+        rlTraceCommand(RLGL_TRACE_SET_UNIFORM_SAMPLER, (int[2]){ locIndex, (int)textureId }, 2*sizeof(int));
+    }
+
+    // Check if texture is already active
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) if (RLGL.State.activeTextureId[i] == textureId) return;
+
+    // Register a new active texture for the internal batch system
+    // NOTE: Default texture is always activated as GL_TEXTURE0
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
+    {
+        if (RLGL.State.activeTextureId[i] == 0)
+        {
+            glUniform1i(locIndex, 1 + i);              // Activate new texture unit
+            RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
+            break;
+        }
+    }
+}
+
+// Set shader currently active (id and locations)
+void rlSetShader(unsigned int id, int *locs)
+{
+    if (RLGL_TRACE_ACTIVE)
+    {
+        int traceLocs[RL_MAX_SHADER_LOCATIONS] = { 0 };
+        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) traceLocs[i] = (locs != NULL)? locs[i] : -1;
+
+        rlTraceCommand(RLGL_TRACE_SET_SHADER, &id, sizeof(unsigned int));
+        rlTraceData(traceLocs, sizeof(traceLocs));
+    }
+
+    if (RLGL.State.currentShaderId != id) {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.currentShaderId = id;
+        RLGL.State.currentShaderLocs = locs;
+    }
+}
+
+// Matrix state management
+//-----------------------------------------------------------------------------------------
+// Get internal modelview matrix
+Matrix rlGetMatrixModelview(void)
+{
+    Matrix matrix = MatrixIdentity();
+    matrix = RLGL.State.modelview;
+    return matrix;
+}
+
+// Get internal projection matrix
+Matrix rlGetMatrixProjection(void)
+{
+    return RLGL.State.projection;
+}
+
+// Get internal accumulated transform matrix
+Matrix rlGetMatrixTransform(void) {
+    return RLGL.State.transform;
+}
+
+// Get internal projection matrix for stereo render (selected eye)
+Matrix rlGetMatrixProjectionStereo(int eye)
+{
+    Matrix mat = MatrixIdentity();
+    mat = RLGL.State.projectionStereo[eye];
+    return mat;
+}
+
+// Get internal view offset matrix for stereo render (selected eye)
+Matrix rlGetMatrixViewOffsetStereo(int eye)
+{
+    Matrix mat = MatrixIdentity();
+    mat = RLGL.State.viewOffsetStereo[eye];
+    return mat;
+}
+
+// Set a custom modelview matrix (replaces internal modelview matrix)
+void rlSetMatrixModelview(Matrix view)
+{
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_SET_MODELVIEW, &view, sizeof(Matrix));
+    RLGL.State.modelview = view;
+}
+
+// Set a custom projection matrix (replaces internal projection matrix)
+void rlSetMatrixProjection(Matrix projection)
+{
+    if (RLGL_TRACE_ACTIVE) rlTraceCommand(RLGL_TRACE_SET_PROJECTION, &projection, sizeof(Matrix));
+    RLGL.State.projection = projection;
+}
+
+// Set eyes projection matrices for stereo rendering
+void rlSetMatrixProjectionStereo(Matrix right, Matrix left)
+{
+    RLGL.State.projectionStereo[0] = right;
+    RLGL.State.projectionStereo[1] = left;
+}
+
+// Set eyes view offsets matrices for stereo rendering
+void rlSetMatrixViewOffsetStereo(Matrix right, Matrix left)
+{
+    RLGL.State.viewOffsetStereo[0] = right;
+    RLGL.State.viewOffsetStereo[1] = left;
+}
+
+// Get name string for pixel format
+const char *rlGetPixelFormatName(unsigned int format)
+{
+    switch (format)
+    {
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: return "GRAYSCALE"; break;         // 8 bit per pixel (no alpha)
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: return "GRAY_ALPHA"; break;       // 8*2 bpp (2 channels)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: return "R5G6B5"; break;               // 16 bpp
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: return "R8G8B8"; break;               // 24 bpp
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: return "R5G5B5A1"; break;           // 16 bpp (1 bit alpha)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: return "R4G4B4A4"; break;           // 16 bpp (4 bit alpha)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: return "R8G8B8A8"; break;           // 32 bpp
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: return "R32"; break;                     // 32 bpp (1 channel - float)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: return "R32G32B32"; break;         // 32*3 bpp (3 channels - float)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: return "R32G32B32A32"; break;   // 32*4 bpp (4 channels - float)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: return "DXT1_RGB"; break;             // 4 bpp (no alpha)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: return "DXT1_RGBA"; break;           // 4 bpp (1 bit alpha)
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: return "DXT3_RGBA"; break;           // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: return "DXT5_RGBA"; break;           // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: return "ETC1_RGB"; break;             // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: return "ETC2_RGB"; break;             // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: return "ETC2_RGBA"; break;       // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: return "PVRT_RGB"; break;             // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: return "PVRT_RGBA"; break;           // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: return "ASTC_4x4_RGBA"; break;   // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: return "ASTC_8x8_RGBA"; break;   // 2 bpp
+        default: return "UNKNOWN"; break;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Load default shader (just vertex positioning and texture coloring)
+// NOTE: This shader program is used for internal buffers
+// NOTE: Loaded: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
+static void rlLoadShaderDefault(void)
+{
+    RLGL.State.defaultShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.defaultShaderLocs[i] = -1;
+
+    // Vertex shader directly defined, no external file required
+    const char *defaultVShaderCode =
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in float vertexTexSlot;            \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "flat out int fragTexSlot;          \n"
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    fragTexSlot = int(vertexTexSlot); \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    // Fragment shader directly defined, no external file required
+    const char *defaultFShaderCode =
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "flat in int fragTexSlot;           \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform sampler2D textureSlots[7]; \n"    // Render batch texture slots 1..7 (slot 0 is texture0)
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = vec4(0.0);   \n"
+    "    if (fragTexSlot == 0) texelColor = texture(texture0, fragTexCoord);               \n"
+    "    else if (fragTexSlot == 1) texelColor = texture(textureSlots[0], fragTexCoord);   \n"
+    "    else if (fragTexSlot == 2) texelColor = texture(textureSlots[1], fragTexCoord);   \n"
+    "    else if (fragTexSlot == 3) texelColor = texture(textureSlots[2], fragTexCoord);   \n"
+    "    else if (fragTexSlot == 4) texelColor = texture(textureSlots[3], fragTexCoord);   \n"
+    "    else if (fragTexSlot == 5) texelColor = texture(textureSlots[4], fragTexCoord);   \n"
+    "    else if (fragTexSlot == 6) texelColor = texture(textureSlots[5], fragTexCoord);   \n"
+    "    else texelColor = texture(textureSlots[6], fragTexCoord);                         \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+
+    // Fragment shader for custom vertex shaders, they do not output fragTexSlot (batch draws are not folded, see rlSetTexture())
+    const char *defaultFShaderTexture0Code =
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+
+    RLGL.State.defaultVShaderCode = defaultVShaderCode;
+    RLGL.State.defaultFShaderCode = defaultFShaderCode;
+    RLGL.State.defaultFShaderTexture0Code = defaultFShaderTexture0Code;
+
+    // Default shader program could be available in shader cache
+    // NOTE: In that case vertex/fragment shaders are only compiled if required by a custom shader
+    unsigned long long hash = 0;
+    RLGL.State.defaultShaderId = rlLoadShaderProgramCache(defaultVShaderCode, defaultFShaderCode, &hash);
+
+    if (RLGL.State.defaultShaderId == 0)
+    {
+        // NOTE: Compiled vertex/fragment shaders are kept for re-use
+        RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
+        RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+
+        RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+        if (RLGL.State.defaultShaderId > 0) rlSaveShaderProgramCache(RLGL.State.defaultShaderId, hash);
+    }
+
+    if (RLGL.State.defaultShaderId > 0)
+    {
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Default shader loaded successfully", RLGL.State.defaultShaderId);
+
+        // Set default shader locations: attributes locations
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexPosition");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexTexCoord");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexColor");
+
+        // Set default shader locations: uniform locations
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.defaultShaderId, "mvp");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "colDiffuse");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "texture0");
+
+        // Set render batch texture slots samplers, slot texture units follow the additional batch texture units
+        int slotUnits[7] = { 0 };
+        for (int i = 0; i < 7; i++) slotUnits[i] = rlGetBatchTextureSlotUnit(i + 1);
+
+        rlCacheUseProgram(RLGL.State.defaultShaderId);
+        glUniform1iv(glGetUniformLocation(RLGL.State.defaultShaderId, "textureSlots"), 7, slotUnits);
+        rlCacheUseProgram(0);
+    }
+    else TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
+}
+
+// Unload default shader
+// NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
+static void rlUnloadShaderDefault(void)
+{
+    rlCacheUseProgram(0);
+
+    // NOTE: Deleting program detaches its shaders, default shaders could be not compiled (0)
+    // or not attached at all (default program loaded from shader cache)
+    glDeleteProgram(RLGL.State.defaultShaderId);
+
+    glDeleteShader(RLGL.State.defaultVShaderId);
+    glDeleteShader(RLGL.State.defaultFShaderId);
+    glDeleteShader(RLGL.State.defaultFShaderTexture0Id);
+    RLGL.State.defaultVShaderId = 0;
+    RLGL.State.defaultFShaderId = 0;
+    RLGL.State.defaultFShaderTexture0Id = 0;
+
+    RL_FREE(RLGL.State.defaultShaderLocs);
+
+    TRACELOG(LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
+}
+#endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
+
+// Get pixel data size in bytes (image or texture)
+// NOTE: Size depends on pixel format
+static int rlGetPixelDataSize(int width, int height, int format)
+{
+    int dataSize = 0;       // Size in bytes
+    int bpp = 0;            // Bits per pixel
+
+    switch (format)
+    {
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
+        default: break;
+    }
+
+    dataSize = (int)((long long)width*height*bpp/8);  // Total data size in bytes
+
+    // Compressed formats work on 4x4 blocks (8x8 for ASTC 8x8), incomplete blocks on borders
+    // are stored complete, so size is computed on block-aligned dimensions
+    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        int blockSize = (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)? 8 : 4;
+        int blocksX = (width + blockSize - 1)/blockSize;
+        int blocksY = (height + blockSize - 1)/blockSize;
+
+        // PVRTC 4bpp requires at least 2x2 blocks
+        if ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA))
+        {
+            if (blocksX < 2) blocksX = 2;
+            if (blocksY < 2) blocksY = 2;
+        }
+
+        dataSize = blocksX*blocksY*(blockSize*blockSize*bpp/8);
+    }
+
+    return dataSize;
+}
+
+// Load a render batch vertex buffer and leave it bound to GL_ARRAY_BUFFER
+// NOTE: If supported, storage is immutable and persistently mapped (mapped pointer returned),
+// otherwise regular dynamic storage is allocated and NULL returned (buffer orphaning on update)
+static void *rlLoadBatchVertexBuffer(unsigned int *id, const void *data, int size)
+{
+    void *mapped = NULL;
+
+    glGenBuffers(1, id);
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, *id);
+
+    if (RLGL.ExtSupported.bufferStorage)
+    {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_ARRAY_BUFFER, size, data, flags);
+        mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+
+        if (mapped == NULL)
+        {
+            // Immutable storage can not be reallocated, replace the buffer object
+            TRACELOG(LOG_WARNING, "RLGL: Failed to map render batch vertex buffer, using buffer orphaning");
+            rlCacheDeleteBuffers(1, id);
+            glGenBuffers(1, id);
+            rlCacheBindBuffer(GL_ARRAY_BUFFER, *id);
+        }
+    }
+
+    if (mapped == NULL) glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+
+    return mapped;
+}
+
+// Bind render batch vertex buffers to current shader attributes (position, texcoord, color, texture slot)
+// NOTE: Attribute locations are the same for both layouts, so default shader works with any of them
+static void rlSetBatchVertexAttributes(rlVertexBuffer *buffer)
+{
+    // Vertex texture slot buffer (shader-location = 15), read as float by shader
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[4]);
+    glVertexAttribPointer(RLGL_TEXTURE_SLOT_LOCATION, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(RLGL_TEXTURE_SLOT_LOCATION);
+
+    if (buffer->vertexData != NULL) rlSetInterleavedVertexAttributes(buffer->vboId[0]);
+    else
+    {
+        // Vertex position buffer (shader-location = 0)
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+
+        // Vertex texcoord buffer (shader-location = 1)
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+
+        // Vertex color buffer (shader-location = 3)
+        rlCacheBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+    }
+}
+
+// Bind interleaved vertex buffer (rlBatchVertex) to current shader attributes (position, texcoord, color)
+static void rlSetInterleavedVertexAttributes(unsigned int vboId)
+{
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, vboId);
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, x));
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, u));
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, r));
+
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+}
+
+// Add multiple vertex to current render batch draw call
+// NOTE: Equivalent to a sequence of rlTexCoord2f()/rlColor4ub()/rlVertex3f() calls, but space is reserved
+// once and plain attribute arrays are just copied, transform is deferred as in rlVertex3f().
+// If texcoords or colors are NULL, current texcoord/color are used for all the vertex
+static void rlVertexBulk(const float *positions, int positionSize, const float *texcoords, const unsigned char *colors, int count)
+{
+    rlCommandBuffer *cmd = threadCommandBuffer;
+    if (cmd != NULL)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            rlCommandBufferVertex(cmd, positions[i*positionSize], positions[i*positionSize + 1], (positionSize == 3)? positions[i*positionSize + 2] : cmd->currentDepth,
+                (texcoords != NULL)? &texcoords[2*i] : cmd->texcoord, (colors != NULL)? &colors[4*i] : cmd->color);
+        }
+        return;
+    }
+
+    if (RLGL_TRACE_ACTIVE)
+    {
+        rlTraceCommand(RLGL_TRACE_VERTEX_BULK, (int[3]){ positionSize, count, ((texcoords != NULL)? 1 : 0) | ((colors != NULL)? 2 : 0) }, 3*sizeof(int));
+        rlTraceData(positions, count*positionSize*sizeof(float));
+        if (texcoords != NULL) rlTraceData(texcoords, count*2*sizeof(float));
+        if (colors != NULL) rlTraceData(colors, count*4);
+    }
+
+    rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+    int first = RLGL.State.vertexCounter;
+
+    // Verify that current vertex buffer elements limit is not reached (or buffer can grow)
+    if (((first + count) > (buffer->elementCount*4)) && !rlGrowRenderBatch(first + count))
+    {
+        TRACELOG(LOG_ERROR, "RLGL: Batch elements overflow");
+        count = buffer->elementCount*4 - first;
+    }
+    if (count <= 0) return;
+
+    if (RLGL.State.transformRequired && !RLGL.State.transformPending)
+    {
+        RLGL.State.transformPending = true;
+        RLGL.State.transformFirst = first;
+    }
+
+    const float depth = RLGL.currentBatch->currentDepth;
+
+    if (buffer->vertexData != NULL)
+    {
+        rlBatchVertex *vertex = &buffer->vertexData[first];
+
+        for (int i = 0; i < count; i++)
+        {
+            vertex[i].x = positions[i*positionSize];
+            vertex[i].y = positions[i*positionSize + 1];
+            vertex[i].z = (positionSize == 3)? positions[i*positionSize + 2] : depth;
+
+            if (texcoords != NULL)
+            {
+                vertex[i].u = texcoords[2*i];
+                vertex[i].v = texcoords[2*i + 1];
+            }
+            else
+            {
+                vertex[i].u = RLGL.State.texcoordx;
+                vertex[i].v = RLGL.State.texcoordy;
+            }
+
+            if (colors != NULL) memcpy(&vertex[i].r, &colors[4*i], 4);
+            else
+            {
+                vertex[i].r = RLGL.State.colorr;
+                vertex[i].g = RLGL.State.colorg;
+                vertex[i].b = RLGL.State.colorb;
+                vertex[i].a = RLGL.State.colora;
+            }
+        }
+    }
+    else
+    {
+        float *vertices = &buffer->vertices[3*first];
+        float *texcoordsDst = &buffer->texcoords[2*first];
+        unsigned char *colorsDst = &buffer->colors[4*first];
+
+        // Add vertices
+        if (positionSize == 3) memcpy(vertices, positions, count*3*sizeof(float));
+        else
+        {
+            for (int i = 0; i < count; i++)
+            {
+                vertices[3*i] = positions[2*i];
+                vertices[3*i + 1] = positions[2*i + 1];
+                vertices[3*i + 2] = depth;
+            }
+        }
+
+        // Add texcoords
+        if (texcoords != NULL) memcpy(texcoordsDst, texcoords, count*2*sizeof(float));
+        else
+        {
+            for (int i = 0; i < count; i++)
+            {
+                texcoordsDst[2*i] = RLGL.State.texcoordx;
+                texcoordsDst[2*i + 1] = RLGL.State.texcoordy;
+            }
+        }
+
+        // Add colors
+        if (colors != NULL) memcpy(colorsDst, colors, count*4*sizeof(unsigned char));
+        else
+        {
+            for (int i = 0; i < count; i++)
+            {
+                colorsDst[4*i] = RLGL.State.colorr;
+                colorsDst[4*i + 1] = RLGL.State.colorg;
+                colorsDst[4*i + 2] = RLGL.State.colorb;
+                colorsDst[4*i + 3] = RLGL.State.colora;
+            }
+        }
+    }
+
+    // Add current texture slot (folded draw textures)
+    memset(&buffer->textureSlots[first], RLGL.State.textureSlot, count);
+
+    // Keep current texcoord/color state as if vertex were provided one by one
+    if (texcoords != NULL) rlTexCoord2f(texcoords[2*(count - 1)], texcoords[2*(count - 1) + 1]);
+    if (colors != NULL) rlColor4ub(colors[4*(count - 1)], colors[4*(count - 1) + 1], colors[4*(count - 1) + 2], colors[4*(count - 1) + 3]);
+
+    RLGL.State.vertexCounter += count;
+    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += count;
+}
+
+// Transform batch vertex added since last transform matrix change
+// NOTE: Vertex are stored untransformed by rlVertex3f()/rlVertexBulk*() while RLGL.State.transformRequired,
+// this function must be called before RLGL.State.transform is modified and before batch is uploaded
+static void rlApplyPendingTransform(void)
+{
+    if (!RLGL.State.transformPending) return;
+    RLGL.State.transformPending = false;
+
+    int count = RLGL.State.vertexCounter - RLGL.State.transformFirst;
+    if (count <= 0) return;
+
+    rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+
+    if (buffer->vertexData != NULL) rlTransformVertex(&buffer->vertexData[RLGL.State.transformFirst].x, sizeof(rlBatchVertex)/sizeof(float), count, &RLGL.State.transform);
+    else rlTransformVertex(&buffer->vertices[3*RLGL.State.transformFirst], 3, count, &RLGL.State.transform);
+}
+
+// Transform vertex positions in place, stride is provided in floats (3 or more)
+// NOTE: SIMD kernels keep the same operations order, results are identical to this one
+static void rlTransformVertexScalar(float *positions, int stride, int count, const Matrix *mat)
+{
+    for (int i = 0; i < count; i++, positions += stride)
+    {
+        float x = positions[0];
+        float y = positions[1];
+        float z = positions[2];
+
+        positions[0] = mat->m0*x + mat->m4*y + mat->m8*z + mat->m12;
+        positions[1] = mat->m1*x + mat->m5*y + mat->m9*z + mat->m13;
+        positions[2] = mat->m2*x + mat->m6*y + mat->m10*z + mat->m14;
+    }
+}
+
+// NOTE: SIMD kernels transform 4 (or 8) vertex per step, packed positions (stride 3) are deinterleaved
+// from 3 registers, other strides load 4 floats per vertex and transpose them, 4th float is written back unchanged
+#if defined(RLGL_SIMD_SSE2)
+// Transform vertex positions in place, SSE2 version
+static void rlTransformVertexSSE2(float *positions, int stride, int count, const Matrix *mat)
+{
+    const __m128 m0 = _mm_set1_ps(mat->m0), m4 = _mm_set1_ps(mat->m4), m8 = _mm_set1_ps(mat->m8), m12 = _mm_set1_ps(mat->m12);
+    const __m128 m1 = _mm_set1_ps(mat->m1), m5 = _mm_set1_ps(mat->m5), m9 = _mm_set1_ps(mat->m9), m13 = _mm_set1_ps(mat->m13);
+    const __m128 m2 = _mm_set1_ps(mat->m2), m6 = _mm_set1_ps(mat->m6), m10 = _mm_set1_ps(mat->m10), m14 = _mm_set1_ps(mat->m14);
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4, positions += 4*stride)
+    {
+        __m128 x, y, z, w;
+
+        if (stride == 3)
+        {
+            // Deinterleave x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+            __m128 a = _mm_loadu_ps(positions);
+            __m128 b = _mm_loadu_ps(positions + 4);
+            __m128 c = _mm_loadu_ps(positions + 8);
+            x = _mm_shuffle_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 3, 0)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 1, 0));
+            y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+            z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+            w = _mm_setzero_ps();
+        }
+        else
+        {
+            x = _mm_loadu_ps(positions);
+            y = _mm_loadu_ps(positions + stride);
+            z = _mm_loadu_ps(positions + 2*stride);
+            w = _mm_loadu_ps(positions + 3*stride);
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+        }
+
+        __m128 tx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_mul_ps(m8, z)), m12);
+        __m128 ty = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_mul_ps(m9, z)), m13);
+        __m128 tz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_mul_ps(m10, z)), m14);
+
+        if (stride == 3)
+        {
+            // Interleave back to x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+            _mm_storeu_ps(positions, _mm_shuffle_ps(_mm_shuffle_ps(tx, ty, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(tz, tx, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps(positions + 4, _mm_shuffle_ps(_mm_shuffle_ps(ty, tz, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(tx, ty, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps(positions + 8, _mm_shuffle_ps(_mm_shuffle_ps(tz, tx, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(ty, tz, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+        }
+        else
+        {
+            _MM_TRANSPOSE4_PS(tx, ty, tz, w);
+            _mm_storeu_ps(positions, tx);
+            _mm_storeu_ps(positions + stride, ty);
+            _mm_storeu_ps(positions + 2*stride, tz);
+            _mm_storeu_ps(positions + 3*stride, w);
+        }
+    }
+
+    rlTransformVertexScalar(positions, stride, count - i, mat);
+}
+#endif
+
+#if defined(RLGL_SIMD_AVX2)
+// Check AVX2 support on current CPU (and OS support for AVX registers state)
+static bool rlCpuSupportsAVX2(void)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4] = { 0 };
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+
+    __cpuid(info, 1);
+    if (!(info[2] & (1 << 27)) || !(info[2] & (1 << 28))) return false;     // OSXSAVE and AVX
+    if ((_xgetbv(0) & 0x6) != 0x6) return false;                            // XMM and YMM state enabled by OS
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;                                       // AVX2
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+// Transform vertex positions in place, AVX2 version
+// NOTE: Every 256-bit register holds vertex n in low lane and vertex n + 4 in high lane,
+// so deinterleave/transpose are the same in-lane shuffles used by SSE2 version
+RLGL_TARGET_AVX2 static void rlTransformVertexAVX2(float *positions, int stride, int count, const Matrix *mat)
+{
+    const __m256 m0 = _mm256_set1_ps(mat->m0), m4 = _mm256_set1_ps(mat->m4), m8 = _mm256_set1_ps(mat->m8), m12 = _mm256_set1_ps(mat->m12);
+    const __m256 m1 = _mm256_set1_ps(mat->m1), m5 = _mm256_set1_ps(mat->m5), m9 = _mm256_set1_ps(mat->m9), m13 = _mm256_set1_ps(mat->m13);
+    const __m256 m2 = _mm256_set1_ps(mat->m2), m6 = _mm256_set1_ps(mat->m6), m10 = _mm256_set1_ps(mat->m10), m14 = _mm256_set1_ps(mat->m14);
+    int i = 0;
+
+    for (; i + 8 <= count; i += 8, positions += 8*stride)
+    {
+        __m256 x, y, z, w;
+
+        if (stride == 3)
+        {
+            __m256 r0 = _mm256_loadu_ps(positions);
+            __m256 r1 = _mm256_loadu_ps(positions + 8);
+            __m256 r2 = _mm256_loadu_ps(positions + 16);
+            __m256 a = _mm256_permute2f128_ps(r0, r1, 0x30);
+            __m256 b = _mm256_permute2f128_ps(r0, r2, 0x21);
+            __m256 c = _mm256_permute2f128_ps(r1, r2, 0x30);
+            x = _mm256_shuffle_ps(_mm256_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 3, 0)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 1, 0));
+            y = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+            z = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+            w = _mm256_setzero_ps();
+        }
+        else
+        {
+            __m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(positions)), _mm_loadu_ps(positions + 4*stride), 1);
+            __m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(positions + stride)), _mm_loadu_ps(positions + 5*stride), 1);
+            __m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(positions + 2*stride)), _mm_loadu_ps(positions + 6*stride), 1);
+            __m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(positions + 3*stride)), _mm_loadu_ps(positions + 7*stride), 1);
+            __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+            __m256 t1 = _mm256_unpacklo_ps(r2, r3);
+            __m256 t2 = _mm256_unpackhi_ps(r0, r1);
+            __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+            x = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+            y = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+            z = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            w = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        __m256 tx = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m0, x), _mm256_mul_ps(m4, y)), _mm256_mul_ps(m8, z)), m12);
+        __m256 ty = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m1, x), _mm256_mul_ps(m5, y)), _mm256_mul_ps(m9, z)), m13);
+        __m256 tz = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m2, x), _mm256_mul_ps(m6, y)), _mm256_mul_ps(m10, z)), m14);
+
+        if (stride == 3)
+        {
+            __m256 a = _mm256_shuffle_ps(_mm256_shuffle_ps(tx, ty, _MM_SHUFFLE(0, 0, 0, 0)), _mm256_shuffle_ps(tz, tx, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+            __m256 b = _mm256_shuffle_ps(_mm256_shuffle_ps(ty, tz, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_shuffle_ps(tx, ty, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+            __m256 c = _mm256_shuffle_ps(_mm256_shuffle_ps(tz, tx, _MM_SHUFFLE(3, 3, 2, 2)), _mm256_shuffle_ps(ty, tz, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+            _mm256_storeu_ps(positions, _mm256_permute2f128_ps(a, b, 0x20));
+            _mm256_storeu_ps(positions + 8, _mm256_permute2f128_ps(c, a, 0x30));
+            _mm256_storeu_ps(positions + 16, _mm256_permute2f128_ps(b, c, 0x31));
+        }
+        else
+        {
+            __m256 t0 = _mm256_unpacklo_ps(tx, ty);
+            __m256 t1 = _mm256_unpacklo_ps(tz, w);
+            __m256 t2 = _mm256_unpackhi_ps(tx, ty);
+            __m256 t3 = _mm256_unpackhi_ps(tz, w);
+            __m256 r0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+            __m256 r1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+            __m256 r2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            __m256 r3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+            _mm_storeu_ps(positions, _mm256_castps256_ps128(r0));
+            _mm_storeu_ps(positions + stride, _mm256_castps256_ps128(r1));
+            _mm_storeu_ps(positions + 2*stride, _mm256_castps256_ps128(r2));
+            _mm_storeu_ps(positions + 3*stride, _mm256_castps256_ps128(r3));
+            _mm_storeu_ps(positions + 4*stride, _mm256_extractf128_ps(r0, 1));
+            _mm_storeu_ps(positions + 5*stride, _mm256_extractf128_ps(r1, 1));
+            _mm_storeu_ps(positions + 6*stride, _mm256_extractf128_ps(r2, 1));
+            _mm_storeu_ps(positions + 7*stride, _mm256_extractf128_ps(r3, 1));
+        }
+    }
+
+    rlTransformVertexScalar(positions, stride, count - i, mat);
+}
+#endif
+
+#if defined(RLGL_SIMD_NEON)
+// Transpose 4x4 floats block (4 vertex to x, y, z, w and back)
+static void rlTransposeNEON(float32x4_t *r0, float32x4_t *r1, float32x4_t *r2, float32x4_t *r3)
+{
+    float32x4x2_t a = vtrnq_f32(*r0, *r1);
+    float32x4x2_t b = vtrnq_f32(*r2, *r3);
+
+    *r0 = vcombine_f32(vget_low_f32(a.val[0]), vget_low_f32(b.val[0]));
+    *r1 = vcombine_f32(vget_low_f32(a.val[1]), vget_low_f32(b.val[1]));
+    *r2 = vcombine_f32(vget_high_f32(a.val[0]), vget_high_f32(b.val[0]));
+    *r3 = vcombine_f32(vget_high_f32(a.val[1]), vget_high_f32(b.val[1]));
+}
+
+// Transform vertex positions in place, NEON version
+static void rlTransformVertexNEON(float *positions, int stride, int count, const Matrix *mat)
+{
+    const float32x4_t m0 = vdupq_n_f32(mat->m0), m4 = vdupq_n_f32(mat->m4), m8 = vdupq_n_f32(mat->m8), m12 = vdupq_n_f32(mat->m12);
+    const float32x4_t m1 = vdupq_n_f32(mat->m1), m5 = vdupq_n_f32(mat->m5), m9 = vdupq_n_f32(mat->m9), m13 = vdupq_n_f32(mat->m13);
+    const float32x4_t m2 = vdupq_n_f32(mat->m2), m6 = vdupq_n_f32(mat->m6), m10 = vdupq_n_f32(mat->m10), m14 = vdupq_n_f32(mat->m14);
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4, positions += 4*stride)
+    {
+        float32x4x3_t v;
+        float32x4_t w = vdupq_n_f32(0.0f);
+
+        if (stride == 3) v = vld3q_f32(positions);
+        else
+        {
+            v.val[0] = vld1q_f32(positions);
+            v.val[1] = vld1q_f32(positions + stride);
+            v.val[2] = vld1q_f32(positions + 2*stride);
+            w = vld1q_f32(positions + 3*stride);
+            rlTransposeNEON(&v.val[0], &v.val[1], &v.val[2], &w);
+        }
+
+        // NOTE: vmlaq_f32() could be fused on some targets, separated mul/add keep results identical to scalar
+        float32x4_t x = v.val[0], y = v.val[1], z = v.val[2];
+        v.val[0] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(m0, x), vmulq_f32(m4, y)), vmulq_f32(m8, z)), m12);
+        v.val[1] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(m1, x), vmulq_f32(m5, y)), vmulq_f32(m9, z)), m13);
+        v.val[2] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(m2, x), vmulq_f32(m6, y)), vmulq_f32(m10, z)), m14);
+
+        if (stride == 3) vst3q_f32(positions, v);
+        else
+        {
+            rlTransposeNEON(&v.val[0], &v.val[1], &v.val[2], &w);
+            vst1q_f32(positions, v.val[0]);
+            vst1q_f32(positions + stride, v.val[1]);
+            vst1q_f32(positions + 2*stride, v.val[2]);
+            vst1q_f32(positions + 3*stride, w);
+        }
+    }
+
+    rlTransformVertexScalar(positions, stride, count - i, mat);
+}
+#endif
+
+// Close current batch draw call (if it contains vertex) and setup next one with current layer
+// NOTE: Draws are forced to a batch draw if RL_DEFAULT_BATCH_DRAWCALLS limit is reached
+static void rlNextDrawCall(void)
+{
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+    if (draw->vertexCount > 0)
+    {
+        // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
+        // that way, following QUADS drawing will keep aligned with index processing
+        // It implies adding some extra alignment vertex at the end of the draw,
+        // those vertex are not processed but they are considered as an additional offset
+        // for the next set of vertex to be drawn
+        if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+        else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+        else draw->vertexAlignment = 0;
+
+        // NOTE: Limit check is internal (replayed by rlBegin()/rlSetTexture()), it is not traced
+        RLGL.Trace.suspended++;
+        bool overflow = rlCheckRenderBatchLimit(draw->vertexAlignment);
+        RLGL.Trace.suspended--;
+
+        if (!overflow)
+        {
+            RLGL.State.vertexCounter += draw->vertexAlignment;
+            RLGL.currentBatch->drawCounter++;
+        }
+    }
+
+    if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+
+    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureCount = 0;
+    RLGL.State.textureSlot = 0;
+    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.drawLayer;
+    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layerOrdered = RLGL.State.drawLayerOrdered;
+}
+
+// Compare batch draw calls for sorted drawing: layer, texture, mode and submission order
+// NOTE: Draws of ordered layers are only compared by submission order, it keeps qsort() stable
+// NOTE: Shader and blending changes force a batch draw, so all the draws in a batch share them
+static int rlCompareDrawCalls(const void *a, const void *b)
+{
+    const rlDrawCall *drawA = *(const rlDrawCall **)a;
+    const rlDrawCall *drawB = *(const rlDrawCall **)b;
+
+    if (drawA->layer != drawB->layer) return (drawA->layer < drawB->layer)? -1 : 1;
+    if (drawA->layerOrdered != drawB->layerOrdered) return drawA->layerOrdered? -1 : 1;
+    if (!drawA->layerOrdered)
+    {
+        if (drawA->textureId != drawB->textureId) return (drawA->textureId < drawB->textureId)? -1 : 1;
+        if (drawA->mode != drawB->mode) return (drawA->mode < drawB->mode)? -1 : 1;
+    }
+
+    return (drawA < drawB)? -1 : ((drawA > drawB)? 1 : 0);
+}
+
+// Grow current batch vertex buffer to fit the required vertex count
+// NOTE: Buffer size is doubled until it fits, up to RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS,
+// false is returned if it can not fit, a batch draw must be forced in that case
+static bool rlGrowRenderBatch(int vertexCount)
+{
+    rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+    int elementCount = buffer->elementCount;
+
+    while (((elementCount*4) < vertexCount) && (elementCount < RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS)) elementCount *= 2;
+    if (elementCount > RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS) elementCount = RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS;
+    if ((elementCount*4) < vertexCount) return false;
+
+    TRACELOG(LOG_INFO, "RLGL: Render batch buffer grown from %i to %i elements", buffer->elementCount, elementCount);
+    rlResizeBatchVertexBuffer(buffer, elementCount);
+    RLGL.State.batchStats.growCount++;
+
+    return true;
+}
+
+// Resize batch vertex buffer to a new number of elements (quads)
+// NOTE: CPU arrays keep current vertex data, GPU buffers are recreated (data is uploaded on batch draw)
+static void rlResizeBatchVertexBuffer(rlVertexBuffer *buffer, int elementCount)
+{
+    // Resize CPU (RAM) arrays
+    if (buffer->vertexData != NULL) buffer->vertexData = (rlBatchVertex *)RL_REALLOC(buffer->vertexData, elementCount*4*sizeof(rlBatchVertex));
+    else
+    {
+        buffer->vertices = (float *)RL_REALLOC(buffer->vertices, elementCount*3*4*sizeof(float));
+        buffer->texcoords = (float *)RL_REALLOC(buffer->texcoords, elementCount*2*4*sizeof(float));
+        buffer->colors = (unsigned char *)RL_REALLOC(buffer->colors, elementCount*4*4*sizeof(unsigned char));
+    }
+
+    buffer->indices = (unsigned int *)RL_REALLOC(buffer->indices, elementCount*6*sizeof(unsigned int));
+    buffer->textureSlots = (unsigned char *)RL_REALLOC(buffer->textureSlots, elementCount*4*sizeof(unsigned char));
+
+    for (int k = buffer->elementCount; k < elementCount; k++)
+    {
+        buffer->indices[6*k] = 4*k;
+        buffer->indices[6*k + 1] = 4*k + 1;
+        buffer->indices[6*k + 2] = 4*k + 2;
+        buffer->indices[6*k + 3] = 4*k;
+        buffer->indices[6*k + 4] = 4*k + 2;
+        buffer->indices[6*k + 5] = 4*k + 3;
+    }
+
+    buffer->elementCount = elementCount;
+
+    // Recreate GPU (VRAM) buffers
+    // NOTE: Deleted buffers still in use by the GPU are released by the driver once it is done with them
+    if (buffer->syncFence != NULL)
+    {
+        glDeleteSync((GLsync)buffer->syncFence);
+        buffer->syncFence = NULL;
+    }
+
+    rlCacheDeleteBuffers(1, &buffer->vboId[0]);
+    rlCacheDeleteBuffers(1, &buffer->vboId[1]);
+    rlCacheDeleteBuffers(1, &buffer->vboId[2]);
+    rlCacheDeleteBuffers(1, &buffer->vboId[3]);
+    rlCacheDeleteBuffers(1, &buffer->vboId[4]);
+
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(buffer->vaoId);
+
+    if (buffer->vertexData != NULL)
+    {
+        buffer->vboMapped[0] = rlLoadBatchVertexBuffer(&buffer->vboId[0], NULL, elementCount*4*sizeof(rlBatchVertex));
+        buffer->vboId[1] = 0;
+        buffer->vboId[2] = 0;
+    }
+    else
+    {
+        buffer->vboMapped[0] = rlLoadBatchVertexBuffer(&buffer->vboId[0], NULL, elementCount*3*4*sizeof(float));
+        buffer->vboMapped[1] = rlLoadBatchVertexBuffer(&buffer->vboId[1], NULL, elementCount*2*4*sizeof(float));
+        buffer->vboMapped[2] = rlLoadBatchVertexBuffer(&buffer->vboId[2], NULL, elementCount*4*4*sizeof(unsigned char));
+    }
+
+    glGenBuffers(1, &buffer->vboId[4]);
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[4]);
+    glBufferData(GL_ARRAY_BUFFER, elementCount*4*sizeof(unsigned char), NULL, GL_DYNAMIC_DRAW);
+
+    rlSetBatchVertexAttributes(buffer);
+
+    glGenBuffers(1, &buffer->vboId[3]);
+    rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->vboId[3]);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, elementCount*6*sizeof(int), buffer->indices, GL_STATIC_DRAW);
+
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
+    else rlCacheBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    rlCacheBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// Capture batch vertex data and draws into current display list recording
+// NOTE: Vertex are converted to interleaved layout and draws to indexed LINES/TRIANGLES,
+// consecutive draws with same mode and texture are merged into one
+static void rlRecordRenderBatch(rlRenderBatch *batch)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    int vertexCount = RLGL.State.vertexCounter;
+    int indexCount = 0;
+
+    if (vertexCount == 0) return;
+
+    for (int i = 0; i < batch->drawCounter; i++) indexCount += ((batch->draws[i].mode == RL_QUADS)? batch->draws[i].vertexCount/4*6 : batch->draws[i].vertexCount);
+
+    // Grow captured data arrays if required
+    if ((RLGL.Record.vertexCount + vertexCount) > RLGL.Record.vertexCapacity)
+    {
+        while ((RLGL.Record.vertexCount + vertexCount) > RLGL.Record.vertexCapacity) RLGL.Record.vertexCapacity = (RLGL.Record.vertexCapacity > 0)? RLGL.Record.vertexCapacity*2 : 4096;
+        RLGL.Record.vertices = (rlBatchVertex *)RL_REALLOC(RLGL.Record.vertices, RLGL.Record.vertexCapacity*sizeof(rlBatchVertex));
+    }
+    if ((RLGL.Record.indexCount + indexCount) > RLGL.Record.indexCapacity)
+    {
+        while ((RLGL.Record.indexCount + indexCount) > RLGL.Record.indexCapacity) RLGL.Record.indexCapacity = (RLGL.Record.indexCapacity > 0)? RLGL.Record.indexCapacity*2 : 6144;
+        RLGL.Record.indices = (unsigned int *)RL_REALLOC(RLGL.Record.indices, RLGL.Record.indexCapacity*sizeof(unsigned int));
+    }
+    if ((RLGL.Record.drawCount + batch->drawCounter) > RLGL.Record.drawCapacity)
+    {
+        while ((RLGL.Record.drawCount + batch->drawCounter) > RLGL.Record.drawCapacity) RLGL.Record.drawCapacity = (RLGL.Record.drawCapacity > 0)? RLGL.Record.drawCapacity*2 : 64;
+        RLGL.Record.draws = (rlDisplayListDraw *)RL_REALLOC(RLGL.Record.draws, RLGL.Record.drawCapacity*sizeof(rlDisplayListDraw));
+    }
+
+    // Capture vertex data
+    rlBatchVertex *vertices = &RLGL.Record.vertices[RLGL.Record.vertexCount];
+
+    if (buffer->vertexData != NULL) memcpy(vertices, buffer->vertexData, vertexCount*sizeof(rlBatchVertex));
+    else
+    {
+        for (int i = 0; i < vertexCount; i++)
+        {
+            vertices[i].x = buffer->vertices[3*i];
+            vertices[i].y = buffer->vertices[3*i + 1];
+            vertices[i].z = buffer->vertices[3*i + 2];
+            vertices[i].u = buffer->texcoords[2*i];
+            vertices[i].v = buffer->texcoords[2*i + 1];
+            memcpy(&vertices[i].r, &buffer->colors[4*i], 4);
+        }
+    }
+
+    // Capture draws as indexed geometry
+    for (int i = 0, vertexOffset = RLGL.Record.vertexCount; i < batch->drawCounter; i++)
+    {
+        const rlDrawCall *draw = &batch->draws[i];
+        unsigned int *indices = &RLGL.Record.indices[RLGL.Record.indexCount];
+        int drawIndexCount = 0;
+
+        if (draw->mode == RL_QUADS)
+        {
+            for (int k = 0; k < draw->vertexCount/4; k++, drawIndexCount += 6)
+            {
+                indices[drawIndexCount] = vertexOffset + 4*k;
+                indices[drawIndexCount + 1] = vertexOffset + 4*k + 1;
+                indices[drawIndexCount + 2] = vertexOffset + 4*k + 2;
+                indices[drawIndexCount + 3] = vertexOffset + 4*k;
+                indices[drawIndexCount + 4] = vertexOffset + 4*k + 2;
+                indices[drawIndexCount + 5] = vertexOffset + 4*k + 3;
+            }
+        }
+        else
+        {
+            for (int k = 0; k < draw->vertexCount; k++, drawIndexCount++) indices[drawIndexCount] = vertexOffset + k;
+        }
+
+        vertexOffset += (draw->vertexCount + draw->vertexAlignment);
+        if (drawIndexCount == 0) continue;
+
+        int mode = (draw->mode == RL_LINES)? RL_LINES : RL_TRIANGLES;
+        rlDisplayListDraw *last = (RLGL.Record.drawCount > 0)? &RLGL.Record.draws[RLGL.Record.drawCount - 1] : NULL;
+
+        if ((last != NULL) && (last->mode == mode) && (last->textureId == draw->textureId)) last->indexCount += drawIndexCount;
+        else
+        {
+            RLGL.Record.draws[RLGL.Record.drawCount].mode = mode;
+            RLGL.Record.draws[RLGL.Record.drawCount].indexOffset = RLGL.Record.indexCount;
+            RLGL.Record.draws[RLGL.Record.drawCount].indexCount = drawIndexCount;
+            RLGL.Record.draws[RLGL.Record.drawCount].textureId = draw->textureId;
+            RLGL.Record.drawCount++;
+        }
+
+        RLGL.Record.indexCount += drawIndexCount;
+    }
+
+    RLGL.Record.vertexCount += vertexCount;
+}
+
+// Use shader program (filtered by GL state cache)
+static void rlCacheUseProgram(unsigned int id)
+{
+    if (RLGL.Cache.shaderId == id) { RLGL.Cache.stats.skippedCount++; return; }
+
+    glUseProgram(id);
+    RLGL.Cache.shaderId = id;
+    RLGL.Cache.stats.issuedCount++;
+}
+
+// Select active texture slot (filtered by GL state cache)
+static void rlCacheActiveTexture(unsigned int slot)
+{
+    if (RLGL.Cache.textureSlot == slot) { RLGL.Cache.stats.skippedCount++; return; }
+
+    glActiveTexture(GL_TEXTURE0 + slot);
+    RLGL.Cache.textureSlot = slot;
+    RLGL.Cache.stats.issuedCount++;
+}
+
+// Bind texture 2D or cubemap on active slot (filtered by GL state cache)
+// NOTE: Other targets and slots over RLGL_CACHE_TEXTURE_SLOTS are always issued
+static void rlCacheBindTexture(unsigned int target, unsigned int id)
+{
+    unsigned int slot = RLGL.Cache.textureSlot;
+    unsigned int *cached = NULL;
+
+    if (slot < RLGL_CACHE_TEXTURE_SLOTS)
+    {
+        if (target == GL_TEXTURE_2D) cached = &RLGL.Cache.textureId[slot];
+        else if (target == GL_TEXTURE_CUBE_MAP) cached = &RLGL.Cache.cubemapId[slot];
     }
-    return result;
+
+    if ((cached != NULL) && (*cached == id)) { RLGL.Cache.stats.skippedCount++; return; }
+
+    glBindTexture(target, id);
+    if (cached != NULL) *cached = id;
+    RLGL.Cache.stats.issuedCount++;
 }
 
-// Disable vertex array object (VAO)
-void rlDisableVertexArray(void)
+// Bind vertex array (filtered by GL state cache)
+static void rlCacheBindVertexArray(unsigned int id)
 {
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.Cache.vaoId == id) { RLGL.Cache.stats.skippedCount++; return; }
+
+    glBindVertexArray(id);
+    RLGL.Cache.vaoId = id;
+    RLGL.Cache.eboId = RLGL_CACHE_UNKNOWN;     // Element buffer binding is stored in the VAO
+    RLGL.Cache.stats.issuedCount++;
 }
 
-// Enable vertex attribute index
-void rlEnableVertexAttribute(unsigned int index)
+// Bind vertex or element buffer (filtered by GL state cache)
+static void rlCacheBindBuffer(unsigned int target, unsigned int id)
 {
-    glEnableVertexAttribArray(index);
+    unsigned int *cached = NULL;
+
+    if (target == GL_ARRAY_BUFFER) cached = &RLGL.Cache.vboId;
+    else if (target == GL_ELEMENT_ARRAY_BUFFER) cached = &RLGL.Cache.eboId;
+
+    if ((cached != NULL) && (*cached == id)) { RLGL.Cache.stats.skippedCount++; return; }
+
+    glBindBuffer(target, id);
+    if (cached != NULL) *cached = id;
+    RLGL.Cache.stats.issuedCount++;
 }
 
-// Disable vertex attribute index
-void rlDisableVertexAttribute(unsigned int index)
+// Enable/disable OpenGL capability (filtered by GL state cache)
+// NOTE: Capabilities not tracked by the cache are always issued
+static void rlCacheCapability(unsigned int cap, bool enabled)
 {
-    glDisableVertexAttribArray(index);
+    unsigned int *cached = NULL;
+
+    switch (cap)
+    {
+        case GL_BLEND: cached = &RLGL.Cache.blend; break;
+        case GL_DEPTH_TEST: cached = &RLGL.Cache.depthTest; break;
+        case GL_CULL_FACE: cached = &RLGL.Cache.cullFace; break;
+        case GL_SCISSOR_TEST: cached = &RLGL.Cache.scissorTest; break;
+        default: break;
+    }
+
+    if ((cached != NULL) && (*cached == (unsigned int)enabled)) { RLGL.Cache.stats.skippedCount++; return; }
+
+    if (enabled) glEnable(cap);
+    else glDisable(cap);
+    if (cached != NULL) *cached = (unsigned int)enabled;
+    RLGL.Cache.stats.issuedCount++;
 }
 
-// Draw vertex array
-void rlDrawVertexArray(int offset, int count)
+// Enable/disable depth write (filtered by GL state cache)
+static void rlCacheDepthMask(bool enabled)
 {
-    glDrawArrays(GL_TRIANGLES, offset, count);
+    if (RLGL.Cache.depthMask == (unsigned int)enabled) { RLGL.Cache.stats.skippedCount++; return; }
+
+    glDepthMask(enabled? GL_TRUE : GL_FALSE);
+    RLGL.Cache.depthMask = (unsigned int)enabled;
+    RLGL.Cache.stats.issuedCount++;
 }
 
-// Draw vertex array elements
-void rlDrawVertexArrayElements(int offset, int count, void *buffer)
+// Set blending function (filtered by GL state cache)
+static void rlCacheBlendFunction(unsigned int src, unsigned int dst, unsigned int equation)
 {
-    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (unsigned short *)buffer + offset);
+    if ((RLGL.Cache.blendSrcFactor != src) || (RLGL.Cache.blendDstFactor != dst))
+    {
+        glBlendFunc(src, dst);
+        RLGL.Cache.blendSrcFactor = src;
+        RLGL.Cache.blendDstFactor = dst;
+        RLGL.Cache.stats.issuedCount++;
+    }
+    else RLGL.Cache.stats.skippedCount++;
+
+    if (RLGL.Cache.blendEquation != equation)
+    {
+        glBlendEquation(equation);
+        RLGL.Cache.blendEquation = equation;
+        RLGL.Cache.stats.issuedCount++;
+    }
+    else RLGL.Cache.stats.skippedCount++;
 }
 
-// Draw vertex array instanced
-void rlDrawVertexArrayInstanced(int offset, int count, int instances)
+// Delete textures, cached bindings are cleared
+// NOTE: OpenGL unbinds deleted textures from all slots, the cache is updated the same way
+static void rlCacheDeleteTextures(int count, const unsigned int *ids)
 {
-    glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+    glDeleteTextures(count, ids);
+
+    for (int i = 0; i < count; i++)
+    {
+        if (ids[i] == 0) continue;
+
+        for (int k = 0; k < RLGL_CACHE_TEXTURE_SLOTS; k++)
+        {
+            if (RLGL.Cache.textureId[k] == ids[i]) RLGL.Cache.textureId[k] = 0;
+            if (RLGL.Cache.cubemapId[k] == ids[i]) RLGL.Cache.cubemapId[k] = 0;
+        }
+    }
 }
 
-// Draw vertex array elements instanced
-void rlDrawVertexArrayElementsInstanced(int offset, int count, void *buffer, int instances)
+// Delete buffers, cached bindings are cleared
+static void rlCacheDeleteBuffers(int count, const unsigned int *ids)
 {
-    glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (unsigned short *)buffer + offset, instances);
+    glDeleteBuffers(count, ids);
+
+    for (int i = 0; i < count; i++)
+    {
+        if (ids[i] == 0) continue;
+
+        if (RLGL.Cache.vboId == ids[i]) RLGL.Cache.vboId = 0;
+        if (RLGL.Cache.eboId == ids[i]) RLGL.Cache.eboId = 0;
+    }
 }
 
-// Load vertex array object (VAO)
-unsigned int rlLoadVertexArray(void)
+// Delete vertex arrays, cached bindings are cleared
+static void rlCacheDeleteVertexArrays(int count, const unsigned int *ids)
 {
-    unsigned int vaoId = 0;
-    if (RLGL.ExtSupported.vao)
-        glGenVertexArrays(1, &vaoId);
-    return vaoId;
+    glDeleteVertexArrays(count, ids);
+
+    for (int i = 0; i < count; i++)
+    {
+        if ((ids[i] != 0) && (RLGL.Cache.vaoId == ids[i]))
+        {
+            RLGL.Cache.vaoId = 0;
+            RLGL.Cache.eboId = RLGL_CACHE_UNKNOWN;
+        }
+    }
+}
+
+// Load shader program binary from shader cache
+// NOTE: Cache key is a hash of shader code, device (vendor, renderer, version) and default attribute names,
+// returned program is 0 if shader cache is disabled, not supported, not found or binary is rejected by driver
+static unsigned int rlLoadShaderProgramCache(const char *vsCode, const char *fsCode, unsigned long long *hash)
+{
+    *hash = 0;
+    if ((RLGL.State.shaderCachePath[0] == '\0') || !RLGL.ExtSupported.programBinary) return 0;
+
+    // FNV-1a 64bit hash of all the strings affecting program binary
+    const char *keys[] = {
+        (const char *)glGetString(GL_VENDOR), (const char *)glGetString(GL_RENDERER), (const char *)glGetString(GL_VERSION),
+        RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL,
+        RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2,
+        RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT, vsCode, fsCode
+    };
+    unsigned long long value = 14695981039346656037ULL;
+    for (int i = 0; i < (int)(sizeof(keys)/sizeof(keys[0])); i++)
+    {
+        const unsigned char *key = (const unsigned char *)((keys[i] != NULL)? keys[i] : "");
+        while (*key != '\0') { value ^= *key++; value *= 1099511628211ULL; }
+        value ^= 0xff; value *= 1099511628211ULL;       // Strings separator
+    }
+    *hash = value;
+
+    char fileName[600] = { 0 };
+    snprintf(fileName, sizeof(fileName), "%s/%016llx.rlsb", RLGL.State.shaderCachePath, value);
+    if (!FileExists(fileName)) return 0;
+
+    // File layout: "RLSB" identifier, binary format (unsigned int), binary data
+    unsigned int dataSize = 0;
+    unsigned char *data = LoadFileData(fileName, &dataSize);
+    unsigned int id = 0;
+
+    if ((data != NULL) && (dataSize > 8) && (memcmp(data, "RLSB", 4) == 0))
+    {
+        unsigned int format = 0;
+        memcpy(&format, data + 4, sizeof(unsigned int));
+
+        id = glCreateProgram();
+        glProgramBinary(id, format, data + 8, dataSize - 8);
+
+        GLint success = 0;
+        glGetProgramiv(id, GL_LINK_STATUS, &success);
+        if (success == GL_FALSE)
+        {
+            // NOTE: Binaries are rejected by driver updates or different devices, source code is compiled again
+            TRACELOG(LOG_INFO, "SHADER: [%016llx] Program binary rejected by driver, compiling shader code", value);
+            glDeleteProgram(id);
+            id = 0;
+        }
+        else TRACELOG(LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully from shader cache", id);
+    }
+
+    UnloadFileData(data);
+    return id;
+}
+
+// Save shader program binary to shader cache
+static void rlSaveShaderProgramCache(unsigned int id, unsigned long long hash)
+{
+    if ((hash == 0) || (RLGL.State.shaderCachePath[0] == '\0') || !RLGL.ExtSupported.programBinary) return;
+
+    GLint binarySize = 0;
+    glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+    if (binarySize <= 0) return;
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(binarySize + 8);
+    GLenum format = 0;
+    GLsizei length = 0;
+    glGetProgramBinary(id, binarySize, &length, &format, data + 8);
+
+    if (length > 0)
+    {
+        unsigned int binaryFormat = (unsigned int)format;
+        memcpy(data, "RLSB", 4);
+        memcpy(data + 4, &binaryFormat, sizeof(unsigned int));
+
+        char fileName[600] = { 0 };
+        snprintf(fileName, sizeof(fileName), "%s/%016llx.rlsb", RLGL.State.shaderCachePath, hash);
+        SaveFileData(fileName, data, length + 8);
+    }
+
+    RL_FREE(data);
+}
+
+// Get texture unit of a render batch texture slot
+// NOTE: Slot 0 uses texture unit 0 (texture0), next slots follow the additional batch texture units
+static int rlGetBatchTextureSlotUnit(int slot)
+{
+    return (slot == 0)? 0 : (RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS + slot);
+}
+
+// Add vertex to command buffer, current transform is applied
+static void rlCommandBufferVertex(rlCommandBuffer *buffer, float x, float y, float z, const float *texcoord, const unsigned char *color)
+{
+    if (buffer->vertexCount >= buffer->vertexCapacity)
+    {
+        buffer->vertexCapacity *= 2;
+        buffer->vertices = (float *)RL_REALLOC(buffer->vertices, buffer->vertexCapacity*3*sizeof(float));
+        buffer->texcoords = (float *)RL_REALLOC(buffer->texcoords, buffer->vertexCapacity*2*sizeof(float));
+        buffer->colors = (unsigned char *)RL_REALLOC(buffer->colors, buffer->vertexCapacity*4*sizeof(unsigned char));
+    }
+
+    // Vertex added before any rlBegin() are recorded as QUADS with default texture
+    if (buffer->drawCount == 0)
+    {
+        rlDrawCall *draw = rlCommandBufferNextDraw(buffer);
+        draw->mode = RL_QUADS;
+        draw->textureId = RLGL.State.defaultTextureId;
+    }
+
+    float *position = &buffer->vertices[3*buffer->vertexCount];
+    if (buffer->transformRequired)
+    {
+        const Matrix *mat = &buffer->transform;
+        position[0] = mat->m0*x + mat->m4*y + mat->m8*z + mat->m12;
+        position[1] = mat->m1*x + mat->m5*y + mat->m9*z + mat->m13;
+        position[2] = mat->m2*x + mat->m6*y + mat->m10*z + mat->m14;
+    }
+    else
+    {
+        position[0] = x;
+        position[1] = y;
+        position[2] = z;
+    }
+
+    buffer->texcoords[2*buffer->vertexCount] = texcoord[0];
+    buffer->texcoords[2*buffer->vertexCount + 1] = texcoord[1];
+    memcpy(&buffer->colors[4*buffer->vertexCount], color, 4);
+
+    buffer->vertexCount++;
+    buffer->draws[buffer->drawCount - 1].vertexCount++;
+}
+
+// Close command buffer draw (if not empty) and setup next one, mode and texture must be set by caller
+// NOTE: Command buffer draws are consecutive vertex ranges, alignment is added on submission by render batch
+static rlDrawCall *rlCommandBufferNextDraw(rlCommandBuffer *buffer)
+{
+    if ((buffer->drawCount == 0) || (buffer->draws[buffer->drawCount - 1].vertexCount > 0))
+    {
+        if (buffer->drawCount >= buffer->drawCapacity)
+        {
+            buffer->drawCapacity *= 2;
+            buffer->draws = (rlDrawCall *)RL_REALLOC(buffer->draws, buffer->drawCapacity*sizeof(rlDrawCall));
+        }
+
+        buffer->drawCount++;
+    }
+
+    rlDrawCall *draw = &buffer->draws[buffer->drawCount - 1];
+    draw->vertexCount = 0;
+    draw->vertexAlignment = 0;
+    draw->textureCount = 0;
+    draw->layer = buffer->layer;
+    draw->layerOrdered = buffer->layerOrdered;
+
+    return draw;
+}
+
+// Write command trace record (type and fixed data)
+static void rlTraceCommand(int type, const void *data, int size)
+{
+    fwrite(&type, sizeof(int), 1, RLGL.Trace.file);
+    if (size > 0) fwrite(data, 1, size, RLGL.Trace.file);
+}
+
+// Write command trace record variable data
+// NOTE: Data is padded to 4 bytes, so next record and replayed vertex/uniform data keep their alignment
+static void rlTraceData(const void *data, int size)
+{
+    static const unsigned char padding[4] = { 0 };
+
+    if (size <= 0) return;
+
+    if (data != NULL) fwrite(data, 1, size, RLGL.Trace.file);
+    else
+    {
+        // Data not available, zeros are written to keep the record size expected by replay
+        TRACELOG(LOG_WARNING, "RLGL: Command trace record data not available, zeros written");
+        for (int i = 0; i < size; i += 4) fwrite(padding, 1, ((size - i) < 4)? (size - i) : 4, RLGL.Trace.file);
+    }
+    if ((size%4) != 0) fwrite(padding, 1, 4 - size%4, RLGL.Trace.file);
+}
+
+// Write texture to command trace if not available yet
+// NOTE: Textures loaded before capture started are read back from GPU (base level, RGBA 32bit)
+static void rlTraceTexture(unsigned int id)
+{
+    if ((id == 0) || (id == RLGL.State.defaultTextureId)) return;
+    for (int i = 0; i < RLGL.Trace.textureCount; i++) if (RLGL.Trace.textureIds[i] == id) return;
+
+    int width = 0;
+    int height = 0;
+    int params[4] = { 0 };
+    unsigned char *pixels = rlReadTextureRGBA(id, &width, &height, params);
+
+    if (pixels == NULL) return;
+
+    rlTraceLoadTexture(id, width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1, pixels, width*height*4);
+    RL_FREE(pixels);
+
+    // Mipmaps are not captured, trilinear filtering falls back to linear
+    if (params[3] == GL_LINEAR_MIPMAP_LINEAR) params[3] = GL_LINEAR;
+    rlTraceCommand(RLGL_TRACE_TEXTURE_PARAMETERS, (int[3]){ (int)id, RL_TEXTURE_WRAP_S, params[0] }, 3*sizeof(int));
+    rlTraceCommand(RLGL_TRACE_TEXTURE_PARAMETERS, (int[3]){ (int)id, RL_TEXTURE_WRAP_T, params[1] }, 3*sizeof(int));
+    rlTraceCommand(RLGL_TRACE_TEXTURE_PARAMETERS, (int[3]){ (int)id, RL_TEXTURE_MAG_FILTER, params[2] }, 3*sizeof(int));
+    rlTraceCommand(RLGL_TRACE_TEXTURE_PARAMETERS, (int[3]){ (int)id, RL_TEXTURE_MIN_FILTER, params[3] }, 3*sizeof(int));
+}
+
+// Write texture load to command trace, texture is available on trace afterwards
+static void rlTraceLoadTexture(unsigned int id, int width, int height, int format, int mipmaps, const void *data, int size)
+{
+    rlTraceCommand(RLGL_TRACE_LOAD_TEXTURE, (int[6]){ (int)id, width, height, format, mipmaps, size }, 6*sizeof(int));
+    rlTraceData(data, size);
+
+    if (RLGL.Trace.textureCount >= RLGL.Trace.textureCapacity)
+    {
+        RLGL.Trace.textureCapacity = (RLGL.Trace.textureCapacity > 0)? 2*RLGL.Trace.textureCapacity : 64;
+        RLGL.Trace.textureIds = (unsigned int *)RL_REALLOC(RLGL.Trace.textureIds, RLGL.Trace.textureCapacity*sizeof(unsigned int));
+    }
+
+    RLGL.Trace.textureIds[RLGL.Trace.textureCount] = id;
+    RLGL.Trace.textureCount++;
+}
+
+// Write texture update to command trace (uncompressed formats only)
+static void rlTraceUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
+{
+    int size = rlGetPixelDataSize(width, height, format);
+
+    rlTraceTexture(id);
+    rlTraceCommand(RLGL_TRACE_UPDATE_TEXTURE, (int[7]){ (int)id, offsetX, offsetY, width, height, format, size }, 7*sizeof(int));
+    rlTraceData(data, size);
+}
+
+// Write shader load to command trace (code strings include null terminator, NULL code is not written)
+static void rlTraceLoadShader(unsigned int id, const char *vsCode, const char *fsCode)
+{
+    int vsSize = (vsCode != NULL)? (int)strlen(vsCode) + 1 : 0;
+    int fsSize = (fsCode != NULL)? (int)strlen(fsCode) + 1 : 0;
+
+    rlTraceCommand(RLGL_TRACE_LOAD_SHADER, (int[3]){ (int)id, vsSize, fsSize }, 3*sizeof(int));
+    rlTraceData(vsCode, vsSize);
+    rlTraceData(fsCode, fsSize);
+}
+
+// Write render state change to command trace
+static void rlTraceState(int state, bool enabled)
+{
+    rlTraceCommand(RLGL_TRACE_STATE, (int[2]){ state, enabled }, 2*sizeof(int));
+}
+
+// Read command trace record data, data pointer is moved to next 4 bytes aligned data
+// NOTE: Data is only skipped if dst is NULL, returns false if trace data is not long enough
+static bool rlTraceRead(const unsigned char **data, const unsigned char *end, void *dst, int size)
+{
+    // NOTE: Size is checked before aligning it, so it can not overflow
+    if ((size < 0) || (size > (end - *data))) return false;
+
+    ptrdiff_t alignedSize = ((ptrdiff_t)size + 3) & ~(ptrdiff_t)3;
+    if (alignedSize > (end - *data)) return false;
+
+    if ((dst != NULL) && (size > 0)) memcpy(dst, *data, size);
+    *data += alignedSize;
+
+    return true;
+}
+
+// Get texture data size expected on command trace, all mipmaps included (-1 if parameters not valid)
+// NOTE: Replayed texture data size must match it before texture is loaded or updated
+static int rlTraceTextureDataSize(int width, int height, int format, int mipmaps)
+{
+    if ((width < 1) || (height < 1) || ((long long)width*height > INT_MAX/16)) return -1;    // 16 bytes: largest pixel size
+    if ((format < RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (format > RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) return -1;
+    if ((mipmaps < 1) || (mipmaps > 32)) return -1;
+
+    long long size = 0;
+    int mipWidth = width;
+    int mipHeight = height;
+
+    for (int i = 0; i < mipmaps; i++)
+    {
+        size += rlGetPixelDataSize(mipWidth, mipHeight, format);
+
+        mipWidth = (mipWidth > 1)? mipWidth/2 : 1;
+        mipHeight = (mipHeight > 1)? mipHeight/2 : 1;
+    }
+
+    return (size <= INT_MAX)? (int)size : -1;
+}
+
+// Get uniform data size expected on command trace (-1 if parameters not valid)
+static int rlTraceUniformDataSize(int uniformType, int count)
+{
+    if ((uniformType < RL_SHADER_UNIFORM_FLOAT) || (uniformType > RL_SHADER_UNIFORM_SAMPLER2D) || (count < 0) || (count > INT_MAX/16)) return -1;
+
+    int components = 1;
+    if ((uniformType == RL_SHADER_UNIFORM_VEC2) || (uniformType == RL_SHADER_UNIFORM_IVEC2)) components = 2;
+    else if ((uniformType == RL_SHADER_UNIFORM_VEC3) || (uniformType == RL_SHADER_UNIFORM_IVEC3)) components = 3;
+    else if ((uniformType == RL_SHADER_UNIFORM_VEC4) || (uniformType == RL_SHADER_UNIFORM_IVEC4)) components = 4;
+
+    return components*4*count;
+}
+
+// Get replay resource by capture id (NULL if not loaded)
+static rlTraceResource *rlTraceGetResource(rlTraceResource *resources, int count, unsigned int traceId)
+{
+    for (int i = 0; i < count; i++) if (resources[i].traceId == traceId) return &resources[i];
+
+    return NULL;
+}
+
+// Read texture base level as RGBA pixels, texture swizzle is applied (pixels as sampled)
+// NOTE: params receives wrap s/t and mag/min filters, returns NULL if texture is empty
+static unsigned char *rlReadTextureRGBA(unsigned int id, int *width, int *height, int *params)
+{
+    int swizzle[4] = { GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA };
+
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, width);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, height);
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, &params[0]);
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, &params[1]);
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, &params[2]);
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, &params[3]);
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+
+    unsigned char *pixels = NULL;
+    if ((*width > 0) && (*height > 0))
+    {
+        pixels = (unsigned char *)RL_MALLOC((*width)*(*height)*4);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+        // Texture swizzle is not applied on read back (i.e. grayscale formats), pixels are swizzled as sampled
+        for (int i = 0; i < (*width)*(*height); i++)
+        {
+            unsigned char texel[4] = { pixels[4*i], pixels[4*i + 1], pixels[4*i + 2], pixels[4*i + 3] };
+            for (int c = 0; c < 4; c++)
+            {
+                if ((swizzle[c] >= GL_RED) && (swizzle[c] <= GL_ALPHA)) pixels[4*i + c] = texel[swizzle[c] - GL_RED];
+                else pixels[4*i + c] = (swizzle[c] == GL_ONE)? 255 : 0;
+            }
+        }
+    }
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
+
+    return pixels;
+}
+
+// Rasterize render batch draws into software buffers
+// NOTE: Draws follow the same order as OpenGL path, shading is the default shader one (current shader is not used)
+static void rlSoftwareRenderBatch(rlRenderBatch *batch)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    int vertexCount = RLGL.State.vertexCounter;
+
+    if (vertexCount > RLGL.Software.vertexCapacity)
+    {
+        RLGL.Software.vertexCapacity = vertexCount;
+        RLGL.Software.vertices = (rlSoftwareVertex *)RL_REALLOC(RLGL.Software.vertices, vertexCount*sizeof(rlSoftwareVertex));
+    }
+
+    // Transform batch vertex to clip space, as default vertex shader does
+    Matrix mvp = MatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+
+    for (int i = 0; i < vertexCount; i++)
+    {
+        const float *position = NULL;
+        const float *texcoord = NULL;
+        const unsigned char *color = NULL;
+
+        if (buffer->vertexData != NULL)
+        {
+            position = &buffer->vertexData[i].x;
+            texcoord = &buffer->vertexData[i].u;
+            color = &buffer->vertexData[i].r;
+        }
+        else
+        {
+            position = &buffer->vertices[3*i];
+            texcoord = &buffer->texcoords[2*i];
+            color = &buffer->colors[4*i];
+        }
+
+        rlSoftwareVertex *vertex = &RLGL.Software.vertices[i];
+        vertex->x = mvp.m0*position[0] + mvp.m4*position[1] + mvp.m8*position[2] + mvp.m12;
+        vertex->y = mvp.m1*position[0] + mvp.m5*position[1] + mvp.m9*position[2] + mvp.m13;
+        vertex->z = mvp.m2*position[0] + mvp.m6*position[1] + mvp.m10*position[2] + mvp.m14;
+        vertex->w = mvp.m3*position[0] + mvp.m7*position[1] + mvp.m11*position[2] + mvp.m15;
+        vertex->u = texcoord[0];
+        vertex->v = texcoord[1];
+        for (int c = 0; c < 4; c++) vertex->color[c] = (float)color[c];
+    }
+
+    // Render state used by every triangle of the batch
+    int *clipRect = RLGL.Software.clipRect;
+    clipRect[0] = 0;
+    clipRect[1] = 0;
+    clipRect[2] = RLGL.Software.width - 1;
+    clipRect[3] = RLGL.Software.height - 1;
+    rlSoftwareClipRect(clipRect, RLGL.Software.viewport);
+    if (RLGL.Cache.scissorTest == 1) rlSoftwareClipRect(clipRect, RLGL.Software.scissor);
+
+    RLGL.Software.depthTest = (RLGL.Cache.depthTest == 1);
+    RLGL.Software.depthMask = (RLGL.Cache.depthMask != 0);
+    RLGL.Software.blend = (RLGL.Cache.blend == 1);
+    RLGL.Software.blendSrcFactor = (int)RLGL.Cache.blendSrcFactor;
+    RLGL.Software.blendDstFactor = (int)RLGL.Cache.blendDstFactor;
+    RLGL.Software.blendEquation = (int)RLGL.Cache.blendEquation;
+    bool cull = (RLGL.Cache.cullFace == 1);
+
+    // Setup draws triangles, draws order matches OpenGL path
+    const rlDrawCall *drawOrder[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int drawOffsets[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+
+    for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+    {
+        drawOrder[i] = &batch->draws[i];
+        drawOffsets[i] = vertexOffset;
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+    }
+
+    if (RLGL.State.drawSorting && (batch->drawCounter > 1)) qsort((void *)drawOrder, batch->drawCounter, sizeof(rlDrawCall *), rlCompareDrawCalls);
+
+    RLGL.Software.triangleCount = 0;
+
+    for (int i = 0; i < batch->drawCounter; i++)
+    {
+        const rlDrawCall *draw = drawOrder[i];
+        if (draw->vertexCount == 0) continue;
+
+        const rlSoftwareVertex *vertices = &RLGL.Software.vertices[drawOffsets[draw - batch->draws]];
+        int texture = rlSoftwareGetTexture(draw->textureId);
+
+        if (draw->mode == RL_LINES)
+        {
+            for (int k = 0; k + 1 < draw->vertexCount; k += 2) rlSoftwareClipLine(&vertices[k], &vertices[k + 1], texture);
+        }
+        else if (draw->mode == RL_TRIANGLES)
+        {
+            for (int k = 0; k + 2 < draw->vertexCount; k += 3) rlSoftwareClipTriangle(&vertices[k], &vertices[k + 1], &vertices[k + 2], texture, cull);
+        }
+        else
+        {
+            // Quads are split as batch index buffer does: (0, 1, 2), (0, 2, 3)
+            for (int k = 0; k + 3 < draw->vertexCount; k += 4)
+            {
+                rlSoftwareClipTriangle(&vertices[k], &vertices[k + 1], &vertices[k + 2], texture, cull);
+                rlSoftwareClipTriangle(&vertices[k], &vertices[k + 2], &vertices[k + 3], texture, cull);
+            }
+        }
+    }
+
+    rlSoftwareRasterize();
+}
+
+// Get software texture index, texture pixels are read back from GPU on first use
+// NOTE: Default texture (white) is not read back, shading skips sampling (-1)
+static int rlSoftwareGetTexture(unsigned int id)
+{
+    if ((id == 0) || (id == RLGL.State.defaultTextureId)) return -1;
+
+    for (int i = 0; i < RLGL.Software.textureCount; i++) if (RLGL.Software.textures[i].id == id) return i;
+
+    int width = 0;
+    int height = 0;
+    int params[4] = { 0 };
+    unsigned char *pixels = rlReadTextureRGBA(id, &width, &height, params);
+
+    if (pixels == NULL) return -1;
+
+    if (RLGL.Software.textureCount >= RLGL.Software.textureCapacity)
+    {
+        RLGL.Software.textureCapacity = (RLGL.Software.textureCapacity > 0)? 2*RLGL.Software.textureCapacity : 16;
+        RLGL.Software.textures = (rlSoftwareTexture *)RL_REALLOC(RLGL.Software.textures, RLGL.Software.textureCapacity*sizeof(rlSoftwareTexture));
+    }
+
+    rlSoftwareTexture *texture = &RLGL.Software.textures[RLGL.Software.textureCount];
+    texture->id = id;
+    texture->width = width;
+    texture->height = height;
+    texture->pixels = pixels;
+    texture->wrapS = params[0];
+    texture->wrapT = params[1];
+    texture->linear = (params[2] == GL_LINEAR);
+
+    return RLGL.Software.textureCount++;
 }
 
-// Set vertex attribute
-void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, void *pointer)
+// Release software texture copy, it is read back again on next use
+static void rlSoftwareReleaseTexture(unsigned int id)
 {
-    glVertexAttribPointer(index, compSize, type, normalized, stride, pointer);
+    for (int i = 0; i < RLGL.Software.textureCount; i++)
+    {
+        if (RLGL.Software.textures[i].id == id)
+        {
+            RL_FREE(RLGL.Software.textures[i].pixels);
+            RLGL.Software.textures[i] = RLGL.Software.textures[RLGL.Software.textureCount - 1];
+            RLGL.Software.textureCount--;
+            break;
+        }
+    }
 }
 
-// Set vertex attribute divisor
-void rlSetVertexAttributeDivisor(unsigned int index, int divisor)
+// Intersect pixels rect (min x, min y, max x, max y, inclusive) with area (x, y, width, height)
+static void rlSoftwareClipRect(int *rect, const int *area)
 {
-    glVertexAttribDivisor(index, divisor);
+    if (area[0] > rect[0]) rect[0] = area[0];
+    if (area[1] > rect[1]) rect[1] = area[1];
+    if (area[0] + area[2] - 1 < rect[2]) rect[2] = area[0] + area[2] - 1;
+    if (area[1] + area[3] - 1 < rect[3]) rect[3] = area[1] + area[3] - 1;
 }
 
-// Unload vertex array object (VAO)
-void rlUnloadVertexArray(unsigned int vaoId)
+// Clip triangle against near and far planes, result polygon is setup as triangles fan
+// NOTE: Triangles are not clipped on x and y, rasterization is limited to clip rect
+static void rlSoftwareClipTriangle(const rlSoftwareVertex *v0, const rlSoftwareVertex *v1, const rlSoftwareVertex *v2, int texture, bool cull)
 {
-    if (RLGL.ExtSupported.vao)
+    rlSoftwareVertex polygon[2][5] = { 0 };     // Every clip plane adds one vertex at most
+    int count = 3;
+    int current = 0;
+
+    polygon[0][0] = *v0;
+    polygon[0][1] = *v1;
+    polygon[0][2] = *v2;
+
+    for (int plane = 0; plane < 2; plane++)
     {
-        glBindVertexArray(0);
-        glDeleteVertexArrays(1, &vaoId);
-        TRACELOG(LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
+        // Near plane: z >= -w, far plane: z <= w
+        float sign = (plane == 0)? 1.0f : -1.0f;
+        const rlSoftwareVertex *input = polygon[current];
+        rlSoftwareVertex *output = polygon[1 - current];
+        int outputCount = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            const rlSoftwareVertex *a = &input[i];
+            const rlSoftwareVertex *b = &input[(i + 1)%count];
+            float da = a->w + sign*a->z;
+            float db = b->w + sign*b->z;
+
+            if (da >= 0.0f) output[outputCount++] = *a;
+            if ((da >= 0.0f) != (db >= 0.0f))
+            {
+                float t = da/(da - db);
+                rlSoftwareVertex *vertex = &output[outputCount++];
+                vertex->x = a->x + (b->x - a->x)*t;
+                vertex->y = a->y + (b->y - a->y)*t;
+                vertex->z = a->z + (b->z - a->z)*t;
+                vertex->w = a->w + (b->w - a->w)*t;
+                vertex->u = a->u + (b->u - a->u)*t;
+                vertex->v = a->v + (b->v - a->v)*t;
+                for (int c = 0; c < 4; c++) vertex->color[c] = a->color[c] + (b->color[c] - a->color[c])*t;
+            }
+        }
+
+        count = outputCount;
+        current = 1 - current;
+        if (count < 3) return;
     }
+
+    // Transform to window coordinates, w is replaced by 1/w
+    for (int i = 0; i < count; i++)
+    {
+        rlSoftwareVertex *vertex = &polygon[current][i];
+        if (vertex->w <= 0.0f) return;
+
+        float invW = 1.0f/vertex->w;
+        vertex->x = RLGL.Software.viewport[0] + (vertex->x*invW + 1.0f)*0.5f*RLGL.Software.viewport[2];
+        vertex->y = RLGL.Software.viewport[1] + (vertex->y*invW + 1.0f)*0.5f*RLGL.Software.viewport[3];
+        vertex->z = (vertex->z*invW + 1.0f)*0.5f;
+        vertex->w = invW;
+    }
+
+    for (int i = 1; i + 1 < count; i++) rlSoftwareSetupTriangle(&polygon[current][0], &polygon[current][i], &polygon[current][i + 1], texture, cull);
 }
 
-// Unload vertex buffer (VBO)
-void rlUnloadVertexBuffer(unsigned int vboId)
+// Clip line against near and far planes, line is setup as two triangles (never culled)
+// NOTE: Line is widened on its minor axis (as OpenGL aliased lines), covering one pixel per major axis step with 1.0f width
+static void rlSoftwareClipLine(const rlSoftwareVertex *v0, const rlSoftwareVertex *v1, int texture)
 {
-    glDeleteBuffers(1, &vboId);
-    TRACELOG(LOG_INFO, "VBO: Unloaded vertex data from VRAM (GPU)");
+    rlSoftwareVertex line[2] = { *v0, *v1 };
+
+    for (int plane = 0; plane < 2; plane++)
+    {
+        float sign = (plane == 0)? 1.0f : -1.0f;
+        float d0 = line[0].w + sign*line[0].z;
+        float d1 = line[1].w + sign*line[1].z;
+
+        if ((d0 < 0.0f) && (d1 < 0.0f)) return;
+        if ((d0 < 0.0f) || (d1 < 0.0f))
+        {
+            // Outside vertex is moved to the plane
+            rlSoftwareVertex a = line[0];
+            rlSoftwareVertex b = line[1];
+            rlSoftwareVertex *vertex = &line[(d0 < 0.0f)? 0 : 1];
+            float t = d0/(d0 - d1);
+            vertex->x = a.x + (b.x - a.x)*t;
+            vertex->y = a.y + (b.y - a.y)*t;
+            vertex->z = a.z + (b.z - a.z)*t;
+            vertex->w = a.w + (b.w - a.w)*t;
+            vertex->u = a.u + (b.u - a.u)*t;
+            vertex->v = a.v + (b.v - a.v)*t;
+            for (int c = 0; c < 4; c++) vertex->color[c] = a.color[c] + (b.color[c] - a.color[c])*t;
+        }
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (line[i].w <= 0.0f) return;
+
+        float invW = 1.0f/line[i].w;
+        line[i].x = RLGL.Software.viewport[0] + (line[i].x*invW + 1.0f)*0.5f*RLGL.Software.viewport[2];
+        line[i].y = RLGL.Software.viewport[1] + (line[i].y*invW + 1.0f)*0.5f*RLGL.Software.viewport[3];
+        line[i].z = (line[i].z*invW + 1.0f)*0.5f;
+        line[i].w = invW;
+    }
+
+    float halfWidth = ((RLGL.Software.lineWidth > 0.0f)? RLGL.Software.lineWidth : 1.0f)*0.5f;
+    bool majorX = (fabsf(line[1].x - line[0].x) >= fabsf(line[1].y - line[0].y));
+    float offsetX = majorX? 0.0f : halfWidth;
+    float offsetY = majorX? halfWidth : 0.0f;
+
+    rlSoftwareVertex quad[4] = { line[0], line[1], line[1], line[0] };
+    quad[0].x -= offsetX; quad[0].y -= offsetY;
+    quad[1].x -= offsetX; quad[1].y -= offsetY;
+    quad[2].x += offsetX; quad[2].y += offsetY;
+    quad[3].x += offsetX; quad[3].y += offsetY;
+
+    rlSoftwareSetupTriangle(&quad[0], &quad[1], &quad[2], texture, false);
+    rlSoftwareSetupTriangle(&quad[0], &quad[2], &quad[3], texture, false);
 }
 
-// Shaders management
-//-----------------------------------------------------------------------------------------------
-// Load shader from code strings
-// NOTE: If shader string is NULL, using default vertex/fragment shaders
-unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
+// Setup triangle for rasterization, vertex are in window coordinates (w = 1/w)
+// NOTE: Front faces are counter-clockwise on window coordinates (y up), as OpenGL default
+static void rlSoftwareSetupTriangle(const rlSoftwareVertex *v0, const rlSoftwareVertex *v1, const rlSoftwareVertex *v2, int texture, bool cull)
 {
-    unsigned int id = 0;
-    unsigned int vertexShaderId = RLGL.State.defaultVShaderId;
-    unsigned int fragmentShaderId = RLGL.State.defaultFShaderId;
+    const rlSoftwareVertex *vertex[3] = { v0, v1, v2 };
+    float area = (v1->x - v0->x)*(v2->y - v0->y) - (v2->x - v0->x)*(v1->y - v0->y);
 
-    if (vsCode != NULL) vertexShaderId = rlCompileShader(vsCode, GL_VERTEX_SHADER);
-    if (fsCode != NULL) fragmentShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
+    // Degenerated (or not valid) triangles and culled back faces are discarded
+    if (!(area > 0.0f) && !(area < 0.0f)) return;
+    if (cull && (area < 0.0f)) return;
 
-    if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) {
-        id = RLGL.State.defaultShaderId;
-    } else {
-        id = rlLoadShaderProgram(vertexShaderId, fragmentShaderId);
-        if (vertexShaderId != RLGL.State.defaultVShaderId) {
-            // Detach shader before deletion to make sure memory is freed
-            glDetachShader(id, vertexShaderId);
-            glDeleteShader(vertexShaderId);
-        }
-        if (fragmentShaderId != RLGL.State.defaultFShaderId) {
-            // Detach shader before deletion to make sure memory is freed
-            glDetachShader(id, fragmentShaderId);
-            glDeleteShader(fragmentShaderId);
-        }
-        if (id == 0) {
-            TRACELOG(LOG_WARNING, "SHADER: Failed to load custom shader code");
-            id = RLGL.State.defaultShaderId;
-        }
+    // Pixels bounding box, conservative (coverage is checked by edge functions), clipped to rasterized area
+    const int *clipRect = RLGL.Software.clipRect;
+    float minX = floorf(fminf(v0->x, fminf(v1->x, v2->x)));
+    float minY = floorf(fminf(v0->y, fminf(v1->y, v2->y)));
+    float maxX = floorf(fmaxf(v0->x, fmaxf(v1->x, v2->x)));
+    float maxY = floorf(fmaxf(v0->y, fmaxf(v1->y, v2->y)));
+
+    if ((maxX < (float)clipRect[0]) || (maxY < (float)clipRect[1]) || (minX > (float)clipRect[2]) || (minY > (float)clipRect[3])) return;
+
+    if (RLGL.Software.triangleCount >= RLGL.Software.triangleCapacity)
+    {
+        RLGL.Software.triangleCapacity = (RLGL.Software.triangleCapacity > 0)? 2*RLGL.Software.triangleCapacity : 1024;
+        RLGL.Software.triangles = (rlSoftwareTriangle *)RL_REALLOC(RLGL.Software.triangles, RLGL.Software.triangleCapacity*sizeof(rlSoftwareTriangle));
     }
 
-    // Get available shader uniforms
-    // NOTE: This information is useful for debug...
-    int uniformCount = -1;
-    glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformCount);
-    for (int i = 0; i < uniformCount; i++) {
-        int namelen = -1;
-        int num = -1;
-        char name[256] = { 0 };     // Assume no variable names longer than 256
-        GLenum type = GL_ZERO;
-        // Get the name of the uniforms
-        glGetActiveUniform(id, i, sizeof(name) - 1, &namelen, &num, &type, name);
-        name[namelen] = 0;
-        TRACELOG(LOG_DEBUG, "SHADER: [ID %i] Active uniform (%s) set at location: %i", id, name, glGetUniformLocation(id, name));
+    rlSoftwareTriangle *triangle = &RLGL.Software.triangles[RLGL.Software.triangleCount++];
+    triangle->minX = (minX > (float)clipRect[0])? (int)minX : clipRect[0];
+    triangle->minY = (minY > (float)clipRect[1])? (int)minY : clipRect[1];
+    triangle->maxX = (maxX < (float)clipRect[2])? (int)maxX : clipRect[2];
+    triangle->maxY = (maxY < (float)clipRect[3])? (int)maxY : clipRect[3];
+
+    // Edge functions are oriented to be positive inside the triangle for both windings
+    float sign = (area > 0.0f)? 1.0f : -1.0f;
+
+    for (int i = 0; i < 3; i++)
+    {
+        const rlSoftwareVertex *a = vertex[(i + 1)%3];
+        const rlSoftwareVertex *b = vertex[(i + 2)%3];
+
+        triangle->edgeA[i] = sign*(a->y - b->y);
+        triangle->edgeB[i] = sign*(b->x - a->x);
+        triangle->edgeC[i] = -(triangle->edgeA[i]*a->x + triangle->edgeB[i]*a->y);
+        triangle->topLeft[i] = (triangle->edgeA[i] > 0.0f) || ((triangle->edgeA[i] == 0.0f) && (triangle->edgeB[i] < 0.0f));
+
+        triangle->z[i] = vertex[i]->z;
+        triangle->invW[i] = vertex[i]->w;
+        triangle->u[i] = vertex[i]->u;
+        triangle->v[i] = vertex[i]->v;
+        for (int c = 0; c < 4; c++) triangle->color[i][c] = vertex[i]->color[c];
     }
-    return id;
+
+    triangle->invArea = 1.0f/(sign*area);
+    triangle->texture = texture;
 }
 
-// Compile custom shader and return shader id
-unsigned int rlCompileShader(const char *shaderCode, int type)
+// Bin setup triangles into screen tiles and rasterize tiles on rasterizer threads
+// NOTE: Every tile is rasterized by a single thread and keeps triangles submission order,
+// result does not depend on threads count or scheduling
+static void rlSoftwareRasterize(void)
 {
-    unsigned int shader = 0;
-    shader = glCreateShader(type);
-    glShaderSource(shader, 1, &shaderCode, NULL);
-    GLint success = 0;
-    glCompileShader(shader);
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
-    if (success == GL_FALSE) {
-        switch (type) {
-            case GL_VERTEX_SHADER: TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to compile vertex shader code", shader); break;
-            case GL_FRAGMENT_SHADER: TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to compile fragment shader code", shader); break;
-            //case GL_GEOMETRY_SHADER:
-            default: break;
-        }
-        int maxLength = 0;
-        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
-        if (maxLength > 0)
+    int tilesX = RLGL.Software.tilesX;
+    int tileCount = RLGL.Software.tilesX*RLGL.Software.tilesY;
+    int *binOffsets = RLGL.Software.binOffsets;
+
+    // Count triangles on every tile and get bins offsets
+    memset(binOffsets, 0, (tileCount + 1)*sizeof(int));
+
+    for (int i = 0; i < RLGL.Software.triangleCount; i++)
+    {
+        const rlSoftwareTriangle *triangle = &RLGL.Software.triangles[i];
+
+        for (int ty = triangle->minY/RLGL_SOFTWARE_TILE_SIZE; ty <= triangle->maxY/RLGL_SOFTWARE_TILE_SIZE; ty++)
         {
-            int length = 0;
-            char *log = RL_CALLOC(maxLength, sizeof(char));
-            glGetShaderInfoLog(shader, maxLength, &length, log);
-            TRACELOG(LOG_WARNING, "SHADER: [ID %i] Compile error: %s", shader, log);
-            RL_FREE(log);
-        }
-    } else {
-        switch (type) {
-            case GL_VERTEX_SHADER: TRACELOG(LOG_INFO, "SHADER: [ID %i] Vertex shader compiled successfully", shader); break;
-            case GL_FRAGMENT_SHADER: TRACELOG(LOG_INFO, "SHADER: [ID %i] Fragment shader compiled successfully", shader); break;
-            default: break;
+            for (int tx = triangle->minX/RLGL_SOFTWARE_TILE_SIZE; tx <= triangle->maxX/RLGL_SOFTWARE_TILE_SIZE; tx++) binOffsets[ty*tilesX + tx + 1]++;
         }
     }
-    return shader;
-}
 
-// Load custom shader strings and return program id
-unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
-{
-    unsigned int program = 0;
-    GLint success = 0;
-    program = glCreateProgram();
-    glAttachShader(program, vShaderId);
-    glAttachShader(program, fShaderId);
-    // NOTE: Default attribute shader locations must be binded before linking
-    glBindAttribLocation(program, 0, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-    glBindAttribLocation(program, 1, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-    glBindAttribLocation(program, 2, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
-    glBindAttribLocation(program, 3, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
-    glBindAttribLocation(program, 4, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
-    glBindAttribLocation(program, 5, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
-    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
-    glLinkProgram(program);
-    // NOTE: All uniform variables are intitialised to 0 when a program links
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
-    if (success == GL_FALSE) {
-        TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", program);
-        int maxLength = 0;
-        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
-        if (maxLength > 0) {
-            int length = 0;
-            char *log = RL_CALLOC(maxLength, sizeof(char));
-            glGetProgramInfoLog(program, maxLength, &length, log);
-            TRACELOG(LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
-            RL_FREE(log);
+    for (int i = 0; i < tileCount; i++) binOffsets[i + 1] += binOffsets[i];
+
+    int binCount = binOffsets[tileCount];
+    if (binCount == 0) return;
+
+    if (binCount > RLGL.Software.binCapacity)
+    {
+        RLGL.Software.binCapacity = binCount;
+        RLGL.Software.binTriangles = (int *)RL_REALLOC(RLGL.Software.binTriangles, binCount*sizeof(int));
+    }
+
+    // Fill bins in submission order
+    memcpy(RLGL.Software.binCursors, binOffsets, tileCount*sizeof(int));
+
+    for (int i = 0; i < RLGL.Software.triangleCount; i++)
+    {
+        const rlSoftwareTriangle *triangle = &RLGL.Software.triangles[i];
+
+        for (int ty = triangle->minY/RLGL_SOFTWARE_TILE_SIZE; ty <= triangle->maxY/RLGL_SOFTWARE_TILE_SIZE; ty++)
+        {
+            for (int tx = triangle->minX/RLGL_SOFTWARE_TILE_SIZE; tx <= triangle->maxX/RLGL_SOFTWARE_TILE_SIZE; tx++)
+            {
+                RLGL.Software.binTriangles[RLGL.Software.binCursors[ty*tilesX + tx]++] = i;
+            }
         }
-        glDeleteProgram(program);
-        program = 0;
-    } else {
-        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
-        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
-        //GLint binarySize = 0;
-        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
-        TRACELOG(LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", program);
     }
-    return program;
-}
 
-// Unload shader program
-void rlUnloadShaderProgram(unsigned int id)
-{
-    glDeleteProgram(id);
-    TRACELOG(LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
-}
+    // Rasterize tiles, rendering thread rasterizes tiles too
+    // NOTE: Parked workers are woken only with enough binned triangles to pay the wake up
+    int workerCount = (binCount >= RLGL_SOFTWARE_MIN_PARALLEL)? RLGL.Software.workerCount : 0;
+    if (workerCount > tileCount - 1) workerCount = tileCount - 1;
 
-// Get shader location uniform
-int rlGetLocationUniform(unsigned int shaderId, const char *uniformName)
-{
-    int location = -1;
-    location = glGetUniformLocation(shaderId, uniformName);
-    if (location == -1) TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to find shader uniform: %s", shaderId, uniformName);
-    else TRACELOG(LOG_INFO, "SHADER: [ID %i] Shader uniform (%s) set at location: %i", shaderId, uniformName, location);
-    return location;
-}
+    RLGL.Software.nextTile = 0;
 
-// Get shader location attribute
-int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
-{
-    int location = -1;
-    location = glGetAttribLocation(shaderId, attribName);
-    if (location == -1) TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to find shader attribute: %s", shaderId, attribName);
-    else TRACELOG(LOG_INFO, "SHADER: [ID %i] Shader attribute (%s) set at location: %i", shaderId, attribName, location);
-    return location;
-}
+#if defined(_WIN32)
+    if (workerCount > 0) ReleaseSemaphore(RLGL.Software.workStart, workerCount, NULL);
 
-// Set shader value uniform
-void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
-{
-    switch (uniformType)
+    rlSoftwareRasterizeTiles();
+
+    for (int i = 0; i < workerCount; i++) WaitForSingleObject(RLGL.Software.workDone, 0xFFFFFFFF);
+#else
+    if (workerCount > 0)
     {
-        case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_VEC2: glUniform2fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_VEC3: glUniform3fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_VEC4: glUniform4fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_INT: glUniform1iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_IVEC2: glUniform2iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_IVEC3: glUniform3iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_IVEC4: glUniform4iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_SAMPLER2D: glUniform1iv(locIndex, count, (int *)value); break;
-        default: TRACELOG(LOG_WARNING, "SHADER: Failed to set uniform value, data type not recognized");
+        pthread_mutex_lock(&RLGL.Software.workMutex);
+        RLGL.Software.workPending = workerCount;
+        RLGL.Software.workDoneCount = 0;
+        pthread_cond_broadcast(&RLGL.Software.workStartCond);
+        pthread_mutex_unlock(&RLGL.Software.workMutex);
     }
-}
 
-// Set shader value attribute
-void rlSetVertexAttributeDefault(int locIndex, const void *value, int attribType, int count)
-{
-    switch (attribType)
+    rlSoftwareRasterizeTiles();
+
+    if (workerCount > 0)
     {
-        case RL_SHADER_ATTRIB_FLOAT: if (count == 1) glVertexAttrib1fv(locIndex, (float *)value); break;
-        case RL_SHADER_ATTRIB_VEC2: if (count == 2) glVertexAttrib2fv(locIndex, (float *)value); break;
-        case RL_SHADER_ATTRIB_VEC3: if (count == 3) glVertexAttrib3fv(locIndex, (float *)value); break;
-        case RL_SHADER_ATTRIB_VEC4: if (count == 4) glVertexAttrib4fv(locIndex, (float *)value); break;
-        default: TRACELOG(LOG_WARNING, "SHADER: Failed to set attrib default value, data type not recognized");
+        pthread_mutex_lock(&RLGL.Software.workMutex);
+        while (RLGL.Software.workDoneCount < workerCount) pthread_cond_wait(&RLGL.Software.workDoneCond, &RLGL.Software.workMutex);
+        pthread_mutex_unlock(&RLGL.Software.workMutex);
     }
+#endif
+
+    RLGL.Software.triangleCount = 0;
 }
 
-// Set shader value uniform matrix
-void rlSetUniformMatrix(int locIndex, Matrix mat)
+// Rasterize tiles until no tile left, tiles are taken from a shared counter
+static void rlSoftwareRasterizeTiles(void)
 {
-    float matfloat[16] = {
-        mat.m0, mat.m1, mat.m2, mat.m3,
-        mat.m4, mat.m5, mat.m6, mat.m7,
-        mat.m8, mat.m9, mat.m10, mat.m11,
-        mat.m12, mat.m13, mat.m14, mat.m15
-    };
-    glUniformMatrix4fv(locIndex, 1, false, matfloat);
+    int tileCount = RLGL.Software.tilesX*RLGL.Software.tilesY;
+
+    for (int tile = RLGL_ATOMIC_FETCH_ADD(&RLGL.Software.nextTile, 1); tile < tileCount; tile = RLGL_ATOMIC_FETCH_ADD(&RLGL.Software.nextTile, 1))
+    {
+        int tileMinX = (tile%RLGL.Software.tilesX)*RLGL_SOFTWARE_TILE_SIZE;
+        int tileMinY = (tile/RLGL.Software.tilesX)*RLGL_SOFTWARE_TILE_SIZE;
+
+        for (int i = RLGL.Software.binOffsets[tile]; i < RLGL.Software.binOffsets[tile + 1]; i++)
+        {
+            const rlSoftwareTriangle *triangle = &RLGL.Software.triangles[RLGL.Software.binTriangles[i]];
+
+            int minX = (triangle->minX > tileMinX)? triangle->minX : tileMinX;
+            int minY = (triangle->minY > tileMinY)? triangle->minY : tileMinY;
+            int maxX = (triangle->maxX < tileMinX + RLGL_SOFTWARE_TILE_SIZE - 1)? triangle->maxX : tileMinX + RLGL_SOFTWARE_TILE_SIZE - 1;
+            int maxY = (triangle->maxY < tileMinY + RLGL_SOFTWARE_TILE_SIZE - 1)? triangle->maxY : tileMinY + RLGL_SOFTWARE_TILE_SIZE - 1;
+
+            float edges[3][4] = { 0 };
+
+            for (int y = minY; y <= maxY; y++)
+            {
+                // Pixel centers are sampled, edge functions y and constant terms are shared by the row
+                float centerY = (float)y + 0.5f;
+                float rowEdges[3] = {
+                    triangle->edgeB[0]*centerY + triangle->edgeC[0],
+                    triangle->edgeB[1]*centerY + triangle->edgeC[1],
+                    triangle->edgeB[2]*centerY + triangle->edgeC[2]
+                };
+
+                // Row span limited by every edge crossing (one pixel conservative), thin triangles skip most of bounding box
+                float spanMin = (float)minX;
+                float spanMax = (float)maxX;
+
+                for (int i = 0; i < 3; i++)
+                {
+                    float crossing = -rowEdges[i]/triangle->edgeA[i] - 0.5f;
+                    if (triangle->edgeA[i] > 0.0f) spanMin = fmaxf(spanMin, floorf(crossing) - 1.0f);
+                    else if (triangle->edgeA[i] < 0.0f) spanMax = fminf(spanMax, ceilf(crossing) + 1.0f);
+                    else if (rowEdges[i] < 0.0f) spanMax = -1.0f;
+                }
+
+                if (!(spanMin <= spanMax)) continue;
+                int rowMaxX = (int)spanMax;
+
+                for (int x = (int)spanMin; x <= rowMaxX; x += 4)
+                {
+                    int mask = rlSoftwareCoverage(triangle, rowEdges, x, edges);
+                    if (rowMaxX - x < 3) mask &= (1 << (rowMaxX - x + 1)) - 1;
+
+                    for (int k = 0; mask != 0; k++, mask >>= 1)
+                    {
+                        if (mask & 1) rlSoftwareShadePixel(triangle, x + k, y, edges[0][k], edges[1][k], edges[2][k]);
+                    }
+                }
+            }
+        }
+    }
 }
 
-// Set shader value uniform sampler
-void rlSetUniformSampler(int locIndex, unsigned int textureId)
+// Get coverage mask of pixels x..x + 3 on a row (bit k set if pixel x + k is covered), edge functions values are returned
+// NOTE: Pixel centers exactly on an edge are covered only by top and left edges, shared edges are not drawn twice
+static int rlSoftwareCoverage(const rlSoftwareTriangle *triangle, const float *rowEdges, int x, float edges[3][4])
 {
-    // Check if texture is already active
-    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) if (RLGL.State.activeTextureId[i] == textureId) return;
+    int mask = 0;
 
-    // Register a new active texture for the internal batch system
-    // NOTE: Default texture is always activated as GL_TEXTURE0
-    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
+#if defined(RLGL_SIMD_SSE2)
+    __m128 centerX = _mm_add_ps(_mm_set1_ps((float)x + 0.5f), _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f));
+    __m128 zero = _mm_setzero_ps();
+    __m128 inside = _mm_cmpeq_ps(zero, zero);
+
+    for (int i = 0; i < 3; i++)
     {
-        if (RLGL.State.activeTextureId[i] == 0)
+        __m128 edge = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(triangle->edgeA[i]), centerX), _mm_set1_ps(rowEdges[i]));
+        _mm_storeu_ps(edges[i], edge);
+        inside = _mm_and_ps(inside, triangle->topLeft[i]? _mm_cmpge_ps(edge, zero) : _mm_cmpgt_ps(edge, zero));
+    }
+
+    mask = _mm_movemask_ps(inside);
+#elif defined(RLGL_SIMD_NEON)
+    const float offsets[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+    float32x4_t centerX = vaddq_f32(vdupq_n_f32((float)x + 0.5f), vld1q_f32(offsets));
+    float32x4_t zero = vdupq_n_f32(0.0f);
+    uint32x4_t inside = vdupq_n_u32(0xFFFFFFFF);
+
+    for (int i = 0; i < 3; i++)
+    {
+        float32x4_t edge = vaddq_f32(vmulq_f32(vdupq_n_f32(triangle->edgeA[i]), centerX), vdupq_n_f32(rowEdges[i]));
+        vst1q_f32(edges[i], edge);
+        inside = vandq_u32(inside, triangle->topLeft[i]? vcgeq_f32(edge, zero) : vcgtq_f32(edge, zero));
+    }
+
+    mask = (vgetq_lane_u32(inside, 0) & 1) | (vgetq_lane_u32(inside, 1) & 2) | (vgetq_lane_u32(inside, 2) & 4) | (vgetq_lane_u32(inside, 3) & 8);
+#else
+    for (int k = 0; k < 4; k++)
+    {
+        float centerX = (float)x + 0.5f + (float)k;
+        bool inside = true;
+
+        for (int i = 0; i < 3; i++)
         {
-            glUniform1i(locIndex, 1 + i);              // Activate new texture unit
-            RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
-            break;
+            edges[i][k] = triangle->edgeA[i]*centerX + rowEdges[i];
+            inside = inside && (triangle->topLeft[i]? (edges[i][k] >= 0.0f) : (edges[i][k] > 0.0f));
         }
+
+        if (inside) mask |= (1 << k);
     }
+#endif
+
+    return mask;
 }
 
-// Set shader currently active (id and locations)
-void rlSetShader(unsigned int id, int *locs)
+// Shade covered pixel: depth test, perspective correct interpolation, texture sampling and blending
+// NOTE: Fragment color is vertex color*texture color, as default shader with white colDiffuse
+static void rlSoftwareShadePixel(const rlSoftwareTriangle *triangle, int x, int y, float e0, float e1, float e2)
 {
-    if (RLGL.State.currentShaderId != id) {
-        rlDrawRenderBatch(RLGL.currentBatch);
-        RLGL.State.currentShaderId = id;
-        RLGL.State.currentShaderLocs = locs;
+    int index = y*RLGL.Software.width + x;
+    float l0 = e0*triangle->invArea;
+    float l1 = e1*triangle->invArea;
+    float l2 = e2*triangle->invArea;
+
+    // Depth is interpolated linearly on window coordinates, depth buffer is only used with depth test enabled
+    if (RLGL.Software.depthTest)
+    {
+        float depth = l0*triangle->z[0] + l1*triangle->z[1] + l2*triangle->z[2];
+        if (depth > RLGL.Software.depth[index]) return;
+        if (RLGL.Software.depthMask) RLGL.Software.depth[index] = depth;
     }
-}
 
-// Matrix state management
-//-----------------------------------------------------------------------------------------
-// Get internal modelview matrix
-Matrix rlGetMatrixModelview(void)
-{
-    Matrix matrix = MatrixIdentity();
-    matrix = RLGL.State.modelview;
-    return matrix;
-}
+    // Perspective correct barycentric coordinates
+    float p0 = l0*triangle->invW[0];
+    float p1 = l1*triangle->invW[1];
+    float p2 = l2*triangle->invW[2];
+    float scale = 1.0f/(p0 + p1 + p2);
+    p0 *= scale;
+    p1 *= scale;
+    p2 *= scale;
 
-// Get internal projection matrix
-Matrix rlGetMatrixProjection(void)
-{
-    return RLGL.State.projection;
-}
+    float src[4] = { 0 };
+    for (int c = 0; c < 4; c++) src[c] = (p0*triangle->color[0][c] + p1*triangle->color[1][c] + p2*triangle->color[2][c])/255.0f;
 
-// Get internal accumulated transform matrix
-Matrix rlGetMatrixTransform(void) {
-    return RLGL.State.transform;
-}
+    if (triangle->texture >= 0)
+    {
+        float texel[4] = { 0 };
+        float u = p0*triangle->u[0] + p1*triangle->u[1] + p2*triangle->u[2];
+        float v = p0*triangle->v[0] + p1*triangle->v[1] + p2*triangle->v[2];
 
-// Get internal projection matrix for stereo render (selected eye)
-Matrix rlGetMatrixProjectionStereo(int eye)
-{
-    Matrix mat = MatrixIdentity();
-    mat = RLGL.State.projectionStereo[eye];
-    return mat;
-}
+        rlSoftwareSampleTexture(&RLGL.Software.textures[triangle->texture], u, v, texel);
+        for (int c = 0; c < 4; c++) src[c] *= texel[c];
+    }
 
-// Get internal view offset matrix for stereo render (selected eye)
-Matrix rlGetMatrixViewOffsetStereo(int eye)
-{
-    Matrix mat = MatrixIdentity();
-    mat = RLGL.State.viewOffsetStereo[eye];
-    return mat;
-}
+    for (int c = 0; c < 4; c++) src[c] = (src[c] < 0.0f)? 0.0f : ((src[c] > 1.0f)? 1.0f : src[c]);
 
-// Set a custom modelview matrix (replaces internal modelview matrix)
-void rlSetMatrixModelview(Matrix view)
-{
-    RLGL.State.modelview = view;
-}
+    unsigned char *pixel = &RLGL.Software.color[4*index];
 
-// Set a custom projection matrix (replaces internal projection matrix)
-void rlSetMatrixProjection(Matrix projection)
-{
-    RLGL.State.projection = projection;
-}
+    if (RLGL.Software.blend && (RLGL.Software.blendSrcFactor == GL_SRC_ALPHA) &&
+        (RLGL.Software.blendDstFactor == GL_ONE_MINUS_SRC_ALPHA) && (RLGL.Software.blendEquation == GL_FUNC_ADD))
+    {
+        // Alpha blending (default blend mode), opaque fragments replace destination
+        if (src[3] < 1.0f)
+        {
+            for (int c = 0; c < 4; c++) src[c] = src[c]*src[3] + pixel[c]/255.0f*(1.0f - src[3]);
+        }
+    }
+    else if (RLGL.Software.blend)
+    {
+        float dst[4] = { pixel[0]/255.0f, pixel[1]/255.0f, pixel[2]/255.0f, pixel[3]/255.0f };
+        float srcFactors[4] = { 0 };
+        float dstFactors[4] = { 0 };
+        float result[4] = { 0 };
 
-// Set eyes projection matrices for stereo rendering
-void rlSetMatrixProjectionStereo(Matrix right, Matrix left)
-{
-    RLGL.State.projectionStereo[0] = right;
-    RLGL.State.projectionStereo[1] = left;
-}
+        rlSoftwareBlendFactors(RLGL.Software.blendSrcFactor, src, dst, srcFactors);
+        rlSoftwareBlendFactors(RLGL.Software.blendDstFactor, src, dst, dstFactors);
 
-// Set eyes view offsets matrices for stereo rendering
-void rlSetMatrixViewOffsetStereo(Matrix right, Matrix left)
-{
-    RLGL.State.viewOffsetStereo[0] = right;
-    RLGL.State.viewOffsetStereo[1] = left;
+        for (int c = 0; c < 4; c++)
+        {
+            float s = src[c]*srcFactors[c];
+            float d = dst[c]*dstFactors[c];
+
+            switch (RLGL.Software.blendEquation)
+            {
+                case GL_FUNC_SUBTRACT: result[c] = s - d; break;
+                case GL_FUNC_REVERSE_SUBTRACT: result[c] = d - s; break;
+                case GL_MIN: result[c] = fminf(src[c], dst[c]); break;
+                case GL_MAX: result[c] = fmaxf(src[c], dst[c]); break;
+                default: result[c] = s + d; break;
+            }
+
+            src[c] = (result[c] < 0.0f)? 0.0f : ((result[c] > 1.0f)? 1.0f : result[c]);
+        }
+    }
+
+    for (int c = 0; c < 4; c++) pixel[c] = (unsigned char)(src[c]*255.0f + 0.5f);
 }
 
-// Get name string for pixel format
-const char *rlGetPixelFormatName(unsigned int format)
+// Sample software texture at texture coordinates, nearest or bilinear filtering
+static void rlSoftwareSampleTexture(const rlSoftwareTexture *texture, float u, float v, float *texel)
 {
-    switch (format)
+    // Texels coordinates, limited to keep integer conversion valid
+    float s = fmaxf(fminf(u*texture->width, 16777216.0f), -16777216.0f);
+    float t = fmaxf(fminf(v*texture->height, 16777216.0f), -16777216.0f);
+    if (texture->linear)
     {
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: return "GRAYSCALE"; break;         // 8 bit per pixel (no alpha)
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: return "GRAY_ALPHA"; break;       // 8*2 bpp (2 channels)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: return "R5G6B5"; break;               // 16 bpp
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: return "R8G8B8"; break;               // 24 bpp
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: return "R5G5B5A1"; break;           // 16 bpp (1 bit alpha)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: return "R4G4B4A4"; break;           // 16 bpp (4 bit alpha)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: return "R8G8B8A8"; break;           // 32 bpp
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: return "R32"; break;                     // 32 bpp (1 channel - float)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: return "R32G32B32"; break;         // 32*3 bpp (3 channels - float)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: return "R32G32B32A32"; break;   // 32*4 bpp (4 channels - float)
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: return "DXT1_RGB"; break;             // 4 bpp (no alpha)
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: return "DXT1_RGBA"; break;           // 4 bpp (1 bit alpha)
-        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: return "DXT3_RGBA"; break;           // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: return "DXT5_RGBA"; break;           // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: return "ETC1_RGB"; break;             // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: return "ETC2_RGB"; break;             // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: return "ETC2_RGBA"; break;       // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: return "PVRT_RGB"; break;             // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: return "PVRT_RGBA"; break;           // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: return "ASTC_4x4_RGBA"; break;   // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: return "ASTC_8x8_RGBA"; break;   // 2 bpp
-        default: return "UNKNOWN"; break;
+        s -= 0.5f;
+        t -= 0.5f;
     }
-}
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-// Load default shader (just vertex positioning and texture coloring)
-// NOTE: This shader program is used for internal buffers
-// NOTE: Loaded: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
-static void rlLoadShaderDefault(void)
-{
-    RLGL.State.defaultShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+    float s0 = floorf(s);
+    float t0 = floorf(t);
+    int coords[2][2] = { { (int)s0, (int)s0 + 1 }, { (int)t0, (int)t0 + 1 } };
+    int sizes[2] = { texture->width, texture->height };
+    int wraps[2] = { texture->wrapS, texture->wrapT };
 
-    // NOTE: All locations must be reseted to -1 (no location)
-    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.defaultShaderLocs[i] = -1;
+    // Apply wrap mode to texels coordinates
+    for (int axis = 0; axis < 2; axis++)
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            int coord = coords[axis][i];
+            int size = sizes[axis];
 
-    // Vertex shader directly defined, no external file required
-    const char *defaultVShaderCode =
-    "#version 330                       \n"
-    "in vec3 vertexPosition;            \n"
-    "in vec2 vertexTexCoord;            \n"
-    "in vec4 vertexColor;               \n"
-    "out vec2 fragTexCoord;             \n"
-    "out vec4 fragColor;                \n"
-    "uniform mat4 mvp;                  \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    fragTexCoord = vertexTexCoord; \n"
-    "    fragColor = vertexColor;       \n"
-    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
-    "}                                  \n";
+            switch (wraps[axis])
+            {
+                case GL_CLAMP_TO_EDGE: break;
+                case RL_TEXTURE_WRAP_MIRROR_CLAMP: if (coord < 0) coord = -1 - coord; break;
+                case GL_MIRRORED_REPEAT:
+                {
+                    coord %= 2*size;
+                    if (coord < 0) coord += 2*size;
+                    if (coord >= size) coord = 2*size - 1 - coord;
+                } break;
+                default:
+                {
+                    coord %= size;
+                    if (coord < 0) coord += size;
+                } break;
+            }
 
-    // Fragment shader directly defined, no external file required
-    const char *defaultFShaderCode =
-    "#version 330       \n"
-    "in vec2 fragTexCoord;              \n"
-    "in vec4 fragColor;                 \n"
-    "out vec4 finalColor;               \n"
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
-    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
-    "}                                  \n";
+            coords[axis][i] = (coord < 0)? 0 : ((coord >= size)? size - 1 : coord);
+        }
+    }
 
-    // NOTE: Compiled vertex/fragment shaders are kept for re-use
-    RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
-    RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+    const unsigned char *pixels = texture->pixels;
+    int width = texture->width;
 
-    RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+    if (texture->linear)
+    {
+        float fs = s - s0;
+        float ft = t - t0;
+        const unsigned char *p00 = &pixels[4*(coords[1][0]*width + coords[0][0])];
+        const unsigned char *p10 = &pixels[4*(coords[1][0]*width + coords[0][1])];
+        const unsigned char *p01 = &pixels[4*(coords[1][1]*width + coords[0][0])];
+        const unsigned char *p11 = &pixels[4*(coords[1][1]*width + coords[0][1])];
+
+        for (int c = 0; c < 4; c++)
+        {
+            float top = p00[c] + (p10[c] - p00[c])*fs;
+            float bottom = p01[c] + (p11[c] - p01[c])*fs;
+            texel[c] = (top + (bottom - top)*ft)/255.0f;
+        }
+    }
+    else
+    {
+        const unsigned char *p = &pixels[4*(coords[1][0]*width + coords[0][0])];
+        for (int c = 0; c < 4; c++) texel[c] = p[c]/255.0f;
+    }
+}
 
-    if (RLGL.State.defaultShaderId > 0)
+// Get blending factor values for every color channel (OpenGL blending factors)
+static void rlSoftwareBlendFactors(int factor, const float *src, const float *dst, float *factors)
+{
+    for (int c = 0; c < 4; c++)
     {
-        TRACELOG(LOG_INFO, "SHADER: [ID %i] Default shader loaded successfully", RLGL.State.defaultShaderId);
+        switch (factor)
+        {
+            case GL_ZERO: factors[c] = 0.0f; break;
+            case GL_SRC_COLOR: factors[c] = src[c]; break;
+            case GL_ONE_MINUS_SRC_COLOR: factors[c] = 1.0f - src[c]; break;
+            case GL_SRC_ALPHA: factors[c] = src[3]; break;
+            case GL_ONE_MINUS_SRC_ALPHA: factors[c] = 1.0f - src[3]; break;
+            case GL_DST_ALPHA: factors[c] = dst[3]; break;
+            case GL_ONE_MINUS_DST_ALPHA: factors[c] = 1.0f - dst[3]; break;
+            case GL_DST_COLOR: factors[c] = dst[c]; break;
+            case GL_ONE_MINUS_DST_COLOR: factors[c] = 1.0f - dst[c]; break;
+            case GL_SRC_ALPHA_SATURATE: factors[c] = (c < 3)? fminf(src[3], 1.0f - dst[3]) : 1.0f; break;
+            default: factors[c] = 1.0f; break;  // GL_ONE
+        }
+    }
+}
 
-        // Set default shader locations: attributes locations
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexPosition");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexTexCoord");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexColor");
+// Start rasterizer worker threads, they are parked until a flush wakes them (rlSoftwareRasterize())
+// NOTE: Rasterization continues with less threads if some workers could not be started
+static void rlSoftwareStartWorkers(void)
+{
+    int count = RLGL.Software.threadCount - 1;
 
-        // Set default shader locations: uniform locations
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.defaultShaderId, "mvp");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "colDiffuse");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "texture0");
+    RLGL.Software.workerCount = 0;
+    RLGL.Software.workersQuit = false;
+    if (count <= 0) return;
+
+#if defined(_WIN32)
+    RLGL.Software.workStart = CreateSemaphoreA(NULL, 0, RLGL_SOFTWARE_MAX_THREADS, NULL);
+    RLGL.Software.workDone = CreateSemaphoreA(NULL, 0, RLGL_SOFTWARE_MAX_THREADS, NULL);
+
+    if ((RLGL.Software.workStart != NULL) && (RLGL.Software.workDone != NULL))
+    {
+        for (int i = 0; i < count; i++)
+        {
+            RLGL.Software.workers[RLGL.Software.workerCount] = (void *)_beginthreadex(NULL, 0, rlSoftwareWorker, rlglCurrentContext, 0, NULL);
+            if (RLGL.Software.workers[RLGL.Software.workerCount] != NULL) RLGL.Software.workerCount++;
+        }
     }
-    else TRACELOG(LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
+#else
+    pthread_mutex_init(&RLGL.Software.workMutex, NULL);
+    pthread_cond_init(&RLGL.Software.workStartCond, NULL);
+    pthread_cond_init(&RLGL.Software.workDoneCond, NULL);
+    RLGL.Software.workPending = 0;
+    RLGL.Software.workDoneCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (pthread_create(&RLGL.Software.workers[RLGL.Software.workerCount], NULL, rlSoftwareWorker, rlglCurrentContext) == 0) RLGL.Software.workerCount++;
+    }
+#endif
+
+    if (RLGL.Software.workerCount < count) TRACELOG(LOG_WARNING, "RLGL: Software rasterizer worker threads not started (%i of %i)", count - RLGL.Software.workerCount, count);
 }
 
-// Unload default shader
-// NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
-static void rlUnloadShaderDefault(void)
+// Stop rasterizer worker threads and wait for them
+static void rlSoftwareStopWorkers(void)
 {
-    glUseProgram(0);
+    if (RLGL.Software.threadCount <= 1) return;
 
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
-    glDeleteShader(RLGL.State.defaultVShaderId);
-    glDeleteShader(RLGL.State.defaultFShaderId);
+#if defined(_WIN32)
+    RLGL.Software.workersQuit = true;
+    if (RLGL.Software.workerCount > 0) ReleaseSemaphore(RLGL.Software.workStart, RLGL.Software.workerCount, NULL);
 
-    glDeleteProgram(RLGL.State.defaultShaderId);
+    for (int i = 0; i < RLGL.Software.workerCount; i++)
+    {
+        WaitForSingleObject(RLGL.Software.workers[i], 0xFFFFFFFF);
+        CloseHandle(RLGL.Software.workers[i]);
+    }
 
-    RL_FREE(RLGL.State.defaultShaderLocs);
+    if (RLGL.Software.workStart != NULL) CloseHandle(RLGL.Software.workStart);
+    if (RLGL.Software.workDone != NULL) CloseHandle(RLGL.Software.workDone);
+    RLGL.Software.workStart = NULL;
+    RLGL.Software.workDone = NULL;
+#else
+    pthread_mutex_lock(&RLGL.Software.workMutex);
+    RLGL.Software.workersQuit = true;
+    pthread_cond_broadcast(&RLGL.Software.workStartCond);
+    pthread_mutex_unlock(&RLGL.Software.workMutex);
+
+    for (int i = 0; i < RLGL.Software.workerCount; i++) pthread_join(RLGL.Software.workers[i], NULL);
+
+    pthread_cond_destroy(&RLGL.Software.workStartCond);
+    pthread_cond_destroy(&RLGL.Software.workDoneCond);
+    pthread_mutex_destroy(&RLGL.Software.workMutex);
+#endif
 
-    TRACELOG(LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
+    RLGL.Software.workerCount = 0;
+    RLGL.Software.threadCount = 1;
 }
-#endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
-// Get pixel data size in bytes (image or texture)
-// NOTE: Size depends on pixel format
-static int rlGetPixelDataSize(int width, int height, int format)
+// Rasterizer worker thread, parked until woken by a flush, then rasterizes tiles until no tile left
+// NOTE: Worker argument is the rlgl context rasterizing, made current on worker thread
+#if defined(_WIN32)
+static unsigned __stdcall rlSoftwareWorker(void *arg)
 {
-    int dataSize = 0;       // Size in bytes
-    int bpp = 0;            // Bits per pixel
+    rlglCurrentContext = (rlglData *)arg;
 
-    switch (format)
+    while (true)
     {
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB:
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA:
-        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB:
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB:
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB:
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
-        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
-        default: break;
+        WaitForSingleObject(RLGL.Software.workStart, 0xFFFFFFFF);
+        if (RLGL.Software.workersQuit) break;
+
+        rlSoftwareRasterizeTiles();
+        ReleaseSemaphore(RLGL.Software.workDone, 1, NULL);
     }
 
-    dataSize = width*height*bpp/8;  // Total data size in bytes
+    return 0;
+}
+#else
+static void *rlSoftwareWorker(void *arg)
+{
+    rlglCurrentContext = (rlglData *)arg;
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    pthread_mutex_lock(&RLGL.Software.workMutex);
+
+    while (true)
     {
-        if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+        while ((RLGL.Software.workPending == 0) && !RLGL.Software.workersQuit) pthread_cond_wait(&RLGL.Software.workStartCond, &RLGL.Software.workMutex);
+        if (RLGL.Software.workersQuit) break;
+        RLGL.Software.workPending--;
+        pthread_mutex_unlock(&RLGL.Software.workMutex);
+
+        rlSoftwareRasterizeTiles();
+
+        pthread_mutex_lock(&RLGL.Software.workMutex);
+        RLGL.Software.workDoneCount++;
+        pthread_cond_signal(&RLGL.Software.workDoneCond);
     }
 
-    return dataSize;
+    pthread_mutex_unlock(&RLGL.Software.workMutex);
+
+    return NULL;
 }
+#endif
@@ -22,11 +22,28 @@
 // This is the maximum amount of elements (quads) per batch
 // NOTE: Be careful with text, every letter maps to a quad
 #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS  8192
-#define RL_DEFAULT_BATCH_BUFFERS                 1      // Default number of batch buffers (multi-buffering)
-#define RL_DEFAULT_BATCH_DRAWCALLS             256      // Default number of batch draw calls (by state changes: mode, texture)
+#define RL_DEFAULT_BATCH_BUFFERS                 3      // Default number of batch buffers (multi-buffering ring, rotated on every flush)
+#define RL_DEFAULT_BATCH_DRAWCALLS             256      // Default number of batch draw calls (by state changes: mode, texture not fitting draw texture slots)
 #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+#ifndef RL_DEFAULT_BATCH_TEXTURE_SLOTS
+#define RL_DEFAULT_BATCH_TEXTURE_SLOTS           8      // Textures sampled by default shader in a single batch draw call (1..8, 1 = one draw call per texture)
+#endif
+#ifndef RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS
+#define RL_DEFAULT_BATCH_MAX_BUFFER_ELEMENTS (8*RL_DEFAULT_BATCH_BUFFER_ELEMENTS)  // Maximum elements a batch buffer can grow to before forcing a draw (no growth if not bigger than buffer elements)
+#endif
+#ifndef RL_DEFAULT_BATCH_INTERLEAVED
+#define RL_DEFAULT_BATCH_INTERLEAVED             0      // Batch vertex layout: 0 = one VBO per attribute, 1 = single interleaved VBO (rlBatchVertex)
+#endif
+// Validate GL state cache against OpenGL queries after every render batch draw (debug only, queries stall the pipeline)
+//#define RLGL_STATE_CACHE_VALIDATION
 #define RL_MAX_MATRIX_STACK_SIZE                32      // Internal Maximum size of Matrix stack
 #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
+#define RL_DEFAULT_CAMERA_UNIFORM_BINDING        0      // Uniform block binding point of internal camera matrices buffer (view, projection)
+
+// GPU profiling zones (timestamp queries)
+#define RL_MAX_GPU_ZONES                        32      // Maximum number of different GPU zones (by name)
+#define RL_MAX_GPU_ZONE_QUERIES                256      // Maximum number of GPU zones measured per frame
+#define RL_GPU_ZONE_FRAMES                       4      // Frames of GPU zone queries in flight, results are read back with this latency
 
 // Projection matrix culling
 #define RL_CULL_DISTANCE_NEAR                 0.01      // Default near cull distance
@@ -81,6 +98,20 @@
 #define RL_VERTEX_SHADER                        0x8B31      // GL_VERTEX_SHADER
 #define RL_COMPUTE_SHADER                       0x91B9      // GL_COMPUTE_SHADER
 
+// GL memory barriers (equivalent to OpenGL bits), required after compute shader writes
+#define RL_BARRIER_VERTEX_ATTRIB_ARRAY          0x00000001  // GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT
+#define RL_BARRIER_ELEMENT_ARRAY                0x00000002  // GL_ELEMENT_ARRAY_BARRIER_BIT
+#define RL_BARRIER_UNIFORM                      0x00000004  // GL_UNIFORM_BARRIER_BIT
+#define RL_BARRIER_TEXTURE_FETCH                0x00000008  // GL_TEXTURE_FETCH_BARRIER_BIT
+#define RL_BARRIER_SHADER_IMAGE_ACCESS          0x00000020  // GL_SHADER_IMAGE_ACCESS_BARRIER_BIT
+#define RL_BARRIER_COMMAND                      0x00000040  // GL_COMMAND_BARRIER_BIT
+#define RL_BARRIER_PIXEL_BUFFER                 0x00000080  // GL_PIXEL_BUFFER_BARRIER_BIT
+#define RL_BARRIER_TEXTURE_UPDATE               0x00000100  // GL_TEXTURE_UPDATE_BARRIER_BIT
+#define RL_BARRIER_BUFFER_UPDATE                0x00000200  // GL_BUFFER_UPDATE_BARRIER_BIT
+#define RL_BARRIER_FRAMEBUFFER                  0x00000400  // GL_FRAMEBUFFER_BARRIER_BIT
+#define RL_BARRIER_SHADER_STORAGE               0x00002000  // GL_SHADER_STORAGE_BARRIER_BIT
+#define RL_BARRIER_ALL                          0xFFFFFFFF  // GL_ALL_BARRIER_BITS
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -108,17 +139,30 @@ typedef enum {
     RL_ATTACHMENT_RENDERBUFFER = 200,
 } rlFramebufferAttachTextureType;
 
+// Interleaved batch vertex (24 bytes)
+typedef struct rlBatchVertex {
+    float x, y, z;              // Vertex position (shader-location = 0)
+    float u, v;                 // Vertex texture coordinates (shader-location = 1)
+    unsigned char r, g, b, a;   // Vertex color (shader-location = 3)
+} rlBatchVertex;
+
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
+// NOTE: With RL_DEFAULT_BATCH_INTERLEAVED, vertex data is stored in vertexData (single VBO)
+// and vertices/texcoords/colors arrays are not allocated (NULL), texture slots always use their own VBO
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
 
     float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+    rlBatchVertex *vertexData;  // Interleaved vertex data (position + texcoords + color), only for interleaved layout
     unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
+    unsigned char *textureSlots; // Vertex texture slot (1 component per vertex), draw texture index remapped to batch slot on batch draw (shader-location = 15)
 
     unsigned int vaoId;         // OpenGL Vertex Array Object id
-    unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+    unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (position, texcoords, colors, indices, texture slots)
+    void *vboMapped[3];         // Persistently mapped pointers of vboId[0..2] (NULL if buffers are orphaned on update)
+    void *syncFence;            // OpenGL fence (GLsync) signaled once the GPU is done with the buffer data
 } rlVertexBuffer;
 
 // Draw call type
@@ -131,7 +175,11 @@ typedef struct rlDrawCall {
     int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
     //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
-    unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
+    unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes (last texture set if folded)
+    unsigned int textureIds[RL_DEFAULT_BATCH_TEXTURE_SLOTS];    // Textures folded into the draw, selected by vertex texture slot (default shader only)
+    int textureCount;           // Number of folded textures (0: all the draw vertex use textureId)
+    int layer;                  // Draw layer, layers are drawn in ascending order (sorted drawing only)
+    int layerOrdered;           // Draw keeps submission order inside its layer (sorted drawing only)
 
     //Matrix projection;      // Projection matrix for this draw -> Using RLGL.projection by default
     //Matrix modelview;       // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -148,6 +196,96 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// Command buffer, CPU vertex data and draws recorded by one thread, submitted later into active render batch
+// NOTE: Recording state is kept per buffer (current texcoord/color, modelview transform stack)
+typedef struct rlCommandBuffer {
+    float *vertices;            // Vertex position (XYZ - 3 components per vertex), transformed on recording
+    float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex)
+    unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex)
+    int vertexCount;            // Recorded vertex count
+    int vertexCapacity;         // Vertex arrays capacity
+
+    rlDrawCall *draws;          // Recorded draws, consecutive vertex ranges (no alignment vertex)
+    int drawCount;              // Recorded draws count
+    int drawCapacity;           // Draws array capacity
+
+    float texcoord[2];          // Current texture coordinate (added on rlVertex*())
+    unsigned char color[4];     // Current color (added on rlVertex*())
+    float currentDepth;         // Current depth value for next 2D vertex
+    int layer;                  // Layer assigned to new draws
+    int layerOrdered;           // New draws keep submission order inside their layer
+
+    Matrix transform;           // Current modelview transform (rlTranslatef, rlRotatef, rlScalef...)
+    int transformRequired;      // Transform must be applied to recorded vertex
+    Matrix stack[RL_MAX_MATRIX_STACK_SIZE]; // Transform stack for push/pop
+    int stackCounter;           // Transform stack counter
+} rlCommandBuffer;
+
+// rlgl context, owns render batch, matrix stack, default shader/texture and GL state cache (opaque)
+typedef struct rlglData rlContext;
+
+// Display list draw, recorded geometry range drawn with one texture
+typedef struct rlDisplayListDraw {
+    int mode;                   // Drawing mode: RL_LINES or RL_TRIANGLES (QUADS are recorded as triangles)
+    int indexOffset;            // First index of the draw
+    int indexCount;             // Number of indices of the draw
+    unsigned int textureId;     // Texture id to be used on the draw
+} rlDisplayListDraw;
+
+// Display list, geometry recorded with rlBegin()/rlVertex*()/rlEnd() stored in VRAM (GPU)
+typedef struct rlDisplayList {
+    unsigned int vaoId;         // OpenGL Vertex Array Object id
+    unsigned int vboId[2];      // OpenGL Vertex Buffer Objects id (interleaved vertex data, indices)
+    int vertexCount;            // Number of vertex recorded
+    int drawCount;              // Number of draws
+    rlDisplayListDraw *draws;   // Draws array
+} rlDisplayList;
+
+// Indirect draw command, memory layout defined by OpenGL (glMultiDrawElementsIndirect())
+typedef struct rlDrawElementsCommand {
+    unsigned int count;         // Number of indices to draw
+    unsigned int instanceCount; // Number of instances to draw
+    unsigned int firstIndex;    // First index in element buffer (32 bit indices)
+    int baseVertex;             // Value added to every index
+    unsigned int baseInstance;  // First instance, offsets per-instance attributes (requires base instance support)
+} rlDrawElementsCommand;
+
+// Render batch statistics
+// NOTE: Counters are reset by rlResetRenderBatchStats(), raylib does it on every BeginDrawing()
+typedef struct rlRenderBatchStats {
+    int flushCount;             // Number of render batch flushes with vertex data
+    int waitCount;              // Number of flushes that had to wait for the GPU to release a ring buffer
+    int drawCallCount;          // Number of OpenGL draw calls issued by render batch flushes
+    int vertexCount;            // Number of vertex uploaded by render batch flushes
+    int growCount;              // Number of batch buffer growths (done instead of a forced flush)
+    int bufferElements;         // Current batch buffer elements, high-water mark kept across frames (not reset)
+} rlRenderBatchStats;
+
+// GL state cache statistics
+// NOTE: Counters are reset by rlResetStateCacheStats(), raylib does it on every BeginDrawing()
+typedef struct rlStateCacheStats {
+    int issuedCount;            // Number of state changes (binds, enables) issued to OpenGL
+    int skippedCount;           // Number of redundant state changes filtered by the cache
+} rlStateCacheStats;
+
+// GPU profiling zone, GPU time measured between rlBeginGpuZone() and rlEndGpuZone()
+typedef struct rlGpuZone {
+    const char *name;           // Zone name (string must be kept alive, usually a literal)
+    float time;                 // GPU time in milliseconds, all zone instances of the frame
+    int count;                  // Number of zone instances measured in the frame
+} rlGpuZone;
+
+// Command trace replay statistics, returned by rlReplayTrace()
+typedef struct rlTraceStats {
+    int frameCount;             // Number of frames replayed (all loops)
+    double cpuTime;             // CPU time replaying frames, in seconds (resources loading is included on first loop)
+    double frameTimeMin;        // Minimum frame CPU time in seconds
+    double frameTimeMax;        // Maximum frame CPU time in seconds
+    int drawCallCount;          // Number of OpenGL draw calls issued by render batch flushes
+    int flushCount;             // Number of render batch flushes with vertex data
+    long long vertexCount;      // Number of vertex uploaded by render batch flushes
+} rlTraceStats;
+
 #if defined(__STDC__) && __STDC_VERSION__ >= 199901L
     #include <stdbool.h>
 #elif !defined(__cplusplus) && !defined(bool) && !defined(RL_BOOL_TYPE)
@@ -229,7 +367,10 @@ typedef enum {
     RL_SHADER_LOC_MAP_CUBEMAP,         // Shader location: samplerCube texture: cubemap
     RL_SHADER_LOC_MAP_IRRADIANCE,      // Shader location: samplerCube texture: irradiance
     RL_SHADER_LOC_MAP_PREFILTER,       // Shader location: samplerCube texture: prefilter
-    RL_SHADER_LOC_MAP_BRDF             // Shader location: sampler2d texture: brdf
+    RL_SHADER_LOC_MAP_BRDF,            // Shader location: sampler2d texture: brdf
+    RL_SHADER_LOC_BLOCK_CAMERA,        // Shader location: uniform block: camera matrices (view, projection)
+    RL_SHADER_LOC_INSTANCE_COLOR,      // Shader location: vertex attribute: instance color
+    RL_SHADER_LOC_INSTANCE_CUSTOM      // Shader location: vertex attribute: instance custom data (vec4)
 } rlShaderLocationIndex;
 
 #define RL_SHADER_LOC_MAP_DIFFUSE      RL_SHADER_LOC_MAP_ALBEDO
@@ -279,11 +420,13 @@ RLAPI void rlViewport(int x, int y, int width, int height); // Set the viewport
 //------------------------------------------------------------------------------------
 // Functions Declaration - Vertex level operations
 //------------------------------------------------------------------------------------
-RLAPI void rlBegin(int mode);                         // Initialize drawing mode (how to organize vertex)
+RLAPI void rlBegin(int mode);                         // Initialize drawing mode (how to organize vertex), texture set just before is kept
 RLAPI void rlEnd(void);                               // Finish vertex providing
 RLAPI void rlVertex2i(int x, int y);                  // Define one vertex (position) - 2 int
 RLAPI void rlVertex2f(float x, float y);              // Define one vertex (position) - 2 float
 RLAPI void rlVertex3f(float x, float y, float z);     // Define one vertex (position) - 3 float
+RLAPI void rlVertexBulk2f(const float *positions, const float *texcoords, const unsigned char *colors, int count); // Define multiple vertex (XY position, UV texcoord, RGBA color), NULL texcoords/colors use current
+RLAPI void rlVertexBulk3f(const float *positions, const float *texcoords, const unsigned char *colors, int count); // Define multiple vertex (XYZ position, UV texcoord, RGBA color), NULL texcoords/colors use current
 RLAPI void rlTexCoord2f(float x, float y);            // Define one vertex (texture coordinate) - 2 float
 RLAPI void rlNormal3f(float x, float y, float z);     // Define one vertex (normal) - 3 float
 RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a);  // Define one vertex (color) - 4 byte
@@ -321,6 +464,8 @@ RLAPI void rlDisableShader(void);                       // Disable shader progra
 // Framebuffer state
 RLAPI void rlEnableFramebuffer(unsigned int id);        // Enable render texture (fbo)
 RLAPI void rlDisableFramebuffer(void);                  // Disable render texture (fbo), return to default framebuffer
+RLAPI void rlSetDefaultFramebuffer(unsigned int id);    // Set default framebuffer, binded when no render texture is enabled (0 = window framebuffer)
+RLAPI unsigned int rlGetDefaultFramebuffer(void);       // Get default framebuffer id
 RLAPI void rlActiveDrawBuffers(int count);              // Activate multiple draw color buffers
 
 // General render state
@@ -345,6 +490,14 @@ RLAPI void rlEnableStereoRender(void);                  // Enable stereo renderi
 RLAPI void rlDisableStereoRender(void);                 // Disable stereo rendering
 RLAPI bool rlIsStereoRenderEnabled(void);               // Check if stereo render is enabled
 
+// GL state cache
+// NOTE: Redundant binds and enables are filtered against a shadow copy of OpenGL state,
+// any direct OpenGL call changing that state must be followed by rlResetStateCache()
+RLAPI void rlResetStateCache(void);                     // Mark all cached OpenGL state as unknown (next changes are always issued)
+RLAPI bool rlValidateStateCache(void);                  // Check cached state against OpenGL queries, mismatches are logged (debug, slow)
+RLAPI rlStateCacheStats rlGetStateCacheStats(void);     // Get GL state cache statistics since last reset
+RLAPI void rlResetStateCacheStats(void);                // Reset GL state cache statistics (once per frame)
+
 RLAPI void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Clear color buffer with color
 RLAPI void rlClearScreenBuffers(void);                  // Clear used screen buffers (color and depth)
 RLAPI void rlCheckErrors(void);                         // Check and log OpenGL error codes
@@ -366,6 +519,17 @@ RLAPI unsigned int rlGetTextureIdDefault(void);       // Get default texture id
 RLAPI unsigned int rlGetShaderIdDefault(void);        // Get default shader id
 RLAPI int *rlGetShaderLocsDefault(void);              // Get default shader locations
 
+// rlgl contexts management
+// NOTE: Every thread has a current rlgl context (default one until changed), all rlgl functions work on it;
+// an rlgl context must only be used with the OpenGL context it was created on (made current on the same thread),
+// textures, buffers and shaders can be shared by OpenGL contexts sharing objects, vertex arrays and framebuffers can not
+// (default framebuffer is inherited from current rlgl context, use rlSetDefaultFramebuffer() on a different OpenGL context)
+RLAPI rlContext *rlCreateContext(int width, int height);     // Create rlgl context and make it current on calling thread (OpenGL context must be current)
+RLAPI void rlDestroyContext(rlContext *context);             // Destroy rlgl context (OpenGL context it was created on must be current)
+RLAPI void rlSetCurrentContext(rlContext *context);          // Set rlgl context current on calling thread (NULL for default context)
+RLAPI rlContext *rlGetCurrentContext(void);                  // Get rlgl context current on calling thread
+RLAPI rlContext *rlGetDefaultContext(void);                  // Get default rlgl context (initialized by rlglInit() on InitGraph())
+
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
 // but this render batch API is exposed in case of custom batches are required
@@ -376,6 +540,59 @@ RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch);                    // S
 RLAPI void rlDrawRenderBatchActive(void);                                   // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);                             // Check internal buffer overflow for a given number of vertex
 RLAPI void rlSetTexture(unsigned int id);           // Set current texture for render batch and check buffers limits
+RLAPI rlRenderBatchStats rlGetRenderBatchStats(void);                       // Get render batch statistics since last reset
+RLAPI void rlResetRenderBatchStats(void);                                   // Reset render batch statistics (once per frame)
+RLAPI void rlEnableDrawSorting(void);                                       // Enable sorted batch drawing (draws sorted by layer, texture and mode)
+RLAPI void rlDisableDrawSorting(void);                                      // Disable sorted batch drawing (draws in submission order)
+RLAPI void rlSetDrawLayer(int layer, bool ordered);                         // Set layer for next batch draws, ordered layers keep submission order (2D/translucent)
+
+// Command buffers management
+// NOTE: Any thread can record into its own command buffer: between rlBeginCommandBuffer() and rlEndCommandBuffer() immediate mode
+// vertex, texture, layer and modelview matrix functions on that thread are recorded into the buffer (no OpenGL calls are issued),
+// rendering thread submits buffers in array order, the result does not depend on threads completion order
+RLAPI rlCommandBuffer rlLoadCommandBuffer(int vertexCapacity);             // Load command buffer (CPU only, it grows when required)
+RLAPI void rlUnloadCommandBuffer(rlCommandBuffer buffer);                   // Unload command buffer
+RLAPI void rlBeginCommandBuffer(rlCommandBuffer *buffer);                   // Begin recording into command buffer on calling thread (previous content is discarded)
+RLAPI void rlEndCommandBuffer(void);                                        // End recording on calling thread
+RLAPI void rlSubmitCommandBuffers(const rlCommandBuffer *buffers, int count);   // Submit command buffers into active render batch, in array order (rendering thread only)
+
+// GPU profiling zones
+// NOTE: Zones are measured with timestamp queries read back RL_GPU_ZONE_FRAMES frames later (no stalls), zones can be nested,
+// when enabled rlDrawRenderBatch(), DrawMesh() and BeginMode3D()/EndMode3D() are measured automatically
+RLAPI void rlEnableGpuZones(void);                                          // Enable GPU profiling zones (queries are created)
+RLAPI void rlDisableGpuZones(void);                                         // Disable GPU profiling zones (queries and results are discarded)
+RLAPI bool rlIsGpuZonesEnabled(void);                                       // Check if GPU profiling zones are enabled
+RLAPI void rlBeginGpuZone(const char *name);                                // Begin GPU profiling zone (instances with same name are accumulated)
+RLAPI void rlEndGpuZone(void);                                              // End last begun GPU profiling zone
+RLAPI void rlUpdateGpuZones(void);                                          // End GPU zones frame and read back completed frames (once per frame, raylib does it on EndDrawing())
+RLAPI rlGpuZone *rlGetGpuZones(int *count);                                 // Get GPU zones results of last completed frame
+RLAPI float rlGetGpuZoneTime(const char *name);                             // Get GPU zone time of last completed frame (milliseconds, 0 if not measured)
+
+// Display lists management
+// NOTE: Geometry defined between rlBeginRecord() and rlEndRecord() is not drawn but stored in VRAM (GPU),
+// to be drawn later with any transform and without any CPU vertex work (i.e. static grids, planes)
+RLAPI void rlBeginRecord(void);                                             // Begin display list recording, following batch geometry is captured
+RLAPI rlDisplayList rlEndRecord(void);                                      // End display list recording and upload captured geometry
+RLAPI void rlDrawDisplayList(rlDisplayList list, Matrix transform);         // Draw display list with a transform (current shader and matrices)
+RLAPI void rlUnloadDisplayList(rlDisplayList list);                         // Unload display list from VRAM (GPU) and RAM
+
+// Command trace capture and replay
+// NOTE: Immediate mode commands, render state, textures, shaders and uniforms set through rlgl are written to a binary trace,
+// replay re-executes them as fast as possible to measure rlgl CPU cost per frame (display lists, vertex arrays and framebuffers not traced)
+RLAPI bool rlBeginTraceCapture(const char *fileName);                       // Begin command trace capture into a file
+RLAPI void rlEndTraceCapture(void);                                         // End command trace capture, trace file is closed
+RLAPI bool rlIsTraceCapturing(void);                                        // Check if command trace capture is active
+RLAPI void rlTraceFrame(void);                                              // Mark end of frame on command trace (raylib does it on EndDrawing())
+RLAPI rlTraceStats rlReplayTrace(const char *fileName, int loops);          // Replay command trace frames (loops times), resources are unloaded at the end
+
+// Software rasterizer
+// NOTE: While enabled, render batch draws are rasterized on CPU into software color/depth buffers instead of OpenGL,
+// triangles are binned into screen tiles rasterized in parallel by worker threads (started on enable, woken on every flush),
+// rlReadScreenPixels() reads the software color buffer; shading matches default shader (vertex color*texture),
+// textures are read back from GPU once on first use
+RLAPI bool rlEnableSoftwareRender(int width, int height, int threadCount);  // Enable software rasterizer with its own color/depth buffers (threadCount: rasterizer threads, 1 = rendering thread only)
+RLAPI void rlDisableSoftwareRender(void);                                   // Disable software rasterizer, worker threads are stopped, buffers and textures copies are unloaded
+RLAPI bool rlIsSoftwareRenderEnabled(void);                                 // Check if software rasterizer is enabled
 
 //------------------------------------------------------------------------------------------------------------------------
 
@@ -384,6 +601,7 @@ RLAPI unsigned int rlLoadVertexArray(void);                               // Loa
 RLAPI unsigned int rlLoadVertexBuffer(void *buffer, int size, bool dynamic);            // Load a vertex buffer attribute
 RLAPI unsigned int rlLoadVertexBufferElement(void *buffer, int size, bool dynamic);     // Load a new attributes element buffer
 RLAPI void rlUpdateVertexBuffer(unsigned int bufferId, void *data, int dataSize, int offset);    // Update GPU buffer with new data
+RLAPI void rlOrphanVertexBuffer(unsigned int bufferId, int size);                 // Orphan GPU buffer storage, previous data is discarded without waiting for GPU
 RLAPI void rlUnloadVertexArray(unsigned int vaoId);
 RLAPI void rlUnloadVertexBuffer(unsigned int vboId);
 RLAPI void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, void *pointer);
@@ -393,6 +611,9 @@ RLAPI void rlDrawVertexArray(int offset, int count);
 RLAPI void rlDrawVertexArrayElements(int offset, int count, void *buffer);
 RLAPI void rlDrawVertexArrayInstanced(int offset, int count, int instances);
 RLAPI void rlDrawVertexArrayElementsInstanced(int offset, int count, void *buffer, int instances);
+RLAPI void rlDrawVertexArrayElementsMulti(const rlDrawElementsCommand *commands, int count);   // Draw multiple element ranges of current vertex array, single indirect draw if supported
+RLAPI bool rlIsDrawBaseInstanceSupported(void);                           // Check draw commands baseInstance support (otherwise ignored)
+RLAPI void rlCopyBufferData(unsigned int srcId, unsigned int dstId, int srcOffset, int dstOffset, int size); // Copy data between GPU buffers (no CPU round trip)
 
 // Textures management
 RLAPI unsigned int rlLoadTexture(void *data, int width, int height, int format, int mipmapCount); // Load texture in GPU
@@ -405,6 +626,9 @@ RLAPI void rlUnloadTexture(unsigned int id);                              // Unl
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format);              // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI void rlFlipScreenPixels(void *dst, const void *src, int width, int height); // Flip screen pixel data vertically and set alpha to 255 (dst can be src)
+RLAPI void rlReadScreenPixelsToBuffer(int width, int height, unsigned int pboId);    // Read screen pixel data into pixel buffer (asynchronous, not flipped)
+RLAPI void rlReadTexturePixelsToBuffer(unsigned int id, int format, unsigned int pboId); // Read texture pixel data into pixel buffer (asynchronous)
 
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(int width, int height);              // Load an empty framebuffer
@@ -417,12 +641,55 @@ RLAPI unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode);
 RLAPI unsigned int rlCompileShader(const char *shaderCode, int type);           // Compile custom shader and return shader id (type: RL_VERTEX_SHADER, RL_FRAGMENT_SHADER, RL_COMPUTE_SHADER)
 RLAPI unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId); // Load custom shader program
 RLAPI void rlUnloadShaderProgram(unsigned int id);                              // Unload shader program
+RLAPI void rlSetShaderCacheDirectory(const char *dirPath);                      // Set shader program binaries cache directory (NULL to disable), set it before rlglInit() to cache default shader
 RLAPI int rlGetLocationUniform(unsigned int shaderId, const char *uniformName); // Get shader location uniform
 RLAPI int rlGetLocationAttrib(unsigned int shaderId, const char *attribName);   // Get shader location attribute
 RLAPI void rlSetUniform(int locIndex, const void *value, int uniformType, int count);   // Set shader value uniform
 RLAPI void rlSetUniformMatrix(int locIndex, Matrix mat);                        // Set shader value matrix
 RLAPI void rlSetUniformSampler(int locIndex, unsigned int textureId);           // Set shader value sampler
 RLAPI void rlSetShader(unsigned int id, int *locs);                             // Set shader currently active (id and locations)
+RLAPI int rlGetLocationUniformBlock(unsigned int shaderId, const char *blockName, unsigned int binding); // Get shader uniform block index and assign it a binding point
+
+// Uniform buffers management
+// NOTE: rlgl keeps an internal uniform buffer with camera matrices (std140: mat4 matView, mat4 matProjection)
+// bound to RL_DEFAULT_CAMERA_UNIFORM_BINDING, shaders declaring that block get them without per-draw uploads
+RLAPI unsigned int rlLoadUniformBuffer(unsigned int size, const void *data, int usageHint); // Load uniform buffer object (UBO)
+RLAPI void rlUpdateUniformBuffer(unsigned int id, const void *data, unsigned int size, unsigned int offset); // Update uniform buffer object data
+RLAPI void rlBindUniformBuffer(unsigned int binding, unsigned int id);         // Bind uniform buffer object to a uniform block binding point
+RLAPI void rlUnloadUniformBuffer(unsigned int id);                              // Unload uniform buffer object
+RLAPI void rlSetCameraUniforms(Matrix view, Matrix projection);                 // Update internal camera matrices buffer (upload skipped if matrices did not change)
+
+// Compute shader management
+// NOTE: Compute program must be enabled with rlEnableShader() before dispatch, writes are visible
+// to following commands after rlMemoryBarrier() with the barriers matching the way data is used
+RLAPI unsigned int rlLoadComputeShaderProgram(unsigned int shaderId);         // Load compute shader program (shader compiled as RL_COMPUTE_SHADER, always deleted)
+RLAPI void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ); // Dispatch compute shader (equivalent to *draw* for graphics pipeline)
+RLAPI void rlMemoryBarrier(unsigned int barriers);                              // Set memory barrier for previous shader writes (RL_BARRIER_*)
+
+// Shader buffer storage object management (ssbo)
+// NOTE: SSBOs are regular GPU buffers, they can also be used as vertex buffers with rlEnableVertexBuffer()
+// and copied with rlCopyBufferData()
+RLAPI unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHint); // Load shader storage buffer object (SSBO)
+RLAPI void rlUnloadShaderBuffer(unsigned int ssboId);                           // Unload shader storage buffer object (SSBO)
+RLAPI void rlUpdateShaderBuffer(unsigned int id, const void *data, unsigned int dataSize, unsigned int offset); // Update SSBO buffer data
+RLAPI void rlBindShaderBuffer(unsigned int id, unsigned int index);             // Bind SSBO buffer to a shader storage binding point
+RLAPI void rlReadShaderBuffer(unsigned int id, void *dest, unsigned int count, unsigned int offset); // Read SSBO buffer data (GPU->CPU, waits for GPU)
+RLAPI unsigned int rlGetShaderBufferSize(unsigned int id);                      // Get SSBO buffer size
+
+// Image textures management
+RLAPI void rlBindImageTexture(unsigned int id, unsigned int index, int format, bool readonly); // Bind image texture to an image unit (compute shader image load/store)
+
+// Pixel buffers management (pbo) and sync objects
+// NOTE: Pixel transfers through pixel buffers are queued by the driver and do not block,
+// a fence inserted after the transfer tells when it has been completed by the GPU
+RLAPI unsigned int rlLoadPixelBuffer(int size, bool pack);                      // Load pixel buffer object (pack: GPU to CPU readback, otherwise CPU to GPU upload)
+RLAPI void *rlMapPixelBuffer(unsigned int id, int size, bool pack);             // Map pixel buffer data (upload: write-only, previous data discarded, readback: read-only)
+RLAPI void rlUnmapPixelBuffer(unsigned int id, bool pack);                      // Unmap pixel buffer data
+RLAPI void rlUnloadPixelBuffer(unsigned int id);                                // Unload pixel buffer object
+RLAPI void rlUpdateTextureFromPixelBuffer(unsigned int id, int offsetX, int offsetY, int width, int height, int format, unsigned int pboId); // Update GPU texture with pixel buffer data (asynchronous)
+RLAPI void *rlLoadFence(void);                                                  // Load fence sync object, signaled when previous GPU commands are completed
+RLAPI bool rlIsFenceSignaled(void *fence);                                      // Check if fence has been signaled (no wait)
+RLAPI void rlUnloadFence(void *fence);                                          // Unload fence sync object
 
 // Matrix state management
 RLAPI Matrix rlGetMatrixModelview(void);                                  // Get internal modelview matrix
@@ -14,6 +14,7 @@
 
 #define MAX_MATERIAL_MAPS               12      // Maximum number of shader maps supported
 #define MAX_MESH_VERTEX_BUFFERS          7      // Maximum vertex buffers (VBO) per mesh
+#define MODELS_BULK_VERTEX_COUNT        96      // Vertex generated on stack before submitting them with rlVertexBulk3f() (multiple of 6)
 
 #define TINYOBJ_MALLOC RL_MALLOC
 #define TINYOBJ_CALLOC RL_CALLOC
@@ -27,6 +28,53 @@
 #define PAR_CALLOC(T, N) ((T*)RL_CALLOC(N*sizeof(T), 1))
 #define PAR_REALLOC(T, BUF, N) ((T*)RL_REALLOC(BUF, sizeof(T)*(N)))
 
+#define MESH_ARENA_REMOVED      0xFFFFFFFF      // Mesh arena entry key of a removed mesh
+#define INSTANCE_TRANSFORMS_CHUNK       64      // Instance transforms converted and uploaded at once by UpdateInstanceBuffer()
+
+// Mesh arena entry, location of a mesh packed by DrawMeshList()
+typedef struct MeshArenaEntry {
+    unsigned int key;           // Mesh positions buffer id (0: empty, MESH_ARENA_REMOVED: removed mesh)
+    int baseVertex;             // First vertex of mesh data in arena buffers
+    int vertexCount;            // Number of mesh vertex
+    int firstIndex;             // First index of mesh data in arena index buffer
+    int indexCount;             // Number of mesh indices
+} MeshArenaEntry;
+
+// Mesh arena, meshes drawn with DrawMeshList() packed into shared vertex/index buffers
+typedef struct MeshArena {
+    unsigned int vaoId;                             // Arena vertex array
+    unsigned int vboId[MAX_MESH_VERTEX_BUFFERS];    // Arena buffers, same layout as mesh buffers (but 32 bit indices)
+    int vertexCount;            // Vertex packed (including removed meshes)
+    int vertexCapacity;         // Vertex capacity of arena buffers
+    int indexCount;             // Indices packed (including removed meshes)
+    int indexCapacity;          // Index capacity of arena index buffer
+    MeshArenaEntry *entries;    // Packed meshes hash table (open addressing, keyed by positions buffer id)
+    int entryCapacity;          // Hash table capacity (power of two)
+    int entryCount;             // Hash table used entries (including removed meshes)
+    int meshCount;              // Packed meshes not removed
+    int removedVertexCount;     // Vertex of removed meshes (arena space not used anymore)
+    int removedIndexCount;      // Indices of removed meshes (arena space not used anymore)
+    unsigned int transformsVboId;       // Per-draw transforms buffer (instanced attribute)
+    int transformsCapacity;             // Per-draw transforms buffer capacity
+    rlDrawElementsCommand *commands;    // Draw commands of current list
+    float16 *transforms;                // Per-draw transforms of current list
+    int commandCapacity;                // Draw commands/transforms arrays capacity
+} MeshArena;
+
+// NOTE: Mesh arena and internal instance buffer are only used on default rlgl context (vertex arrays are not shared
+// by OpenGL contexts), DrawMeshList() and DrawMeshInstanced() must be called from the thread rendering on it
+static MeshArena meshArena = { 0 };
+static const int meshVertexSizes[6] = { 3*sizeof(float), 2*sizeof(float), 3*sizeof(float), 4*sizeof(unsigned char), 4*sizeof(float), 2*sizeof(float) };   // Mesh vertex buffers element size
+
+static InstanceBuffer instancesBuffer = { 0 };      // Internal instance buffer used by DrawMeshInstanced(), grows on demand
+
+static MeshArenaEntry *PackMeshArena(Mesh mesh);    // Pack mesh data into mesh arena (if not already packed)
+static void UpdateMeshArena(Mesh mesh, int index, const void *data, int dataSize, int offset);  // Update mesh packed data in mesh arena (if packed)
+static void RemoveMeshArena(Mesh mesh);             // Remove mesh from mesh arena, packed data is not used anymore
+static void CompactMeshArena(void);                 // Compact mesh arena, packed data of removed meshes is discarded
+static size_t GetInstanceBufferOffset(InstanceBuffer buffer, int block);   // Get instance buffer data block offset (bytes)
+static void DrawMeshSoftware(Mesh mesh, Material material, Matrix transform);   // Draw mesh through render batch (software rasterizer)
+
 // Load OBJ mesh data
 // Keep the following information in mind when reading this
 //  - A mesh is created for every material present in the obj file
@@ -266,62 +314,65 @@ void DrawCube(Vector3 position, float width, float height, float length, Color c
         //rlRotatef(45, 0, 1, 0);
         //rlScalef(1.0f, 1.0f, 1.0f);   // NOTE: Vertices are directly scaled on definition
 
-        rlBegin(RL_TRIANGLES);
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
+        const float positions[36*3] = {
             // Front face
-            rlVertex3f(x - width/2, y - height/2, z + length/2);  // Bottom Left
-            rlVertex3f(x + width/2, y - height/2, z + length/2);  // Bottom Right
-            rlVertex3f(x - width/2, y + height/2, z + length/2);  // Top Left
+            x - width/2, y - height/2, z + length/2,    // Bottom Left
+            x + width/2, y - height/2, z + length/2,    // Bottom Right
+            x - width/2, y + height/2, z + length/2,    // Top Left
 
-            rlVertex3f(x + width/2, y + height/2, z + length/2);  // Top Right
-            rlVertex3f(x - width/2, y + height/2, z + length/2);  // Top Left
-            rlVertex3f(x + width/2, y - height/2, z + length/2);  // Bottom Right
+            x + width/2, y + height/2, z + length/2,    // Top Right
+            x - width/2, y + height/2, z + length/2,    // Top Left
+            x + width/2, y - height/2, z + length/2,    // Bottom Right
 
             // Back face
-            rlVertex3f(x - width/2, y - height/2, z - length/2);  // Bottom Left
-            rlVertex3f(x - width/2, y + height/2, z - length/2);  // Top Left
-            rlVertex3f(x + width/2, y - height/2, z - length/2);  // Bottom Right
+            x - width/2, y - height/2, z - length/2,    // Bottom Left
+            x - width/2, y + height/2, z - length/2,    // Top Left
+            x + width/2, y - height/2, z - length/2,    // Bottom Right
 
-            rlVertex3f(x + width/2, y + height/2, z - length/2);  // Top Right
-            rlVertex3f(x + width/2, y - height/2, z - length/2);  // Bottom Right
-            rlVertex3f(x - width/2, y + height/2, z - length/2);  // Top Left
+            x + width/2, y + height/2, z - length/2,    // Top Right
+            x + width/2, y - height/2, z - length/2,    // Bottom Right
+            x - width/2, y + height/2, z - length/2,    // Top Left
 
             // Top face
-            rlVertex3f(x - width/2, y + height/2, z - length/2);  // Top Left
-            rlVertex3f(x - width/2, y + height/2, z + length/2);  // Bottom Left
-            rlVertex3f(x + width/2, y + height/2, z + length/2);  // Bottom Right
+            x - width/2, y + height/2, z - length/2,    // Top Left
+            x - width/2, y + height/2, z + length/2,    // Bottom Left
+            x + width/2, y + height/2, z + length/2,    // Bottom Right
 
-            rlVertex3f(x + width/2, y + height/2, z - length/2);  // Top Right
-            rlVertex3f(x - width/2, y + height/2, z - length/2);  // Top Left
-            rlVertex3f(x + width/2, y + height/2, z + length/2);  // Bottom Right
+            x + width/2, y + height/2, z - length/2,    // Top Right
+            x - width/2, y + height/2, z - length/2,    // Top Left
+            x + width/2, y + height/2, z + length/2,    // Bottom Right
 
             // Bottom face
-            rlVertex3f(x - width/2, y - height/2, z - length/2);  // Top Left
-            rlVertex3f(x + width/2, y - height/2, z + length/2);  // Bottom Right
-            rlVertex3f(x - width/2, y - height/2, z + length/2);  // Bottom Left
+            x - width/2, y - height/2, z - length/2,    // Top Left
+            x + width/2, y - height/2, z + length/2,    // Bottom Right
+            x - width/2, y - height/2, z + length/2,    // Bottom Left
 
-            rlVertex3f(x + width/2, y - height/2, z - length/2);  // Top Right
-            rlVertex3f(x + width/2, y - height/2, z + length/2);  // Bottom Right
-            rlVertex3f(x - width/2, y - height/2, z - length/2);  // Top Left
+            x + width/2, y - height/2, z - length/2,    // Top Right
+            x + width/2, y - height/2, z + length/2,    // Bottom Right
+            x - width/2, y - height/2, z - length/2,    // Top Left
 
             // Right face
-            rlVertex3f(x + width/2, y - height/2, z - length/2);  // Bottom Right
-            rlVertex3f(x + width/2, y + height/2, z - length/2);  // Top Right
-            rlVertex3f(x + width/2, y + height/2, z + length/2);  // Top Left
+            x + width/2, y - height/2, z - length/2,    // Bottom Right
+            x + width/2, y + height/2, z - length/2,    // Top Right
+            x + width/2, y + height/2, z + length/2,    // Top Left
 
-            rlVertex3f(x + width/2, y - height/2, z + length/2);  // Bottom Left
-            rlVertex3f(x + width/2, y - height/2, z - length/2);  // Bottom Right
-            rlVertex3f(x + width/2, y + height/2, z + length/2);  // Top Left
+            x + width/2, y - height/2, z + length/2,    // Bottom Left
+            x + width/2, y - height/2, z - length/2,    // Bottom Right
+            x + width/2, y + height/2, z + length/2,    // Top Left
 
             // Left face
-            rlVertex3f(x - width/2, y - height/2, z - length/2);  // Bottom Right
-            rlVertex3f(x - width/2, y + height/2, z + length/2);  // Top Left
-            rlVertex3f(x - width/2, y + height/2, z - length/2);  // Top Right
+            x - width/2, y - height/2, z - length/2,    // Bottom Right
+            x - width/2, y + height/2, z + length/2,    // Top Left
+            x - width/2, y + height/2, z - length/2,    // Top Right
+
+            x - width/2, y - height/2, z + length/2,    // Bottom Left
+            x - width/2, y + height/2, z + length/2,    // Top Left
+            x - width/2, y - height/2, z - length/2     // Bottom Right
+        };
 
-            rlVertex3f(x - width/2, y - height/2, z + length/2);  // Bottom Left
-            rlVertex3f(x - width/2, y + height/2, z + length/2);  // Top Left
-            rlVertex3f(x - width/2, y - height/2, z - length/2);  // Bottom Right
+        rlBegin(RL_TRIANGLES);
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            rlVertexBulk3f(positions, NULL, NULL, 36);
         rlEnd();
     rlPopMatrix();
 }
@@ -574,34 +625,50 @@ void DrawSphereEx(Vector3 centerPos, float radius, int rings, int slices, Color
         rlTranslatef(centerPos.x, centerPos.y, centerPos.z);
         rlScalef(radius, radius, radius);
 
+        float positions[MODELS_BULK_VERTEX_COUNT*3] = { 0 };
+        int count = 0;
+
         rlBegin(RL_TRIANGLES);
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             for (int i = 0; i < (rings + 2); i++)
             {
+                // Ring latitudes (current and next)
+                float cosLat0 = cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*i));
+                float sinLat0 = sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*i));
+                float cosLat1 = cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)));
+                float sinLat1 = sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)));
+
                 for (int j = 0; j < slices; j++)
                 {
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*i))*sinf(DEG2RAD*(360.0f*j/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*i)),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*i))*cosf(DEG2RAD*(360.0f*j/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*sinf(DEG2RAD*(360.0f*(j + 1)/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1))),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*cosf(DEG2RAD*(360.0f*(j + 1)/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*sinf(DEG2RAD*(360.0f*j/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1))),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*cosf(DEG2RAD*(360.0f*j/slices)));
-
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*i))*sinf(DEG2RAD*(360.0f*j/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*i)),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*i))*cosf(DEG2RAD*(360.0f*j/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i)))*sinf(DEG2RAD*(360.0f*(j + 1)/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i))),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i)))*cosf(DEG2RAD*(360.0f*(j + 1)/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*sinf(DEG2RAD*(360.0f*(j + 1)/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1))),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*cosf(DEG2RAD*(360.0f*(j + 1)/slices)));
+                    // Slice longitudes (current and next)
+                    float sinLon0 = sinf(DEG2RAD*(360.0f*j/slices));
+                    float cosLon0 = cosf(DEG2RAD*(360.0f*j/slices));
+                    float sinLon1 = sinf(DEG2RAD*(360.0f*(j + 1)/slices));
+                    float cosLon1 = cosf(DEG2RAD*(360.0f*(j + 1)/slices));
+
+                    const float quad[6*3] = {
+                        cosLat0*sinLon0, sinLat0, cosLat0*cosLon0,
+                        cosLat1*sinLon1, sinLat1, cosLat1*cosLon1,
+                        cosLat1*sinLon0, sinLat1, cosLat1*cosLon0,
+
+                        cosLat0*sinLon0, sinLat0, cosLat0*cosLon0,
+                        cosLat0*sinLon1, sinLat0, cosLat0*cosLon1,
+                        cosLat1*sinLon1, sinLat1, cosLat1*cosLon1
+                    };
+
+                    memcpy(&positions[3*count], quad, sizeof(quad));
+                    count += 6;
+
+                    if (count == MODELS_BULK_VERTEX_COUNT)
+                    {
+                        rlVertexBulk3f(positions, NULL, NULL, count);
+                        count = 0;
+                    }
                 }
             }
+
+            if (count > 0) rlVertexBulk3f(positions, NULL, NULL, count);
         rlEnd();
     rlPopMatrix();
 }
@@ -861,14 +928,17 @@ void DrawPlane(Vector3 centerPos, Vector2 size, Color color)
         rlTranslatef(centerPos.x, centerPos.y, centerPos.z);
         rlScalef(size.x, 1.0f, size.y);
 
+        const float positions[4*3] = {
+            -0.5f, 0.0f, -0.5f,
+            -0.5f, 0.0f, 0.5f,
+            0.5f, 0.0f, 0.5f,
+            0.5f, 0.0f, -0.5f
+        };
+
         rlBegin(RL_QUADS);
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlNormal3f(0.0f, 1.0f, 0.0f);
-
-            rlVertex3f(-0.5f, 0.0f, -0.5f);
-            rlVertex3f(-0.5f, 0.0f, 0.5f);
-            rlVertex3f(0.5f, 0.0f, 0.5f);
-            rlVertex3f(0.5f, 0.0f, -0.5f);
+            rlVertexBulk3f(positions, NULL, NULL, 4);
         rlEnd();
     rlPopMatrix();
 }
@@ -883,26 +953,19 @@ void DrawGrid(int slices, float spacing)
     rlBegin(RL_LINES);
         for (int i = -halfSlices; i <= halfSlices; i++)
         {
-            if (i == 0)
-            {
-                rlColor3f(0.5f, 0.5f, 0.5f);
-                rlColor3f(0.5f, 0.5f, 0.5f);
-                rlColor3f(0.5f, 0.5f, 0.5f);
-                rlColor3f(0.5f, 0.5f, 0.5f);
-            }
-            else
-            {
-                rlColor3f(0.75f, 0.75f, 0.75f);
-                rlColor3f(0.75f, 0.75f, 0.75f);
-                rlColor3f(0.75f, 0.75f, 0.75f);
-                rlColor3f(0.75f, 0.75f, 0.75f);
-            }
+            // NOTE: Center lines are darker
+            if (i == 0) rlColor3f(0.5f, 0.5f, 0.5f);
+            else rlColor3f(0.75f, 0.75f, 0.75f);
 
-            rlVertex3f((float)i*spacing, 0.0f, (float)-halfSlices*spacing);
-            rlVertex3f((float)i*spacing, 0.0f, (float)halfSlices*spacing);
+            const float positions[4*3] = {
+                (float)i*spacing, 0.0f, (float)-halfSlices*spacing,
+                (float)i*spacing, 0.0f, (float)halfSlices*spacing,
 
-            rlVertex3f((float)-halfSlices*spacing, 0.0f, (float)i*spacing);
-            rlVertex3f((float)halfSlices*spacing, 0.0f, (float)i*spacing);
+                (float)-halfSlices*spacing, 0.0f, (float)i*spacing,
+                (float)halfSlices*spacing, 0.0f, (float)i*spacing
+            };
+
+            rlVertexBulk3f(positions, NULL, NULL, 4);
         }
     rlEnd();
 }
@@ -1071,11 +1134,80 @@ void UploadMesh(Mesh *mesh, bool dynamic)
 void UpdateMeshBuffer(Mesh mesh, int index, void *data, int dataSize, int offset)
 {
     rlUpdateVertexBuffer(mesh.vboId[index], data, dataSize, offset);
+    UpdateMeshArena(mesh, index, data, dataSize, offset);      // Packed data updated in place (if packed)
+}
+
+// Load instance buffer, per-instance data for instanced drawing stored in VRAM (GPU)
+// NOTE: Data is stored by blocks: transforms, colors (if INSTANCE_DATA_COLOR) and custom data (if INSTANCE_DATA_CUSTOM),
+// colors are initialized to WHITE and custom data to zero
+InstanceBuffer LoadInstanceBuffer(int capacity, int flags)
+{
+    InstanceBuffer buffer = { 0 };
+    if (capacity <= 0) return buffer;
+
+    buffer.capacity = capacity;
+    buffer.flags = flags;
+
+    int size = GetInstanceBufferOffset(buffer, INSTANCE_DATA_CUSTOM << 1);
+    unsigned char *data = (unsigned char *)RL_CALLOC(size, 1);
+    if (flags & INSTANCE_DATA_COLOR) memset(data + GetInstanceBufferOffset(buffer, INSTANCE_DATA_COLOR), 255, capacity*sizeof(Color));
+    buffer.vboId = rlLoadVertexBuffer(data, size, true);
+    rlDisableVertexBuffer();
+    RL_FREE(data);
+
+    if (buffer.vboId > 0) TRACELOG(LOG_INFO, "VBO: [ID %i] Instance buffer loaded successfully (%i instances)", buffer.vboId, capacity);
+    else TRACELOG(LOG_WARNING, "VBO: Failed to load instance buffer");
+
+    return buffer;
+}
+
+// Update instance buffer data for a range of instances, NULL data is not updated
+// NOTE: Updating all the instances with all the data of the buffer layout orphans the buffer:
+// previous data is discarded (it is fully replaced) so there is no wait for the GPU
+void UpdateInstanceBuffer(InstanceBuffer buffer, const Matrix *transforms, const Color *colors, const Vector4 *custom, int offset, int count)
+{
+    if ((buffer.vboId == 0) || (offset < 0) || (count <= 0)) return;
+    if ((offset + count) > buffer.capacity) count = buffer.capacity - offset;
+    if (count <= 0) return;
+
+    bool orphan = (offset == 0) && (count == buffer.capacity) && (transforms != NULL) &&
+                  (!(buffer.flags & INSTANCE_DATA_COLOR) || (colors != NULL)) &&
+                  (!(buffer.flags & INSTANCE_DATA_CUSTOM) || (custom != NULL));
+    if (orphan) rlOrphanVertexBuffer(buffer.vboId, GetInstanceBufferOffset(buffer, INSTANCE_DATA_CUSTOM << 1));
+
+    if (transforms != NULL) {
+        // Transforms are converted to float16 arrays (column-major) by chunks on the stack, no shared state
+        float16 chunk[INSTANCE_TRANSFORMS_CHUNK];
+        for (int first = 0; first < count; first += INSTANCE_TRANSFORMS_CHUNK) {
+            int chunkCount = ((count - first) < INSTANCE_TRANSFORMS_CHUNK)? (count - first) : INSTANCE_TRANSFORMS_CHUNK;
+            for (int i = 0; i < chunkCount; i++) chunk[i] = MatrixToFloatV(transforms[first + i]);
+            rlUpdateVertexBuffer(buffer.vboId, chunk, chunkCount*sizeof(float16), (offset + first)*sizeof(float16));
+        }
+    }
+    if ((colors != NULL) && (buffer.flags & INSTANCE_DATA_COLOR))
+        rlUpdateVertexBuffer(buffer.vboId, (void *)colors, count*sizeof(Color), GetInstanceBufferOffset(buffer, INSTANCE_DATA_COLOR) + offset*sizeof(Color));
+    if ((custom != NULL) && (buffer.flags & INSTANCE_DATA_CUSTOM))
+        rlUpdateVertexBuffer(buffer.vboId, (void *)custom, count*sizeof(Vector4), GetInstanceBufferOffset(buffer, INSTANCE_DATA_CUSTOM) + offset*sizeof(Vector4));
+}
+
+// Unload instance buffer from VRAM (GPU)
+void UnloadInstanceBuffer(InstanceBuffer buffer)
+{
+    if (buffer.vboId > 0) rlUnloadVertexBuffer(buffer.vboId);
 }
 
 // Draw a 3d mesh with material and transform
 void DrawMesh(Mesh mesh, Material material, Matrix transform)
 {
+    // Software rasterizer does not use mesh buffers, mesh triangles are submitted through render batch
+    if (rlIsSoftwareRenderEnabled())
+    {
+        DrawMeshSoftware(mesh, material, transform);
+        return;
+    }
+
+    rlBeginGpuZone("DrawMesh");     // Measure mesh GPU time (if GPU profiling zones enabled)
+
     // Bind shader program
     rlEnableShader(material.shader.id);
 
@@ -1114,10 +1246,11 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
     // that modifies it, all use rlPushMatrix() and rlPopMatrix()
     Matrix matModel = MatrixIdentity();
     Matrix matView = rlGetMatrixModelview();
-    Matrix matModelView = MatrixIdentity();
     Matrix matProjection = rlGetMatrixProjection();
 
     // Upload view and projection matrices (if locations available)
+    // NOTE: Shaders declaring the camera uniform block get them from the camera matrices buffer,
+    // uploaded once on BeginMode3D(), only model related matrices are sent on every draw
     if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
     if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
 
@@ -1129,10 +1262,8 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
     //    rlGetMatrixTransform(): rlgl internal transform matrix due to push/pop matrix stack
     matModel = MatrixMultiply(transform, rlGetMatrixTransform());
 
-    // Get model-view matrix
-    matModelView = MatrixMultiply(matModel, matView);
-
     // Upload model normal matrix (if locations available)
+    // NOTE: Matrix inversion is only computed for shaders using it
     if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
     //-----------------------------------------------------
 
@@ -1219,18 +1350,26 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
 
     for (int eye = 0; eye < eyeCount; eye++)
     {
-        // Calculate model-view-projection matrix (MVP)
-        Matrix matModelViewProjection = MatrixIdentity();
-        if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
-        else
+        Matrix matEyeView = matView;
+        Matrix matEyeProjection = matProjection;
+
+        if (eyeCount > 1)
         {
             // Setup current eye viewport (half screen width)
             rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
-            matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+            matEyeView = MatrixMultiply(matView, rlGetMatrixViewOffsetStereo(eye));
+            matEyeProjection = rlGetMatrixProjectionStereo(eye);
         }
 
-        // Send combined model-view-projection matrix to shader
-        rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+        // Update camera uniform block matrices (only uploaded if they changed)
+        if (material.shader.locs[SHADER_LOC_BLOCK_CAMERA] != -1) rlSetCameraUniforms(matEyeView, matEyeProjection);
+
+        // Calculate model-view-projection matrix (MVP) and send it to shader (if location available)
+        if (material.shader.locs[SHADER_LOC_MATRIX_MVP] != -1)
+        {
+            Matrix matModelViewProjection = MatrixMultiply(MatrixMultiply(matModel, matEyeView), matEyeProjection);
+            rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+        }
 
         // Draw mesh
         if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, 0);
@@ -1240,6 +1379,9 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
     // Unbind all binded texture maps
     for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
     {
+        // Only slots binded above require unbinding
+        if (material.maps[i].texture.id <= 0) continue;
+
         // Select current shader texture slot
         rlActiveTextureSlot(i);
 
@@ -1261,14 +1403,38 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
     // Restore rlgl internal modelview and projection matrices
     rlSetMatrixModelview(matView);
     rlSetMatrixProjection(matProjection);
+
+    rlEndGpuZone();
 }
 
 // Draw multiple mesh instances with material and different transforms
+// NOTE: Transforms are uploaded to an internal instance buffer, only reallocated when it has to grow,
+// internal buffer is shared by all calls, it is only available on default rlgl context (not reentrant)
 void DrawMeshInstanced(Mesh mesh, Material material, Matrix *transforms, int instances)
 {
-    // Instancing required variables
-    float16 *instanceTransforms = NULL;
-    unsigned int instancesVboId = 0;
+    if (instances <= 0) return;
+    if (rlGetCurrentContext() != rlGetDefaultContext())
+    {
+        TRACELOG(LOG_WARNING, "MESH: Instanced drawing internal buffer only available on default rlgl context, use DrawMeshInstancedBuffer()");
+        return;
+    }
+
+    if (instancesBuffer.capacity < instances) {
+        if (instancesBuffer.vboId != 0) UnloadInstanceBuffer(instancesBuffer);
+        instancesBuffer = LoadInstanceBuffer((instances > 2*instancesBuffer.capacity)? instances : 2*instancesBuffer.capacity, 0);
+    }
+    // Only the first instances are drawn, previous data can be discarded: orphan the buffer so there is no wait for the GPU
+    rlOrphanVertexBuffer(instancesBuffer.vboId, GetInstanceBufferOffset(instancesBuffer, INSTANCE_DATA_CUSTOM << 1));
+    UpdateInstanceBuffer(instancesBuffer, transforms, NULL, NULL, 0, instances);
+    DrawMeshInstancedBuffer(mesh, material, instancesBuffer, instances);
+}
+
+// Draw multiple mesh instances with material and instances data from instance buffer
+// NOTE: Instance transforms are send to shader attribute location SHADER_LOC_MATRIX_MODEL,
+// colors and custom data (if available) to SHADER_LOC_INSTANCE_COLOR and SHADER_LOC_INSTANCE_CUSTOM
+void DrawMeshInstancedBuffer(Mesh mesh, Material material, InstanceBuffer buffer, int instances)
+{
+    if (instances > buffer.capacity) instances = buffer.capacity;
     // Bind shader program
     rlEnableShader(material.shader.id);
     // Send required data to shader (matrices, values)
@@ -1301,25 +1467,29 @@ void DrawMeshInstanced(Mesh mesh, Material material, Matrix *transforms, int ins
     Matrix matModelView = MatrixIdentity();
     Matrix matProjection = rlGetMatrixProjection();
     // Upload view and projection matrices (if locations available)
+    // NOTE: Shaders declaring the camera uniform block get them from the camera matrices buffer
     if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
     if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
-    // Create instances buffer
-    instanceTransforms = (float16 *)RL_MALLOC(instances*sizeof(float16));
-    // Fill buffer with instances transformations as float16 arrays
-    for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
-    // Enable mesh VAO to attach new buffer
+    // Enable mesh VAO to attach instance buffer
     rlEnableVertexArray(mesh.vaoId);
-    // This could alternatively use a static VBO and either glMapBuffer() or glBufferSubData().
-    // It isn't clear which would be reliably faster in all cases and on all platforms,
-    // anecdotally glMapBuffer() seems very slow (syncs) while glBufferSubData() seems
-    // no faster, since we're transferring all the transform matrices anyway
-    instancesVboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(float16), false);
+    rlEnableVertexBuffer(buffer.vboId);
     // Instances transformation matrices are send to shader attribute location: SHADER_LOC_MATRIX_MODEL
     for (unsigned int i = 0; i < 4; i++) {
         rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i);
         rlSetVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 4, RL_FLOAT, 0, sizeof(Matrix), (void *)(i*sizeof(Vector4)));
         rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 1);
     }
+    // Instances colors and custom data are stored after transforms (if available)
+    if ((buffer.flags & INSTANCE_DATA_COLOR) && (material.shader.locs[SHADER_LOC_INSTANCE_COLOR] != -1)) {
+        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_INSTANCE_COLOR]);
+        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_INSTANCE_COLOR], 4, RL_UNSIGNED_BYTE, 1, 0, (void *)GetInstanceBufferOffset(buffer, INSTANCE_DATA_COLOR));
+        rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_INSTANCE_COLOR], 1);
+    }
+    if ((buffer.flags & INSTANCE_DATA_CUSTOM) && (material.shader.locs[SHADER_LOC_INSTANCE_CUSTOM] != -1)) {
+        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_INSTANCE_CUSTOM]);
+        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_INSTANCE_CUSTOM], 4, RL_FLOAT, 0, 0, (void *)GetInstanceBufferOffset(buffer, INSTANCE_DATA_CUSTOM));
+        rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_INSTANCE_CUSTOM], 1);
+    }
     rlDisableVertexBuffer();
     rlDisableVertexArray();
     // Accumulate internal matrix transform (push/pop) and view matrix
@@ -1389,20 +1559,203 @@ void DrawMeshInstanced(Mesh mesh, Material material, Matrix *transforms, int ins
     for (int eye = 0; eye < eyeCount; eye++) {
         // Calculate model-view-projection matrix (MVP)
         Matrix matModelViewProjection = MatrixIdentity();
-        if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
+        if (eyeCount == 1) {
+            matModelViewProjection = MatrixMultiply(matModelView, matProjection);
+            // Update camera uniform block matrices (only uploaded if they changed)
+            if (material.shader.locs[SHADER_LOC_BLOCK_CAMERA] != -1) rlSetCameraUniforms(matView, matProjection);
+        }
         else {
             // Setup current eye viewport (half screen width)
             rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
             matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+            if (material.shader.locs[SHADER_LOC_BLOCK_CAMERA] != -1)
+                rlSetCameraUniforms(MatrixMultiply(matView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
         }
         // Send combined model-view-projection matrix to shader
-        rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+        if (material.shader.locs[SHADER_LOC_MATRIX_MVP] != -1)
+            rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
         // Draw mesh instanced
         if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, instances);
         else rlDrawVertexArrayInstanced(0, mesh.vertexCount, instances);
     }
     // Unbind all binded texture maps
     for (int i = 0; i < MAX_MATERIAL_MAPS; i++) {
+        // Only slots binded above require unbinding
+        if (material.maps[i].texture.id <= 0) continue;
+        // Select current shader texture slot
+        rlActiveTextureSlot(i);
+        // Disable texture for active slot
+        if ((i == MATERIAL_MAP_IRRADIANCE) || (i == MATERIAL_MAP_PREFILTER) || (i == MATERIAL_MAP_CUBEMAP))
+            rlDisableTextureCubemap();
+        else rlDisableTexture();
+    }
+    // Disable all possible vertex array objects (or VBOs)
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+    // Disable shader program
+    rlDisableShader();
+}
+
+// Draw multiple meshes with material and different transforms
+// NOTE: Meshes are packed into shared arena buffers on first use and drawn with a single indirect draw
+// (if supported), like DrawMeshInstanced(), shader reads transforms from an instanced attribute at
+// SHADER_LOC_MATRIX_MODEL, shaders without it draw every mesh with DrawMesh(),
+// mesh arena is only available on default rlgl context (not reentrant)
+void DrawMeshList(Mesh *meshes, Material material, Matrix *transforms, int count)
+{
+    if (count <= 0) return;
+    if (rlGetCurrentContext() != rlGetDefaultContext())
+    {
+        TRACELOG(LOG_WARNING, "MESH: Mesh list drawing only available on default rlgl context");
+        return;
+    }
+
+    if (material.shader.locs[SHADER_LOC_MATRIX_MODEL] == -1)
+    {
+        for (int i = 0; i < count; i++) DrawMesh(meshes[i], material, transforms[i]);
+        return;
+    }
+
+    // Discard removed meshes data once it is more than half of the arena,
+    // packed meshes are moved so it must be done before filling draw commands
+    if ((meshArena.removedVertexCount > meshArena.vertexCount/2) || (meshArena.removedIndexCount > meshArena.indexCount/2)) CompactMeshArena();
+
+    // Pack meshes (if required) and fill draw commands and per-draw transforms
+    if (meshArena.commandCapacity < count)
+    {
+        meshArena.commandCapacity = (count > 2*meshArena.commandCapacity)? count : 2*meshArena.commandCapacity;
+        meshArena.commands = (rlDrawElementsCommand *)RL_REALLOC(meshArena.commands, meshArena.commandCapacity*sizeof(rlDrawElementsCommand));
+        meshArena.transforms = (float16 *)RL_REALLOC(meshArena.transforms, meshArena.commandCapacity*sizeof(float16));
+    }
+
+    int drawCount = 0;
+    for (int i = 0; i < count; i++)
+    {
+        MeshArenaEntry *entry = PackMeshArena(meshes[i]);
+        if (entry == NULL) continue;
+
+        meshArena.commands[drawCount].count = entry->indexCount;
+        meshArena.commands[drawCount].instanceCount = 1;
+        meshArena.commands[drawCount].firstIndex = entry->firstIndex;
+        meshArena.commands[drawCount].baseVertex = entry->baseVertex;
+        meshArena.commands[drawCount].baseInstance = drawCount;
+        meshArena.transforms[drawCount] = MatrixToFloatV(transforms[i]);
+        drawCount++;
+    }
+
+    if (drawCount == 0) return;
+
+    if (meshArena.transformsCapacity < drawCount)
+    {
+        if (meshArena.transformsVboId != 0) rlUnloadVertexBuffer(meshArena.transformsVboId);
+        meshArena.transformsCapacity = (drawCount > 2*meshArena.transformsCapacity)? drawCount : 2*meshArena.transformsCapacity;
+        meshArena.transformsVboId = rlLoadVertexBuffer(NULL, meshArena.transformsCapacity*sizeof(float16), true);
+    }
+    rlUpdateVertexBuffer(meshArena.transformsVboId, meshArena.transforms, drawCount*sizeof(float16), 0);
+
+    // Bind shader program
+    rlEnableShader(material.shader.id);
+    // Upload to shader material.colDiffuse
+    if (material.shader.locs[SHADER_LOC_COLOR_DIFFUSE] != -1) {
+        float values[4] = {
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.r/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.g/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.b/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.a/255.0f
+        };
+        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_DIFFUSE], values, SHADER_UNIFORM_VEC4, 1);
+    }
+    // Upload to shader material.colSpecular (if location available)
+    if (material.shader.locs[SHADER_LOC_COLOR_SPECULAR] != -1) {
+        float values[4] = {
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.r/255.0f,
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.g/255.0f,
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.b/255.0f,
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.a/255.0f};
+        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_SPECULAR], values, SHADER_UNIFORM_VEC4, 1);
+    }
+    // Upload view and projection matrices (if locations available)
+    Matrix matView = rlGetMatrixModelview();
+    Matrix matProjection = rlGetMatrixProjection();
+    if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
+    if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
+    // Accumulate internal matrix transform (push/pop) and view matrix
+    // NOTE: As in DrawMeshInstanced(), per-draw transformation must be computed in the shader
+    Matrix matModelView = MatrixMultiply(rlGetMatrixTransform(), matView);
+    // Upload model normal matrix (if locations available)
+    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1)
+        rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixIdentity());
+    // Bind active texture maps (if available)
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++) {
+        if (material.maps[i].texture.id <= 0) continue;
+        // Select current shader texture slot
+        rlActiveTextureSlot(i);
+        // Enable texture for active slot
+        if ((i == MATERIAL_MAP_IRRADIANCE) || (i == MATERIAL_MAP_PREFILTER) || (i == MATERIAL_MAP_CUBEMAP))
+            rlEnableTextureCubemap(material.maps[i].texture.id);
+        else rlEnableTexture(material.maps[i].texture.id);
+        rlSetUniform(material.shader.locs[SHADER_LOC_MAP_DIFFUSE + i], &i, SHADER_UNIFORM_INT, 1);
+    }
+
+    // Bind arena buffers to shader attributes, arena buffers could have been reallocated on packing
+    const int attribLocs[6] = { SHADER_LOC_VERTEX_POSITION, SHADER_LOC_VERTEX_TEXCOORD01, SHADER_LOC_VERTEX_NORMAL,
+                                SHADER_LOC_VERTEX_COLOR, SHADER_LOC_VERTEX_TANGENT, SHADER_LOC_VERTEX_TEXCOORD02 };
+    const int attribSizes[6] = { 3, 2, 3, 4, 4, 2 };
+    rlEnableVertexArray(meshArena.vaoId);
+    for (int k = 0; k < 6; k++) {
+        int loc = material.shader.locs[attribLocs[k]];
+        if (loc == -1) continue;
+        rlEnableVertexBuffer(meshArena.vboId[k]);
+        if (k == 3) rlSetVertexAttribute(loc, 4, RL_UNSIGNED_BYTE, 1, 0, 0);
+        else rlSetVertexAttribute(loc, attribSizes[k], RL_FLOAT, 0, 0, 0);
+        rlSetVertexAttributeDivisor(loc, 0);
+        rlEnableVertexAttribute(loc);
+    }
+    // Per-draw transformation matrices are send to shader attribute location: SHADER_LOC_MATRIX_MODEL
+    rlEnableVertexBuffer(meshArena.transformsVboId);
+    for (unsigned int i = 0; i < 4; i++) {
+        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i);
+        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 4, RL_FLOAT, 0, sizeof(Matrix), (void *)(i*sizeof(Vector4)));
+        rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 1);
+    }
+    rlEnableVertexBufferElement(meshArena.vboId[6]);
+
+    int eyeCount = 1;
+    if (rlIsStereoRenderEnabled()) eyeCount = 2;
+    for (int eye = 0; eye < eyeCount; eye++) {
+        // Calculate model-view-projection matrix (MVP)
+        Matrix matModelViewProjection = MatrixIdentity();
+        if (eyeCount == 1) {
+            matModelViewProjection = MatrixMultiply(matModelView, matProjection);
+            // Update camera uniform block matrices (only uploaded if they changed)
+            if (material.shader.locs[SHADER_LOC_BLOCK_CAMERA] != -1) rlSetCameraUniforms(matView, matProjection);
+        }
+        else {
+            // Setup current eye viewport (half screen width)
+            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+            matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+            if (material.shader.locs[SHADER_LOC_BLOCK_CAMERA] != -1)
+                rlSetCameraUniforms(MatrixMultiply(matView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+        }
+        // Send combined model-view-projection matrix to shader
+        if (material.shader.locs[SHADER_LOC_MATRIX_MVP] != -1)
+            rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+        // Draw meshes, a single indirect draw if supported
+        if (rlIsDrawBaseInstanceSupported()) rlDrawVertexArrayElementsMulti(meshArena.commands, drawCount);
+        else {
+            // No base instance support: transforms attribute is offset to every draw transform
+            for (int i = 0; i < drawCount; i++) {
+                for (unsigned int k = 0; k < 4; k++)
+                    rlSetVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + k, 4, RL_FLOAT, 0, sizeof(Matrix), (void *)(i*sizeof(Matrix) + k*sizeof(Vector4)));
+                rlDrawVertexArrayElementsMulti(&meshArena.commands[i], 1);
+            }
+        }
+    }
+    // Unbind all binded texture maps
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++) {
+        // Only slots binded above require unbinding
+        if (material.maps[i].texture.id <= 0) continue;
         // Select current shader texture slot
         rlActiveTextureSlot(i);
         // Disable texture for active slot
@@ -1416,14 +1769,262 @@ void DrawMeshInstanced(Mesh mesh, Material material, Matrix *transforms, int ins
     rlDisableVertexBufferElement();
     // Disable shader program
     rlDisableShader();
-    // Remove instance transforms buffer
-    rlUnloadVertexBuffer(instancesVboId);
-    RL_FREE(instanceTransforms);
+}
+
+// Find mesh arena hash table entry for a key, empty entry if not found (insertion point)
+static MeshArenaEntry *FindMeshArenaEntry(unsigned int key)
+{
+    unsigned int mask = meshArena.entryCapacity - 1;
+    unsigned int i = (key*2654435761u) & mask;     // Multiplicative hashing (Knuth)
+    MeshArenaEntry *removed = NULL;
+
+    while (meshArena.entries[i].key != 0)
+    {
+        if (meshArena.entries[i].key == key) return &meshArena.entries[i];
+        if ((meshArena.entries[i].key == MESH_ARENA_REMOVED) && (removed == NULL)) removed = &meshArena.entries[i];
+        i = (i + 1) & mask;
+    }
+
+    return (removed != NULL)? removed : &meshArena.entries[i];
+}
+
+// Pack mesh data into mesh arena (if not already packed)
+// NOTE: Vertex data is copied from mesh buffers on GPU side, indices are converted to 32 bit on CPU side
+static MeshArenaEntry *PackMeshArena(Mesh mesh)
+{
+    if ((mesh.vboId == NULL) || (mesh.vboId[0] == 0)) return NULL;
+
+    // Grow hash table (load factor kept under 0.5, removed entries are discarded)
+    if (2*(meshArena.entryCount + 1) > meshArena.entryCapacity)
+    {
+        MeshArenaEntry *entries = meshArena.entries;
+        int capacity = meshArena.entryCapacity;
+
+        meshArena.entryCapacity = (capacity == 0)? 256 : 2*capacity;
+        meshArena.entries = (MeshArenaEntry *)RL_CALLOC(meshArena.entryCapacity, sizeof(MeshArenaEntry));
+        meshArena.entryCount = 0;
+
+        for (int i = 0; i < capacity; i++)
+        {
+            if ((entries[i].key == 0) || (entries[i].key == MESH_ARENA_REMOVED)) continue;
+            *FindMeshArenaEntry(entries[i].key) = entries[i];
+            meshArena.entryCount++;
+        }
+
+        RL_FREE(entries);
+    }
+
+    MeshArenaEntry *entry = FindMeshArenaEntry(mesh.vboId[0]);
+    if (entry->key == mesh.vboId[0]) return entry;
+
+    if ((mesh.indices == NULL) && (mesh.vboId[6] != 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Indices not available in RAM, mesh can not be packed for list drawing");
+        return NULL;
+    }
+
+    int indexCount = (mesh.indices != NULL)? mesh.triangleCount*3 : mesh.vertexCount;
+
+    // Grow arena buffers (if required), packed data is copied on GPU side
+    if (meshArena.vaoId == 0) meshArena.vaoId = rlLoadVertexArray();
+
+    if ((meshArena.vertexCount + mesh.vertexCount) > meshArena.vertexCapacity)
+    {
+        int capacity = 2*meshArena.vertexCapacity;
+        if (capacity < (meshArena.vertexCount + mesh.vertexCount)) capacity = meshArena.vertexCount + mesh.vertexCount;
+        if (capacity < 4096) capacity = 4096;
+
+        for (int k = 0; k < 6; k++)
+        {
+            unsigned int vboId = rlLoadVertexBuffer(NULL, capacity*meshVertexSizes[k], false);
+            if (meshArena.vertexCount > 0) rlCopyBufferData(meshArena.vboId[k], vboId, 0, 0, meshArena.vertexCount*meshVertexSizes[k]);
+            if (meshArena.vboId[k] != 0) rlUnloadVertexBuffer(meshArena.vboId[k]);
+            meshArena.vboId[k] = vboId;
+        }
+
+        meshArena.vertexCapacity = capacity;
+    }
+
+    if ((meshArena.indexCount + indexCount) > meshArena.indexCapacity)
+    {
+        int capacity = 2*meshArena.indexCapacity;
+        if (capacity < (meshArena.indexCount + indexCount)) capacity = meshArena.indexCount + indexCount;
+        if (capacity < 4096) capacity = 4096;
+
+        unsigned int vboId = rlLoadVertexBuffer(NULL, capacity*sizeof(unsigned int), false);
+        if (meshArena.indexCount > 0) rlCopyBufferData(meshArena.vboId[6], vboId, 0, 0, meshArena.indexCount*sizeof(unsigned int));
+        if (meshArena.vboId[6] != 0) rlUnloadVertexBuffer(meshArena.vboId[6]);
+        meshArena.vboId[6] = vboId;
+
+        meshArena.indexCapacity = capacity;
+    }
+
+    // Copy vertex data, attributes not available are filled with default values (as set by UploadMesh())
+    for (int k = 0; k < 6; k++)
+    {
+        int size = mesh.vertexCount*meshVertexSizes[k];
+
+        if (mesh.vboId[k] != 0) rlCopyBufferData(mesh.vboId[k], meshArena.vboId[k], 0, meshArena.vertexCount*meshVertexSizes[k], size);
+        else
+        {
+            unsigned char *data = (unsigned char *)RL_CALLOC(size, 1);
+            if (k == 2) for (int i = 0; i < mesh.vertexCount*3; i++) ((float *)data)[i] = 1.0f;    // Normals default
+            else if (k == 3) memset(data, 255, size);                                              // Colors default: WHITE
+            rlUpdateVertexBuffer(meshArena.vboId[k], data, size, meshArena.vertexCount*meshVertexSizes[k]);
+            RL_FREE(data);
+        }
+    }
+
+    unsigned int *indices = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+    for (int i = 0; i < indexCount; i++) indices[i] = (mesh.indices != NULL)? mesh.indices[i] : i;
+    rlUpdateVertexBuffer(meshArena.vboId[6], indices, indexCount*sizeof(unsigned int), meshArena.indexCount*sizeof(unsigned int));
+    RL_FREE(indices);
+
+    if (entry->key == 0) meshArena.entryCount++;
+    entry->key = mesh.vboId[0];
+    entry->baseVertex = meshArena.vertexCount;
+    entry->vertexCount = mesh.vertexCount;
+    entry->firstIndex = meshArena.indexCount;
+    entry->indexCount = indexCount;
+
+    meshArena.vertexCount += mesh.vertexCount;
+    meshArena.indexCount += indexCount;
+    meshArena.meshCount++;
+
+    return entry;
+}
+
+// Update mesh packed data in mesh arena (if packed), data is updated in place
+// NOTE: Vertex data is copied from mesh buffer on GPU side, indices are converted to 32 bit on CPU side,
+// mesh is removed (packed again on next DrawMeshList()) if updated range is not inside packed data
+static void UpdateMeshArena(Mesh mesh, int index, const void *data, int dataSize, int offset)
+{
+    if ((meshArena.meshCount == 0) || (mesh.vboId == NULL) || (mesh.vboId[0] == 0)) return;
+    if ((index < 0) || (index >= MAX_MESH_VERTEX_BUFFERS) || (mesh.vboId[index] == 0)) return;
+
+    MeshArenaEntry *entry = FindMeshArenaEntry(mesh.vboId[0]);
+    if (entry->key != mesh.vboId[0]) return;
+
+    // Arena buffers can not be updated from other rlgl contexts, mesh is packed again by default context
+    if (rlGetCurrentContext() != rlGetDefaultContext())
+    {
+        RemoveMeshArena(mesh);
+        return;
+    }
+
+    if (index < 6)
+    {
+        if ((offset < 0) || (dataSize < 0) || (dataSize > entry->vertexCount*meshVertexSizes[index] - offset)) RemoveMeshArena(mesh);
+        else rlCopyBufferData(mesh.vboId[index], meshArena.vboId[index], offset, entry->baseVertex*meshVertexSizes[index] + offset, dataSize);
+    }
+    else
+    {
+        int first = offset/(int)sizeof(unsigned short);
+        int count = dataSize/(int)sizeof(unsigned short);
+
+        if ((offset < 0) || (count < 0) || ((offset%(int)sizeof(unsigned short)) != 0) || (count > entry->indexCount - first)) RemoveMeshArena(mesh);
+        else if (count > 0)
+        {
+            unsigned int *indices = (unsigned int *)RL_MALLOC(count*sizeof(unsigned int));
+            for (int i = 0; i < count; i++) indices[i] = ((const unsigned short *)data)[i];
+            rlUpdateVertexBuffer(meshArena.vboId[6], indices, count*sizeof(unsigned int), (entry->firstIndex + first)*sizeof(unsigned int));
+            RL_FREE(indices);
+        }
+    }
+}
+
+// Remove mesh from mesh arena, packed data is not used anymore
+// NOTE: Arena space is reclaimed by CompactMeshArena() or once all packed meshes have been removed
+static void RemoveMeshArena(Mesh mesh)
+{
+    if ((meshArena.meshCount == 0) || (mesh.vboId == NULL) || (mesh.vboId[0] == 0)) return;
+
+    MeshArenaEntry *entry = FindMeshArenaEntry(mesh.vboId[0]);
+    if (entry->key != mesh.vboId[0]) return;
+
+    entry->key = MESH_ARENA_REMOVED;
+    meshArena.meshCount--;
+    meshArena.removedVertexCount += entry->vertexCount;
+    meshArena.removedIndexCount += entry->indexCount;
+
+    if (meshArena.meshCount == 0)
+    {
+        memset(meshArena.entries, 0, meshArena.entryCapacity*sizeof(MeshArenaEntry));
+        meshArena.entryCount = 0;
+        meshArena.vertexCount = 0;
+        meshArena.indexCount = 0;
+        meshArena.removedVertexCount = 0;
+        meshArena.removedIndexCount = 0;
+    }
+}
+
+// Compact mesh arena, packed data of removed meshes is discarded
+// NOTE: Packed meshes are copied to new arena buffers on GPU side (indices are relative to base vertex, not changed),
+// removed entries are cleared from hash table
+static void CompactMeshArena(void)
+{
+    unsigned int vboId[MAX_MESH_VERTEX_BUFFERS] = { 0 };
+    for (int k = 0; k < 6; k++) vboId[k] = rlLoadVertexBuffer(NULL, meshArena.vertexCapacity*meshVertexSizes[k], false);
+    vboId[6] = rlLoadVertexBuffer(NULL, meshArena.indexCapacity*sizeof(unsigned int), false);
+
+    MeshArenaEntry *entries = meshArena.entries;
+    meshArena.entries = (MeshArenaEntry *)RL_CALLOC(meshArena.entryCapacity, sizeof(MeshArenaEntry));
+    meshArena.entryCount = 0;
+    meshArena.vertexCount = 0;
+    meshArena.indexCount = 0;
+
+    for (int i = 0; i < meshArena.entryCapacity; i++)
+    {
+        MeshArenaEntry entry = entries[i];
+        if ((entry.key == 0) || (entry.key == MESH_ARENA_REMOVED)) continue;
+
+        for (int k = 0; k < 6; k++) rlCopyBufferData(meshArena.vboId[k], vboId[k], entry.baseVertex*meshVertexSizes[k], meshArena.vertexCount*meshVertexSizes[k], entry.vertexCount*meshVertexSizes[k]);
+        rlCopyBufferData(meshArena.vboId[6], vboId[6], entry.firstIndex*sizeof(unsigned int), meshArena.indexCount*sizeof(unsigned int), entry.indexCount*sizeof(unsigned int));
+
+        entry.baseVertex = meshArena.vertexCount;
+        entry.firstIndex = meshArena.indexCount;
+        *FindMeshArenaEntry(entry.key) = entry;
+
+        meshArena.entryCount++;
+        meshArena.vertexCount += entry.vertexCount;
+        meshArena.indexCount += entry.indexCount;
+    }
+
+    RL_FREE(entries);
+
+    for (int k = 0; k < MAX_MESH_VERTEX_BUFFERS; k++)
+    {
+        rlUnloadVertexBuffer(meshArena.vboId[k]);
+        meshArena.vboId[k] = vboId[k];
+    }
+
+    meshArena.removedVertexCount = 0;
+    meshArena.removedIndexCount = 0;
+}
+
+// Unload internal models buffers from GPU memory (mesh arena and instance buffer), called on CloseGraph()
+// NOTE: OpenGL objects do not survive the OpenGL context, everything is reset for next InitGraph()
+void UnloadModelsBuffers(void)
+{
+    for (int k = 0; k < MAX_MESH_VERTEX_BUFFERS; k++) if (meshArena.vboId[k] != 0) rlUnloadVertexBuffer(meshArena.vboId[k]);
+    if (meshArena.transformsVboId != 0) rlUnloadVertexBuffer(meshArena.transformsVboId);
+    if (meshArena.vaoId != 0) rlUnloadVertexArray(meshArena.vaoId);
+
+    RL_FREE(meshArena.entries);
+    RL_FREE(meshArena.commands);
+    RL_FREE(meshArena.transforms);
+
+    meshArena = (MeshArena){ 0 };
+
+    UnloadInstanceBuffer(instancesBuffer);
+    instancesBuffer = (InstanceBuffer){ 0 };
 }
 
 // Unload mesh from memory (RAM and VRAM)
 void UnloadMesh(Mesh mesh)
 {
+    RemoveMeshArena(mesh);
+
     // Unload rlgl mesh vboId data
     rlUnloadVertexArray(mesh.vaoId);
     for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh.vboId[i]);
@@ -1618,3 +2219,55 @@ void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float
     DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
     rlDisableWireMode();
 }
+
+// Get instance buffer data block offset (bytes)
+// NOTE: Blocks are stored in order: transforms, colors, custom data, the block after the last one gives the buffer size
+static size_t GetInstanceBufferOffset(InstanceBuffer buffer, int block)
+{
+    size_t offset = buffer.capacity*sizeof(float16);
+    if ((block > INSTANCE_DATA_COLOR) && (buffer.flags & INSTANCE_DATA_COLOR)) offset += buffer.capacity*sizeof(Color);
+    if ((block > INSTANCE_DATA_CUSTOM) && (buffer.flags & INSTANCE_DATA_CUSTOM)) offset += buffer.capacity*sizeof(Vector4);
+    return offset;
+}
+
+// Draw mesh through render batch, used by software rasterizer
+// NOTE: Mesh CPU data is used (GPU buffers are not read), shading is vertex color*diffuse color*diffuse texture,
+// triangles are submitted as quads with last vertex repeated, textured draws keep batch quads mode
+static void DrawMeshSoftware(Mesh mesh, Material material, Matrix transform)
+{
+    if (mesh.vertices == NULL) return;
+
+    Color tint = material.maps[MATERIAL_MAP_DIFFUSE].color;
+    int vertexCount = (mesh.indices != NULL)? mesh.triangleCount*3 : mesh.vertexCount;
+
+    rlPushMatrix();
+        rlMultMatrixf(MatrixToFloat(transform));
+
+        rlSetTexture(material.maps[MATERIAL_MAP_DIFFUSE].texture.id);
+        rlBegin(RL_QUADS);
+            for (int i = 0; i + 2 < vertexCount; i += 3)
+            {
+                rlCheckRenderBatchLimit(4);
+
+                for (int k = 0; k < 4; k++)
+                {
+                    int index = (mesh.indices != NULL)? mesh.indices[i + ((k < 3)? k : 2)] : i + ((k < 3)? k : 2);
+                    Color color = tint;
+
+                    if (mesh.colors != NULL)
+                    {
+                        color.r = (unsigned char)(mesh.colors[4*index]*tint.r/255);
+                        color.g = (unsigned char)(mesh.colors[4*index + 1]*tint.g/255);
+                        color.b = (unsigned char)(mesh.colors[4*index + 2]*tint.b/255);
+                        color.a = (unsigned char)(mesh.colors[4*index + 3]*tint.a/255);
+                    }
+
+                    rlColor4ub(color.r, color.g, color.b, color.a);
+                    if (mesh.texcoords != NULL) rlTexCoord2f(mesh.texcoords[2*index], mesh.texcoords[2*index + 1]);
+                    rlVertex3f(mesh.vertices[3*index], mesh.vertices[3*index + 1], mesh.vertices[3*index + 2]);
+                }
+            }
+        rlEnd();
+        rlSetTexture(0);
+    rlPopMatrix();
+}
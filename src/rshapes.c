@@ -14,10 +14,15 @@
     #define SMOOTH_CIRCLE_ERROR_RATE  0.5f
 #endif
 
+// Number of vertex generated on stack before submitting them to the batch with rlVertexBulk2f()
+// NOTE: It must be a multiple of 4 (QUADS)
+#define SHAPES_BULK_VERTEX_COUNT    64
+
 Texture2D texShapes = { 1, 1, 1, 1, 7 };        // Texture used on shapes drawing (usually a white pixel)
 rayRect texShapesRec = { 0, 0, 1, 1 };        // Texture source rectangle used on shapes drawing
 
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+static void SetShapesTexcoordsQuads(float *texcoords, int quadCount);  // Fill shapes texture coordinates for QUADS
 
 // Set texture and rectangle to be used on shapes drawing
 // NOTE: It can be useful when using basic shapes and one single font,
@@ -220,46 +225,51 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlCheckRenderBatchLimit(4*segments/2);
 
+    float positions[SHAPES_BULK_VERTEX_COUNT*2] = { 0 };
+    float texcoords[SHAPES_BULK_VERTEX_COUNT*2] = { 0 };
+    SetShapesTexcoordsQuads(texcoords, SHAPES_BULK_VERTEX_COUNT/4);
+    int count = 0;
+
     rlSetTexture(texShapes.id);
 
     rlBegin(RL_QUADS);
-        // NOTE: Every QUAD actually represents two segments
-        for (int i = 0; i < segments/2; i++)
-        {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x, center.y);
-
-            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
-
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength*2))*radius, center.y + cosf(DEG2RAD*(angle + stepLength*2))*radius);
-
-            angle += (stepLength*2);
-        }
+        rlColor4ub(color.r, color.g, color.b, color.a);
 
-        // NOTE: In case number of segments is odd, we add one last piece to the cake
-        if (segments%2)
+        // NOTE: Every QUAD actually represents two segments,
+        // in case number of segments is odd, we add one last piece to the cake
+        for (int i = 0; i < (segments + 1)/2; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
+            float *quad = &positions[2*count];
 
-            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x, center.y);
+            quad[0] = center.x;
+            quad[1] = center.y;
+            quad[2] = center.x + sinf(DEG2RAD*angle)*radius;
+            quad[3] = center.y + cosf(DEG2RAD*angle)*radius;
+            quad[4] = center.x + sinf(DEG2RAD*(angle + stepLength))*radius;
+            quad[5] = center.y + cosf(DEG2RAD*(angle + stepLength))*radius;
 
-            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            if ((i == segments/2) && (segments%2))
+            {
+                quad[6] = center.x;
+                quad[7] = center.y;
+            }
+            else
+            {
+                quad[6] = center.x + sinf(DEG2RAD*(angle + stepLength*2))*radius;
+                quad[7] = center.y + cosf(DEG2RAD*(angle + stepLength*2))*radius;
+            }
 
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            angle += (stepLength*2);
+            count += 4;
 
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x, center.y);
+            if (count == SHAPES_BULK_VERTEX_COUNT)
+            {
+                rlVertexBulk2f(positions, texcoords, NULL, count);
+                count = 0;
+            }
         }
+
+        if (count > 0) rlVertexBulk2f(positions, texcoords, NULL, count);
     rlEnd();
 
     rlSetTexture(0);
@@ -463,27 +473,44 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlCheckRenderBatchLimit(4*segments);
 
+    float positions[SHAPES_BULK_VERTEX_COUNT*2] = { 0 };
+    float texcoords[SHAPES_BULK_VERTEX_COUNT*2] = { 0 };
+    SetShapesTexcoordsQuads(texcoords, SHAPES_BULK_VERTEX_COUNT/4);
+    int count = 0;
+
     rlSetTexture(texShapes.id);
 
     rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
         for (int i = 0; i < segments; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-
-            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
-
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+            float *quad = &positions[2*count];
+            float sinStart = sinf(DEG2RAD*angle);
+            float cosStart = cosf(DEG2RAD*angle);
+            float sinEnd = sinf(DEG2RAD*(angle + stepLength));
+            float cosEnd = cosf(DEG2RAD*(angle + stepLength));
+
+            quad[0] = center.x + sinStart*innerRadius;
+            quad[1] = center.y + cosStart*innerRadius;
+            quad[2] = center.x + sinStart*outerRadius;
+            quad[3] = center.y + cosStart*outerRadius;
+            quad[4] = center.x + sinEnd*outerRadius;
+            quad[5] = center.y + cosEnd*outerRadius;
+            quad[6] = center.x + sinEnd*innerRadius;
+            quad[7] = center.y + cosEnd*innerRadius;
 
             angle += stepLength;
+            count += 4;
+
+            if (count == SHAPES_BULK_VERTEX_COUNT)
+            {
+                rlVertexBulk2f(positions, texcoords, NULL, count);
+                count = 0;
+            }
         }
+
+        if (count > 0) rlVertexBulk2f(positions, texcoords, NULL, count);
     rlEnd();
 
     rlSetTexture(0);
@@ -649,24 +676,19 @@ void DrawRectanglePro(rayRect rec, Vector2 origin, float rotation, Color color)
         bottomRight.y = y + (dx + rec.width)*sinRotation + (dy + rec.height)*cosRotation;
     }
 
+    float texLeft = texShapesRec.x/texShapes.width;
+    float texRight = (texShapesRec.x + texShapesRec.width)/texShapes.width;
+    float texTop = texShapesRec.y/texShapes.height;
+    float texBottom = (texShapesRec.y + texShapesRec.height)/texShapes.height;
+
+    const float positions[4*2] = { topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y, topRight.x, topRight.y };
+    const float texcoords[4*2] = { texLeft, texTop, texLeft, texBottom, texRight, texBottom, texRight, texTop };
+
     rlSetTexture(texShapes.id);
     rlBegin(RL_QUADS);
-
         rlNormal3f(0.0f, 0.0f, 1.0f);
         rlColor4ub(color.r, color.g, color.b, color.a);
-
-        rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(topLeft.x, topLeft.y);
-
-        rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(bottomRight.x, bottomRight.y);
-
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(topRight.x, topRight.y);
-
+        rlVertexBulk2f(positions, texcoords, NULL, 4);
     rlEnd();
     rlSetTexture(0);
 }
@@ -689,6 +711,20 @@ void DrawRectangleGradientH(int posX, int posY, int width, int height, Color col
 // NOTE: Colors refer to corners, starting at top-lef corner and counter-clockwise
 void DrawRectangleGradientEx(rayRect rec, Color col1, Color col2, Color col3, Color col4)
 {
+    float texLeft = texShapesRec.x/texShapes.width;
+    float texRight = (texShapesRec.x + texShapesRec.width)/texShapes.width;
+    float texTop = texShapesRec.y/texShapes.height;
+    float texBottom = (texShapesRec.y + texShapesRec.height)/texShapes.height;
+
+    const float positions[4*2] = { rec.x, rec.y, rec.x, rec.y + rec.height, rec.x + rec.width, rec.y + rec.height, rec.x + rec.width, rec.y };
+    const float texcoords[4*2] = { texLeft, texTop, texLeft, texBottom, texRight, texBottom, texRight, texTop };
+    const unsigned char colors[4*4] = {
+        col1.r, col1.g, col1.b, col1.a,
+        col2.r, col2.g, col2.b, col2.a,
+        col3.r, col3.g, col3.b, col3.a,
+        col4.r, col4.g, col4.b, col4.a
+    };
+
     rlSetTexture(texShapes.id);
 
     rlPushMatrix();
@@ -696,21 +732,7 @@ void DrawRectangleGradientEx(rayRect rec, Color col1, Color col2, Color col3, Co
             rlNormal3f(0.0f, 0.0f, 1.0f);
 
             // NOTE: Default raylib font character 95 is a white square
-            rlColor4ub(col1.r, col1.g, col1.b, col1.a);
-            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(rec.x, rec.y);
-
-            rlColor4ub(col2.r, col2.g, col2.b, col2.a);
-            rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(rec.x, rec.y + rec.height);
-
-            rlColor4ub(col3.r, col3.g, col3.b, col3.a);
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(rec.x + rec.width, rec.y + rec.height);
-
-            rlColor4ub(col4.r, col4.g, col4.b, col4.a);
-            rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(rec.x + rec.width, rec.y);
+            rlVertexBulk2f(positions, texcoords, colors, 4);
         rlEnd();
     rlPopMatrix();
 
@@ -1242,31 +1264,28 @@ void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
     rlCheckRenderBatchLimit(4);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
+    float texLeft = texShapesRec.x/texShapes.width;
+    float texRight = (texShapesRec.x + texShapesRec.width)/texShapes.width;
+    float texTop = texShapesRec.y/texShapes.height;
+    float texBottom = (texShapesRec.y + texShapesRec.height)/texShapes.height;
+
+    const float positions[4*2] = { v1.x, v1.y, v2.x, v2.y, v2.x, v2.y, v3.x, v3.y };
+    const float texcoords[4*2] = { texLeft, texTop, texLeft, texBottom, texRight, texBottom, texRight, texTop };
+
     rlSetTexture(texShapes.id);
 
     rlBegin(RL_QUADS);
         rlColor4ub(color.r, color.g, color.b, color.a);
-
-        rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(v1.x, v1.y);
-
-        rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(v2.x, v2.y);
-
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(v2.x, v2.y);
-
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(v3.x, v3.y);
+        rlVertexBulk2f(positions, texcoords, NULL, 4);
     rlEnd();
 
     rlSetTexture(0);
 #else
+    const float positions[3*2] = { v1.x, v1.y, v2.x, v2.y, v3.x, v3.y };
+
     rlBegin(RL_TRIANGLES);
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f(v1.x, v1.y);
-        rlVertex2f(v2.x, v2.y);
-        rlVertex2f(v3.x, v3.y);
+        rlVertexBulk2f(positions, NULL, NULL, 3);
     rlEnd();
 #endif
 }
@@ -1299,24 +1318,38 @@ void DrawTriangleFan(Vector2 *points, int pointCount, Color color)
     {
         rlCheckRenderBatchLimit((pointCount - 2)*4);
 
+        float positions[SHAPES_BULK_VERTEX_COUNT*2] = { 0 };
+        float texcoords[SHAPES_BULK_VERTEX_COUNT*2] = { 0 };
+        SetShapesTexcoordsQuads(texcoords, SHAPES_BULK_VERTEX_COUNT/4);
+        int count = 0;
+
         rlSetTexture(texShapes.id);
         rlBegin(RL_QUADS);
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             for (int i = 1; i < pointCount - 1; i++)
             {
-                rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(points[0].x, points[0].y);
+                float *quad = &positions[2*count];
 
-                rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(points[i].x, points[i].y);
+                quad[0] = points[0].x;
+                quad[1] = points[0].y;
+                quad[2] = points[i].x;
+                quad[3] = points[i].y;
+                quad[4] = points[i + 1].x;
+                quad[5] = points[i + 1].y;
+                quad[6] = points[i + 1].x;
+                quad[7] = points[i + 1].y;
 
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(points[i + 1].x, points[i + 1].y);
+                count += 4;
 
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(points[i + 1].x, points[i + 1].y);
+                if (count == SHAPES_BULK_VERTEX_COUNT)
+                {
+                    rlVertexBulk2f(positions, texcoords, NULL, count);
+                    count = 0;
+                }
             }
+
+            if (count > 0) rlVertexBulk2f(positions, texcoords, NULL, count);
         rlEnd();
         rlSetTexture(0);
     }
@@ -1369,26 +1402,41 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
         rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
+        float positions[SHAPES_BULK_VERTEX_COUNT*2] = { 0 };
+        float texcoords[SHAPES_BULK_VERTEX_COUNT*2] = { 0 };
+        SetShapesTexcoordsQuads(texcoords, SHAPES_BULK_VERTEX_COUNT/4);
+        int count = 0;
+
         rlSetTexture(texShapes.id);
 
         rlBegin(RL_QUADS);
+            rlColor4ub(color.r, color.g, color.b, color.a);
+
             for (int i = 0; i < sides; i++)
             {
-                rlColor4ub(color.r, color.g, color.b, color.a);
+                float *quad = &positions[2*count];
 
-                rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(0, 0);
+                quad[0] = 0.0f;
+                quad[1] = 0.0f;
+                quad[2] = sinf(DEG2RAD*centralAngle)*radius;
+                quad[3] = cosf(DEG2RAD*centralAngle)*radius;
+                quad[4] = quad[2];
+                quad[5] = quad[3];
 
-                rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
+                centralAngle += 360.0f/(float)sides;
+                quad[6] = sinf(DEG2RAD*centralAngle)*radius;
+                quad[7] = cosf(DEG2RAD*centralAngle)*radius;
 
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
+                count += 4;
 
-                centralAngle += 360.0f/(float)sides;
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
+                if (count == SHAPES_BULK_VERTEX_COUNT)
+                {
+                    rlVertexBulk2f(positions, texcoords, NULL, count);
+                    count = 0;
+                }
             }
+
+            if (count > 0) rlVertexBulk2f(positions, texcoords, NULL, count);
         rlEnd();
         rlSetTexture(0);
 #else
@@ -1509,3 +1557,25 @@ static float EaseCubicInOut(float t, float b, float c, float d)
 
     return 0.5f*c*(t*t*t + 2.0f) + b;
 }
+
+// Fill shapes texture coordinates for a number of QUADS
+// NOTE: Vertex order is top-left, bottom-left, bottom-right, top-right
+static void SetShapesTexcoordsQuads(float *texcoords, int quadCount)
+{
+    float texLeft = texShapesRec.x/texShapes.width;
+    float texRight = (texShapesRec.x + texShapesRec.width)/texShapes.width;
+    float texTop = texShapesRec.y/texShapes.height;
+    float texBottom = (texShapesRec.y + texShapesRec.height)/texShapes.height;
+
+    for (int i = 0; i < quadCount; i++)
+    {
+        texcoords[8*i] = texLeft;
+        texcoords[8*i + 1] = texTop;
+        texcoords[8*i + 2] = texLeft;
+        texcoords[8*i + 3] = texBottom;
+        texcoords[8*i + 4] = texRight;
+        texcoords[8*i + 5] = texBottom;
+        texcoords[8*i + 6] = texRight;
+        texcoords[8*i + 7] = texTop;
+    }
+}
@@ -4,8 +4,11 @@
 #include <stdlib.h>             // Required for: malloc(), free()
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()]
 #include <math.h>               // Required for: fabsf()
+#include <limits.h>             // Required for: INT_MAX [Used in GetPixelDataSize()]
 
 #define SUPPORT_FILEFORMAT_PNG      1
+#define SUPPORT_FILEFORMAT_DDS      1
+#define SUPPORT_FILEFORMAT_KTX      1
 #define SUPPORT_IMAGE_MANIPULATION  1
 
 // Support only desired texture formats on stb_image
@@ -62,8 +65,21 @@
 #ifndef PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD
     #define PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD  50    // Threshold over 255 to set alpha as 0
 #endif
+#ifndef MAX_IMAGE_FILE_DIMENSION
+    #define MAX_IMAGE_FILE_DIMENSION       16384    // Maximum width and height of compressed texture files (DDS, KTX), bigger ones are rejected
+#endif
 
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+#if defined(SUPPORT_FILEFORMAT_DDS)
+static Image LoadDDS(const unsigned char *fileData, int dataSize);  // Load DDS file data (compressed mipmaps kept as stored)
+#endif
+#if defined(SUPPORT_FILEFORMAT_KTX)
+static Image LoadKTX(const unsigned char *fileData, int dataSize);  // Load KTX 1.1 file data (compressed mipmaps kept as stored)
+static Image LoadKTX2(const unsigned char *fileData, int dataSize); // Load KTX 2.0 file data (compressed mipmaps kept as stored)
+#endif
+#if defined(SUPPORT_FILEFORMAT_DDS) || defined(SUPPORT_FILEFORMAT_KTX)
+static int GetImageMipmapsDataSize(int width, int height, int format, int *mipmaps, int maxDataSize);   // Get data size of mipmap levels fitting on max data size
+#endif
 
 // Load image from file into CPU memory (RAM)
 Image LoadImage(const char *fileName)
@@ -115,6 +131,7 @@ Image LoadImageAnim(const char *fileName, int *frames)
 }
 
 // Load image from memory buffer, fileType refers to extension: i.e. ".png"
+// NOTE: DDS and KTX compressed data is not decoded, mipmaps are uploaded as stored by LoadTextureFromImage()
 Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
 {
     Image image = { 0 };
@@ -140,6 +157,13 @@ Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, i
             }
         }
     }
+#if defined(SUPPORT_FILEFORMAT_DDS)
+    else if (TextIsEqual(fileExtLower, ".dds")) image = LoadDDS(fileData, dataSize);
+#endif
+#if defined(SUPPORT_FILEFORMAT_KTX)
+    else if (TextIsEqual(fileExtLower, ".ktx")) image = LoadKTX(fileData, dataSize);
+    else if (TextIsEqual(fileExtLower, ".ktx2")) image = LoadKTX2(fileData, dataSize);
+#endif
     else TRACELOG(LOG_WARNING, "IMAGE: Data format not supported");
     if (image.data != NULL) TRACELOG(LOG_INFO, "IMAGE: Data loaded successfully (%ix%i | %s | %i mipmaps)", image.width, image.height, rlGetPixelFormatName(image.format), image.mipmaps);
     else TRACELOG(LOG_WARNING, "IMAGE: Failed to load image data");
@@ -190,6 +214,127 @@ Image LoadImageFromScreen(void)
     return image;
 }
 
+// Load image readback for asynchronous screen/texture readback
+// NOTE: Requested data is copied by the GPU into a ring of pixel buffers,
+// it is retrieved with PollImageReadback() usually one or two frames later without stalls
+ImageReadback LoadImageReadback(int width, int height, int format, int bufferCount)
+{
+    ImageReadback readback = { 0 };
+
+    if ((width <= 0) || (height <= 0) || (bufferCount <= 0)) return readback;
+    if (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Readback not supported for compressed formats");
+        return readback;
+    }
+
+    readback.width = width;
+    readback.height = height;
+    readback.format = format;
+    readback.bufferCount = bufferCount;
+    readback.pboIds = (unsigned int *)RL_CALLOC(bufferCount, sizeof(unsigned int));
+    readback.fences = (void **)RL_CALLOC(bufferCount, sizeof(void *));
+    readback.flipped = (bool *)RL_CALLOC(bufferCount, sizeof(bool));
+
+    int size = GetPixelDataSize(width, height, format);
+    for (int i = 0; i < bufferCount; i++) readback.pboIds[i] = rlLoadPixelBuffer(size, true);
+
+    return readback;
+}
+
+// Unload image readback
+void UnloadImageReadback(ImageReadback readback)
+{
+    if (readback.pboIds == NULL) return;
+
+    for (int i = 0; i < readback.bufferCount; i++)
+    {
+        rlUnloadFence(readback.fences[i]);
+        rlUnloadPixelBuffer(readback.pboIds[i]);
+    }
+
+    RL_FREE(readback.pboIds);
+    RL_FREE(readback.fences);
+    RL_FREE(readback.flipped);
+}
+
+// Request screen buffer readback
+// NOTE: Current framebuffer is read, call it after drawing and before swapping buffers
+bool RequestScreenReadback(ImageReadback *readback)
+{
+    if ((readback->pboIds == NULL) || (readback->pending == readback->bufferCount)) return false;
+    if (readback->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Screen readback requires format R8G8B8A8");
+        return false;
+    }
+
+    rlDrawRenderBatchActive();      // Update and draw internal render batch
+
+    int index = (readback->first + readback->pending)%readback->bufferCount;
+    rlReadScreenPixelsToBuffer(readback->width, readback->height, readback->pboIds[index]);
+    readback->fences[index] = rlLoadFence();
+    readback->flipped[index] = true;
+    readback->pending++;
+
+    return true;
+}
+
+// Request texture readback
+bool RequestTextureReadback(ImageReadback *readback, Texture2D texture)
+{
+    if ((readback->pboIds == NULL) || (readback->pending == readback->bufferCount)) return false;
+    if ((texture.width != readback->width) || (texture.height != readback->height) || (texture.format != readback->format))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Texture does not match readback size or format", texture.id);
+        return false;
+    }
+
+    rlDrawRenderBatchActive();      // Update and draw internal render batch
+
+    int index = (readback->first + readback->pending)%readback->bufferCount;
+    rlReadTexturePixelsToBuffer(texture.id, texture.format, readback->pboIds[index]);
+    readback->fences[index] = rlLoadFence();
+    readback->flipped[index] = false;
+    readback->pending++;
+
+    return true;
+}
+
+// Get oldest requested image if completed by GPU
+// NOTE: Screen data is flipped (and alpha set to 255) while copied out of the pixel buffer
+bool PollImageReadback(ImageReadback *readback, Image *image)
+{
+    if ((readback->pboIds == NULL) || (readback->pending == 0)) return false;
+
+    int index = readback->first;
+    if (!rlIsFenceSignaled(readback->fences[index])) return false;
+
+    int size = GetPixelDataSize(readback->width, readback->height, readback->format);
+    void *data = rlMapPixelBuffer(readback->pboIds[index], size, true);
+
+    if (data != NULL)
+    {
+        image->data = RL_MALLOC(size);
+        image->width = readback->width;
+        image->height = readback->height;
+        image->format = readback->format;
+        image->mipmaps = 1;
+
+        if (readback->flipped[index]) rlFlipScreenPixels(image->data, data, readback->width, readback->height);
+        else memcpy(image->data, data, size);
+
+        rlUnmapPixelBuffer(readback->pboIds[index], true);
+    }
+
+    rlUnloadFence(readback->fences[index]);
+    readback->fences[index] = NULL;
+    readback->first = (readback->first + 1)%readback->bufferCount;
+    readback->pending--;
+
+    return (data != NULL);
+}
+
 // Unload image from CPU memory (RAM)
 void UnloadImage(Image image)
 {
@@ -2327,6 +2472,98 @@ void UpdateTextureRec(Texture2D texture, rayRect rec, const void *pixels)
     rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
 }
 
+//------------------------------------------------------------------------------------
+// Texture streaming functions
+//------------------------------------------------------------------------------------
+// Load texture stream for asynchronous updates
+// NOTE: Every update uses next pixel buffer of the ring, so CPU can write a new frame
+// while previous ones are still being transferred by the GPU
+TextureStream LoadTextureStream(Texture2D texture, int bufferCount)
+{
+    TextureStream stream = { 0 };
+    stream.current = -1;
+
+    if ((texture.id == 0) || (bufferCount <= 0)) return stream;
+    if (texture.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Streaming not supported for compressed formats", texture.id);
+        return stream;
+    }
+
+    stream.texture = texture;
+    stream.bufferCount = bufferCount;
+    stream.pboIds = (unsigned int *)RL_CALLOC(bufferCount, sizeof(unsigned int));
+    stream.fences = (void **)RL_CALLOC(bufferCount, sizeof(void *));
+
+    int size = GetPixelDataSize(texture.width, texture.height, texture.format);
+    for (int i = 0; i < bufferCount; i++) stream.pboIds[i] = rlLoadPixelBuffer(size, false);
+
+    TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Texture stream loaded successfully (%i buffers)", texture.id, bufferCount);
+
+    return stream;
+}
+
+// Unload texture stream
+void UnloadTextureStream(TextureStream stream)
+{
+    if (stream.pboIds == NULL) return;
+
+    if (stream.mapped != NULL) rlUnmapPixelBuffer(stream.pboIds[stream.current], false);
+    for (int i = 0; i < stream.bufferCount; i++)
+    {
+        rlUnloadFence(stream.fences[i]);
+        rlUnloadPixelBuffer(stream.pboIds[i]);
+    }
+
+    RL_FREE(stream.pboIds);
+    RL_FREE(stream.fences);
+}
+
+// Begin texture stream update
+// NOTE: Returned buffer is write-only and must be fully written (previous contents are undefined)
+void *BeginTextureStreamUpdate(TextureStream *stream)
+{
+    if ((stream->pboIds == NULL) || (stream->mapped != NULL)) return stream->mapped;
+
+    stream->current = (stream->current + 1)%stream->bufferCount;
+    stream->mapped = rlMapPixelBuffer(stream->pboIds[stream->current], GetPixelDataSize(stream->texture.width, stream->texture.height, stream->texture.format), false);
+
+    return stream->mapped;
+}
+
+// End texture stream update
+void EndTextureStreamUpdate(TextureStream *stream)
+{
+    if (stream->mapped == NULL) return;
+
+    rlUnmapPixelBuffer(stream->pboIds[stream->current], false);
+    stream->mapped = NULL;
+
+    rlUpdateTextureFromPixelBuffer(stream->texture.id, 0, 0, stream->texture.width, stream->texture.height, stream->texture.format, stream->pboIds[stream->current]);
+
+    rlUnloadFence(stream->fences[stream->current]);
+    stream->fences[stream->current] = rlLoadFence();
+}
+
+// Update texture stream with new data
+// NOTE: pixels data must match texture.format, it can be reused right after the call
+void UpdateTextureStream(TextureStream *stream, const void *pixels)
+{
+    void *data = BeginTextureStreamUpdate(stream);
+    if (data == NULL) return;
+
+    memcpy(data, pixels, GetPixelDataSize(stream->texture.width, stream->texture.height, stream->texture.format));
+    EndTextureStreamUpdate(stream);
+}
+
+// Check if last texture stream update has been completed by GPU
+bool IsTextureStreamUpdated(TextureStream stream)
+{
+    if ((stream.pboIds == NULL) || (stream.current < 0)) return true;
+
+    return rlIsFenceSignaled(stream.fences[stream.current]);
+}
+
 //------------------------------------------------------------------------------------
 // Texture configuration functions
 //------------------------------------------------------------------------------------
@@ -2616,31 +2853,28 @@ void DrawTexturePro(Texture2D texture, rayRect source, rayRect dest, Vector2 ori
 
         rlCheckRenderBatchLimit(4);     // Make sure there is enough free space on the batch buffer
 
+        float texLeft = source.x/width;
+        float texRight = (source.x + source.width)/width;
+        float texTop = source.y/height;
+        float texBottom = (source.y + source.height)/height;
+
+        if (flipX)
+        {
+            float tmp = texLeft;
+            texLeft = texRight;
+            texRight = tmp;
+        }
+
+        // Corners order: top-left, bottom-left, bottom-right, top-right (texture and quad)
+        const float positions[4*2] = { topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y, topRight.x, topRight.y };
+        const float texcoords[4*2] = { texLeft, texTop, texLeft, texBottom, texRight, texBottom, texRight, texTop };
+
         rlSetTexture(texture.id);
         rlBegin(RL_QUADS);
 
             rlColor4ub(tint.r, tint.g, tint.b, tint.a);
             rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
-
-            // Top-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            else rlTexCoord2f(source.x/width, source.y/height);
-            rlVertex2f(topLeft.x, topLeft.y);
-
-            // Bottom-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            rlVertex2f(bottomLeft.x, bottomLeft.y);
-
-            // Bottom-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            rlVertex2f(bottomRight.x, bottomRight.y);
-
-            // Top-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            rlVertex2f(topRight.x, topRight.y);
+            rlVertexBulk2f(positions, texcoords, NULL, 4);
 
         rlEnd();
         rlSetTexture(0);
@@ -3076,10 +3310,10 @@ void SetPixelColor(void *dstPtr, Color color, int format)
 }
 
 // Get pixel data size in bytes for certain format
-// NOTE: Size can be requested for Image or Texture data
+// NOTE: Size can be requested for Image or Texture data, it is computed in 64-bit and 0 is returned if it does not fit on an int
 int GetPixelDataSize(int width, int height, int format)
 {
-    int dataSize = 0;       // Size in bytes
+    long long dataSize = 0; // Size in bytes
     int bpp = 0;            // Bits per pixel
 
     switch (format)
@@ -3108,16 +3342,28 @@ int GetPixelDataSize(int width, int height, int format)
         default: break;
     }
 
-    dataSize = width*height*bpp/8;  // Total data size in bytes
+    dataSize = (long long)width*height*bpp/8;   // Total data size in bytes
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    // Compressed formats work on 4x4 blocks (8x8 for ASTC 8x8), incomplete blocks on borders
+    // are stored complete, so size is computed on block-aligned dimensions
+    if (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+        int blockSize = (format == PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)? 8 : 4;
+        long long blocksX = ((long long)width + blockSize - 1)/blockSize;
+        long long blocksY = ((long long)height + blockSize - 1)/blockSize;
+
+        // PVRTC 4bpp requires at least 2x2 blocks
+        if ((format == PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == PIXELFORMAT_COMPRESSED_PVRT_RGBA))
+        {
+            if (blocksX < 2) blocksX = 2;
+            if (blocksY < 2) blocksY = 2;
+        }
+
+        dataSize = blocksX*blocksY*(blockSize*blockSize*bpp/8);
     }
 
+    if ((dataSize < 0) || (dataSize > INT_MAX)) dataSize = 0;
+
     return dataSize;
 }
 
@@ -3231,3 +3477,448 @@ static Vector4 *LoadImageDataNormalized(Image image)
 
     return pixels;
 }
+
+#if defined(SUPPORT_FILEFORMAT_DDS) || defined(SUPPORT_FILEFORMAT_KTX)
+// Get data size of consecutive mipmap levels, mipmaps count is clamped to levels fitting on maxDataSize
+// NOTE: Returns 0 if base level does not fit or dimensions are out of range [1..MAX_IMAGE_FILE_DIMENSION]
+static int GetImageMipmapsDataSize(int width, int height, int format, int *mipmaps, int maxDataSize)
+{
+    int size = 0;
+    int levels = 0;
+
+    if ((width < 1) || (height < 1) || (width > MAX_IMAGE_FILE_DIMENSION) || (height > MAX_IMAGE_FILE_DIMENSION)) *mipmaps = 0;
+
+    for (; levels < *mipmaps; levels++)
+    {
+        int mipSize = GetPixelDataSize(width, height, format);
+        if ((mipSize <= 0) || (mipSize > maxDataSize - size)) break;
+
+        size += mipSize;
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    *mipmaps = levels;
+
+    return size;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_DDS)
+// Load DDS file data
+// NOTE: Supported formats: DXT1/3/5 (also DX10 BC1/2/3 headers), RGBA32, RGB24, RGB565, ARGB1555, ARGB4444, float RGBA/RGB/R,
+// only the first surface is loaded for cubemaps and texture arrays
+static Image LoadDDS(const unsigned char *fileData, int dataSize)
+{
+    #define DDS_FOURCC(a, b, c, d)  ((unsigned int)(a) | ((unsigned int)(b) << 8) | ((unsigned int)(c) << 16) | ((unsigned int)(d) << 24))
+
+    // DDS header, after "DDS " file identifier
+    typedef struct {
+        unsigned int size;                  // Header size, always 124
+        unsigned int flags;                 // Valid fields flags (DDSD_MIPMAPCOUNT = 0x20000)
+        unsigned int height;
+        unsigned int width;
+        unsigned int pitchOrLinearSize;
+        unsigned int depth;
+        unsigned int mipmapCount;
+        unsigned int reserved1[11];
+        unsigned int pfSize;                // Pixel format size, always 32
+        unsigned int pfFlags;               // Pixel format flags (DDPF_ALPHAPIXELS = 0x01, DDPF_FOURCC = 0x04, DDPF_RGB = 0x40)
+        unsigned int pfFourCC;              // Compression type (DDPF_FOURCC)
+        unsigned int pfRGBBitCount;         // Bits per pixel (DDPF_RGB)
+        unsigned int pfRBitMask;
+        unsigned int pfGBitMask;
+        unsigned int pfBBitMask;
+        unsigned int pfABitMask;
+        unsigned int caps;
+        unsigned int caps2;
+        unsigned int caps3;
+        unsigned int caps4;
+        unsigned int reserved2;
+    } DDSHeader;
+
+    Image image = { 0 };
+    DDSHeader header = { 0 };
+    int offset = 4 + sizeof(DDSHeader);
+
+    if ((fileData == NULL) || (dataSize < offset) || (memcmp(fileData, "DDS ", 4) != 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: DDS file data not valid");
+        return image;
+    }
+
+    memcpy(&header, fileData + 4, sizeof(DDSHeader));
+
+    int format = 0;
+
+    if (header.pfFlags & 0x04)          // DDPF_FOURCC
+    {
+        if (header.pfFourCC == DDS_FOURCC('D', 'X', 'T', '1')) format = (header.pfFlags & 0x01)? PIXELFORMAT_COMPRESSED_DXT1_RGBA : PIXELFORMAT_COMPRESSED_DXT1_RGB;
+        else if (header.pfFourCC == DDS_FOURCC('D', 'X', 'T', '3')) format = PIXELFORMAT_COMPRESSED_DXT3_RGBA;
+        else if (header.pfFourCC == DDS_FOURCC('D', 'X', 'T', '5')) format = PIXELFORMAT_COMPRESSED_DXT5_RGBA;
+        else if ((header.pfFourCC == DDS_FOURCC('D', 'X', '1', '0')) && (dataSize >= offset + 20))
+        {
+            // DX10 extended header, first field is DXGI format (sRGB variants loaded as linear)
+            unsigned int dxgiFormat = 0;
+            memcpy(&dxgiFormat, fileData + offset, sizeof(unsigned int));
+            offset += 20;
+
+            switch (dxgiFormat)
+            {
+                case 2: format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32; break;      // DXGI_FORMAT_R32G32B32A32_FLOAT
+                case 6: format = PIXELFORMAT_UNCOMPRESSED_R32G32B32; break;         // DXGI_FORMAT_R32G32B32_FLOAT
+                case 28:
+                case 29: format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8; break;         // DXGI_FORMAT_R8G8B8A8_UNORM(_SRGB)
+                case 41: format = PIXELFORMAT_UNCOMPRESSED_R32; break;              // DXGI_FORMAT_R32_FLOAT
+                case 71:
+                case 72: format = PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;          // DXGI_FORMAT_BC1_UNORM(_SRGB)
+                case 74:
+                case 75: format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;          // DXGI_FORMAT_BC2_UNORM(_SRGB)
+                case 77:
+                case 78: format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;          // DXGI_FORMAT_BC3_UNORM(_SRGB)
+                default: break;
+            }
+        }
+    }
+    else if (header.pfFlags & 0x40)     // DDPF_RGB
+    {
+        if (header.pfRGBBitCount == 32) format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        else if (header.pfRGBBitCount == 24) format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+        else if (header.pfRGBBitCount == 16)
+        {
+            if ((header.pfFlags & 0x01) && (header.pfABitMask == 0x8000)) format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
+            else if ((header.pfFlags & 0x01) && (header.pfABitMask == 0xf000)) format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
+            else if (header.pfRBitMask == 0xf800) format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+        }
+    }
+
+    if (format == 0)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: DDS pixel format not supported");
+        return image;
+    }
+
+    int mipmaps = ((header.flags & 0x20000) && (header.mipmapCount > 0))? (int)header.mipmapCount : 1;
+    int levels = mipmaps;
+    int size = GetImageMipmapsDataSize(header.width, header.height, format, &levels, dataSize - offset);
+
+    if ((header.width == 0) || (header.height == 0) || (levels == 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: DDS file data size not valid");
+        return image;
+    }
+    if (levels < mipmaps) TRACELOG(LOG_WARNING, "IMAGE: DDS file data truncated, %i of %i mipmaps loaded", levels, mipmaps);
+
+    image.width = header.width;
+    image.height = header.height;
+    image.mipmaps = levels;
+    image.format = format;
+    image.data = RL_MALLOC(size);
+    memcpy(image.data, fileData + offset, size);
+
+    // Uncompressed data is stored in channel masks order, converted to raylib pixel formats layout
+    if (!(header.pfFlags & 0x04))
+    {
+        unsigned char *pixels = (unsigned char *)image.data;
+        unsigned short *pixels16 = (unsigned short *)image.data;
+        int pixelCount = size/GetPixelDataSize(1, 1, format);
+
+        if ((format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) || (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8))
+        {
+            int bytesPerPixel = (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? 4 : 3;
+            bool swapRB = (header.pfRBitMask == 0x00ff0000);        // BGR(A) byte order
+            bool opaque = !(header.pfFlags & 0x01) || (header.pfABitMask == 0);
+
+            for (int i = 0; i < pixelCount; i++, pixels += bytesPerPixel)
+            {
+                if (swapRB) { unsigned char r = pixels[2]; pixels[2] = pixels[0]; pixels[0] = r; }
+                if (opaque && (bytesPerPixel == 4)) pixels[3] = 255;
+            }
+        }
+        else if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+        {
+            for (int i = 0; i < pixelCount; i++) pixels16[i] = ((pixels16[i] & 0x7fff) << 1) | ((pixels16[i] & 0x8000) >> 15);   // A1R5G5B5 -> R5G5B5A1
+        }
+        else if (format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4)
+        {
+            for (int i = 0; i < pixelCount; i++) pixels16[i] = ((pixels16[i] & 0x0fff) << 4) | ((pixels16[i] & 0xf000) >> 12);   // A4R4G4B4 -> R4G4B4A4
+        }
+    }
+
+    return image;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_KTX)
+// Load KTX 1.1 file data
+// NOTE: Supported formats: DXT1/3/5, ETC1, ETC2, ETC2_EAC, PVRTC 4bpp, ASTC 4x4/8x8, RGBA8, RGB8, float RGBA/RGB/R,
+// only little-endian files, first face/layer is loaded for cubemaps and texture arrays
+static Image LoadKTX(const unsigned char *fileData, int dataSize)
+{
+    static const unsigned char identifier[12] = { 0xab, 'K', 'T', 'X', ' ', '1', '1', 0xbb, '\r', '\n', 0x1a, '\n' };
+
+    // KTX 1.1 header, after file identifier
+    typedef struct {
+        unsigned int endianness;            // 0x04030201 on little-endian files
+        unsigned int glType;                // OpenGL data type (0 for compressed data)
+        unsigned int glTypeSize;
+        unsigned int glFormat;              // OpenGL pixel format (0 for compressed data)
+        unsigned int glInternalFormat;      // OpenGL internal format, defines pixel format
+        unsigned int glBaseInternalFormat;
+        unsigned int width;
+        unsigned int height;
+        unsigned int depth;
+        unsigned int arrayElements;         // Texture array layers (0 if not an array)
+        unsigned int faces;                 // 6 for cubemaps, 1 otherwise
+        unsigned int mipmapLevels;          // Mipmap levels stored (0 if to be generated)
+        unsigned int keyValueDataSize;      // Key/value metadata size, skipped
+    } KTXHeader;
+
+    Image image = { 0 };
+    KTXHeader header = { 0 };
+    int offset = sizeof(identifier) + sizeof(KTXHeader);
+
+    if ((fileData == NULL) || (dataSize < offset) || (memcmp(fileData, identifier, sizeof(identifier)) != 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: KTX file data not valid");
+        return image;
+    }
+
+    memcpy(&header, fileData + sizeof(identifier), sizeof(KTXHeader));
+
+    if (header.endianness != 0x04030201)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: KTX big-endian file data not supported");
+        return image;
+    }
+
+    int format = 0;
+
+    switch (header.glInternalFormat)
+    {
+        case 0x83f0: format = PIXELFORMAT_COMPRESSED_DXT1_RGB; break;           // GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+        case 0x83f1: format = PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;          // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+        case 0x83f2: format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;          // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
+        case 0x83f3: format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;          // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+        case 0x8d64: format = PIXELFORMAT_COMPRESSED_ETC1_RGB; break;           // GL_ETC1_RGB8_OES
+        case 0x9274: format = PIXELFORMAT_COMPRESSED_ETC2_RGB; break;           // GL_COMPRESSED_RGB8_ETC2
+        case 0x9278: format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA; break;      // GL_COMPRESSED_RGBA8_ETC2_EAC
+        case 0x8c00: format = PIXELFORMAT_COMPRESSED_PVRT_RGB; break;           // GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG
+        case 0x8c02: format = PIXELFORMAT_COMPRESSED_PVRT_RGBA; break;          // GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG
+        case 0x93b0: format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA; break;      // GL_COMPRESSED_RGBA_ASTC_4x4_KHR
+        case 0x93b7: format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA; break;      // GL_COMPRESSED_RGBA_ASTC_8x8_KHR
+        case 0x8058: format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8; break;         // GL_RGBA8
+        case 0x8051: format = PIXELFORMAT_UNCOMPRESSED_R8G8B8; break;           // GL_RGB8
+        case 0x8814: format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32; break;     // GL_RGBA32F
+        case 0x8815: format = PIXELFORMAT_UNCOMPRESSED_R32G32B32; break;        // GL_RGB32F
+        case 0x822e: format = PIXELFORMAT_UNCOMPRESSED_R32; break;              // GL_R32F
+        default: break;
+    }
+
+    if (format == 0)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: KTX pixel format not supported (glInternalFormat: 0x%x)", header.glInternalFormat);
+        return image;
+    }
+
+    int mipmaps = (header.mipmapLevels > 0)? (int)header.mipmapLevels : 1;
+    int faces = (header.faces > 0)? (int)header.faces : 1;
+
+    if ((header.width == 0) || (header.height == 0) || (mipmaps > 32) || ((faces != 1) && (faces != 6)) || (header.keyValueDataSize > (unsigned int)(dataSize - offset)))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: KTX file data not valid");
+        return image;
+    }
+
+    offset += header.keyValueDataSize;
+
+    // NOTE: Levels are stored one after the other, data of levels to load can not be bigger than file data
+    int count = mipmaps;
+    int size = GetImageMipmapsDataSize(header.width, header.height, format, &count, dataSize - offset);
+    unsigned char *data = (size > 0)? (unsigned char *)RL_MALLOC(size) : NULL;
+    int levels = 0;
+
+    // Every level is stored as image size followed by faces data (padded to 4 bytes),
+    // uncompressed rows are padded to 4 bytes (GL_UNPACK_ALIGNMENT)
+    int mipWidth = header.width;
+    int mipHeight = header.height;
+    int mipOffset = 0;
+
+    for (; levels < count; levels++)
+    {
+        if (dataSize - offset < 4) break;
+
+        unsigned int imageSize = 0;
+        memcpy(&imageSize, fileData + offset, sizeof(unsigned int));
+        offset += 4;
+
+        int mipSize = GetPixelDataSize(mipWidth, mipHeight, format);
+        int rowSize = (format < PIXELFORMAT_COMPRESSED_DXT1_RGB)? GetPixelDataSize(mipWidth, 1, format) : mipSize;
+        int rowPitch = (format < PIXELFORMAT_COMPRESSED_DXT1_RGB)? ((rowSize + 3) & ~3) : mipSize;
+        int rows = mipSize/rowSize;
+
+        if ((imageSize < (unsigned long long)rowPitch*rows) || (imageSize > (unsigned int)(dataSize - offset))) break;
+
+        for (int row = 0; row < rows; row++) memcpy(data + mipOffset + row*rowSize, fileData + offset + row*rowPitch, rowSize);
+
+        // Arrays image size includes all layers, otherwise it refers to one face
+        long long levelSize = (header.arrayElements > 0)? (long long)imageSize : (((long long)imageSize + 3) & ~3LL)*faces;
+        offset = (levelSize < dataSize - offset)? offset + (int)levelSize : dataSize;
+
+        mipOffset += mipSize;
+        mipWidth = (mipWidth > 1)? mipWidth/2 : 1;
+        mipHeight = (mipHeight > 1)? mipHeight/2 : 1;
+    }
+
+    if (levels == 0)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: KTX file data size not valid");
+        RL_FREE(data);
+        return image;
+    }
+    if (levels < mipmaps) TRACELOG(LOG_WARNING, "IMAGE: KTX file data truncated, %i of %i mipmaps loaded", levels, mipmaps);
+
+    image.data = data;
+    image.width = header.width;
+    image.height = header.height;
+    image.mipmaps = levels;
+    image.format = format;
+
+    return image;
+}
+
+// Load KTX 2.0 file data
+// NOTE: Supported formats: BC1/2/3, ETC2 RGB/RGBA, ASTC 4x4/8x8, RGBA8, RGB8, float RGBA/RGB/R (sRGB variants loaded as linear),
+// supercompressed data (Basis Universal, Zstandard) is not supported, first face/layer is loaded for cubemaps and texture arrays
+static Image LoadKTX2(const unsigned char *fileData, int dataSize)
+{
+    static const unsigned char identifier[12] = { 0xab, 'K', 'T', 'X', ' ', '2', '0', 0xbb, '\r', '\n', 0x1a, '\n' };
+
+    // KTX 2.0 header, after file identifier
+    // NOTE: Supercompression global data offset/size (2x 64bit) follows, then levels index
+    typedef struct {
+        unsigned int vkFormat;              // Vulkan format (VkFormat)
+        unsigned int typeSize;
+        unsigned int width;
+        unsigned int height;
+        unsigned int depth;
+        unsigned int layerCount;
+        unsigned int faceCount;
+        unsigned int levelCount;            // Mipmap levels stored (0 if to be generated)
+        unsigned int supercompressionScheme;
+        unsigned int dfdByteOffset;
+        unsigned int dfdByteLength;
+        unsigned int kvdByteOffset;
+        unsigned int kvdByteLength;
+    } KTX2Header;
+
+    Image image = { 0 };
+    KTX2Header header = { 0 };
+    int indexOffset = sizeof(identifier) + sizeof(KTX2Header) + 16;
+
+    if ((fileData == NULL) || (dataSize < indexOffset) || (memcmp(fileData, identifier, sizeof(identifier)) != 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: KTX2 file data not valid");
+        return image;
+    }
+
+    memcpy(&header, fileData + sizeof(identifier), sizeof(KTX2Header));
+
+    if (header.supercompressionScheme != 0)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: KTX2 supercompressed file data not supported (scheme: %i)", header.supercompressionScheme);
+        return image;
+    }
+
+    int format = 0;
+
+    switch (header.vkFormat)
+    {
+        case 23:
+        case 29: format = PIXELFORMAT_UNCOMPRESSED_R8G8B8; break;           // VK_FORMAT_R8G8B8_UNORM/SRGB
+        case 37:
+        case 43: format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8; break;         // VK_FORMAT_R8G8B8A8_UNORM/SRGB
+        case 100: format = PIXELFORMAT_UNCOMPRESSED_R32; break;             // VK_FORMAT_R32_SFLOAT
+        case 106: format = PIXELFORMAT_UNCOMPRESSED_R32G32B32; break;       // VK_FORMAT_R32G32B32_SFLOAT
+        case 109: format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32; break;    // VK_FORMAT_R32G32B32A32_SFLOAT
+        case 131:
+        case 132: format = PIXELFORMAT_COMPRESSED_DXT1_RGB; break;          // VK_FORMAT_BC1_RGB_UNORM/SRGB_BLOCK
+        case 133:
+        case 134: format = PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;         // VK_FORMAT_BC1_RGBA_UNORM/SRGB_BLOCK
+        case 135:
+        case 136: format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;         // VK_FORMAT_BC2_UNORM/SRGB_BLOCK
+        case 137:
+        case 138: format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;         // VK_FORMAT_BC3_UNORM/SRGB_BLOCK
+        case 147:
+        case 148: format = PIXELFORMAT_COMPRESSED_ETC2_RGB; break;          // VK_FORMAT_ETC2_R8G8B8_UNORM/SRGB_BLOCK
+        case 151:
+        case 152: format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA; break;     // VK_FORMAT_ETC2_R8G8B8A8_UNORM/SRGB_BLOCK
+        case 157:
+        case 158: format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA; break;     // VK_FORMAT_ASTC_4x4_UNORM/SRGB_BLOCK
+        case 171:
+        case 172: format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA; break;     // VK_FORMAT_ASTC_8x8_UNORM/SRGB_BLOCK
+        default: break;
+    }
+
+    if (format == 0)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: KTX2 pixel format not supported (vkFormat: %i)", header.vkFormat);
+        return image;
+    }
+
+    int mipmaps = (header.levelCount > 0)? (int)header.levelCount : 1;
+
+    if ((header.width == 0) || (header.height == 0) || (mipmaps > 32) || (dataSize - indexOffset < mipmaps*24))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: KTX2 file data not valid");
+        return image;
+    }
+
+    // NOTE: Levels can not overlap, data of levels to load can not be bigger than file data
+    int count = mipmaps;
+    int size = GetImageMipmapsDataSize(header.width, header.height, format, &count, dataSize - indexOffset);
+    unsigned char *data = (size > 0)? (unsigned char *)RL_MALLOC(size) : NULL;
+    int levels = 0;
+
+    // Levels index entries: byte offset, byte length, uncompressed byte length (64bit each),
+    // level data is tightly packed with first face/layer at level byte offset
+    int mipWidth = header.width;
+    int mipHeight = header.height;
+    int mipOffset = 0;
+
+    for (; levels < count; levels++)
+    {
+        unsigned long long levelOffset = 0;
+        unsigned long long levelLength = 0;
+        memcpy(&levelOffset, fileData + indexOffset + levels*24, sizeof(unsigned long long));
+        memcpy(&levelLength, fileData + indexOffset + levels*24 + 8, sizeof(unsigned long long));
+
+        int mipSize = GetPixelDataSize(mipWidth, mipHeight, format);
+
+        if ((levelLength < (unsigned long long)mipSize) || (levelOffset > (unsigned long long)dataSize) ||
+            ((unsigned long long)mipSize > (unsigned long long)dataSize - levelOffset)) break;
+
+        memcpy(data + mipOffset, fileData + levelOffset, mipSize);
+
+        mipOffset += mipSize;
+        mipWidth = (mipWidth > 1)? mipWidth/2 : 1;
+        mipHeight = (mipHeight > 1)? mipHeight/2 : 1;
+    }
+
+    if (levels == 0)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: KTX2 file data size not valid");
+        RL_FREE(data);
+        return image;
+    }
+    if (levels < mipmaps) TRACELOG(LOG_WARNING, "IMAGE: KTX2 file data truncated, %i of %i mipmaps loaded", levels, mipmaps);
+
+    image.data = data;
+    image.width = header.width;
+    image.height = header.height;
+    image.mipmaps = levels;
+    image.format = format;
+
+    return image;
+}
+#endif
@@ -3,10 +3,12 @@
     #define GETCWD _getcwd          // NOTE: MSDN recommends not to use getcwd(), chdir()
     #define CHDIR _chdir
     #include <io.h>                 // Required for: _access() [Used in FileExists()]
+    #define ACCESS _access
 #else
     #include <unistd.h>             // Required for: getch(), chdir() (POSIX), access()
     #define GETCWD getcwd
     #define CHDIR chdir
+    #define ACCESS access
 #endif
 
 // USE_TRACELOG
@@ -53,6 +55,9 @@
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Binded by default to shader location: 3
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Binded by default to shader location: 4
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Binded by default to shader location: 5
+#define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Binded by default to shader location: 15 (render batch texture slot)
+#define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR  "instanceColor"  // instance color (DrawMeshInstancedBuffer)
+#define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_CUSTOM "instanceCustom" // instance custom data (DrawMeshInstancedBuffer)
 
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
@@ -63,3 +68,4 @@
 #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1  "texture1"          // texture1 (texture slot active 1)
 #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
+#define RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_CAMERA "CameraMatrices"   // camera uniform block (std140: mat4 matView, mat4 matProjection)
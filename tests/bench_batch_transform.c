@@ -0,0 +1,124 @@
+// Batch vertex transform benchmark: 1M vertex submitted under a transform matrix (rlPushMatrix()),
+// deferred transformation (applied on rlPopMatrix()) vs per-vertex transformation reference,
+// built twice: default SIMD kernels (runtime CPU dispatch) and RLGL_NO_SIMD (bench_batch_transform_scalar)
+// Usage: bench_batch_transform [loops]
+#include "raylib.h"
+#include "rlgl.h"
+#include "raymath.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define VERTEX_COUNT        (1024*1024)
+#define CHUNK_VERTEX        (128*1024)  // Vertex submitted by transform matrix, fitting batch buffer
+#define DEFAULT_LOOPS        3
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED: %s (line %i)\n", #cond, __LINE__); failed++; } } while (0)
+
+static int failed = 0;
+
+// Get batch vertex position (separate or interleaved layout)
+static Vector3 GetBatchPosition(const rlVertexBuffer *buffer, int index)
+{
+    if (buffer->vertexData != NULL) return (Vector3){ buffer->vertexData[index].x, buffer->vertexData[index].y, buffer->vertexData[index].z };
+    return (Vector3){ buffer->vertices[3*index], buffer->vertices[3*index + 1], buffer->vertices[3*index + 2] };
+}
+
+// Set chunk transform matrix (pushed)
+static void PushChunkTransform(int chunk)
+{
+    rlPushMatrix();
+    rlTranslatef(10.0f + chunk, 20.0f, 0.0f);
+    rlRotatef(30.0f + 5.0f*chunk, 0.3f, 0.5f, 0.8f);
+    rlScalef(2.0f, 1.5f, 1.0f);
+}
+
+int main(int argc, char *argv[])
+{
+    int loops = (argc > 1)? atoi(argv[1]) : DEFAULT_LOOPS;
+    if (loops < 1) loops = 1;
+
+    SetConfigFlags(FLAG_WINDOW_HEADLESS);
+    InitGraph(64, 64, "rlgl batch transform benchmark");
+    if (WindowShouldClose()) return 1;     // Headless device not available
+
+    Vector3 *positions = (Vector3 *)malloc(CHUNK_VERTEX*sizeof(Vector3));
+    for (int i = 0; i < CHUNK_VERTEX; i++) positions[i] = (Vector3){ (float)(i%1000)*0.01f, (float)(i/1000%1000)*0.01f, (float)(i%7)*0.1f };
+
+    // Own batch, vertex can be checked before upload
+    rlRenderBatch batch = rlLoadRenderBatch(1, CHUNK_VERTEX/4 + 2);
+    rlSetRenderBatchActive(&batch);
+
+    double submitTime = 0.0;        // Deferred: vertex stored untransformed
+    double transformTime = 0.0;     // Deferred: transformation applied on rlPopMatrix()
+    double referenceTime = 0.0;     // Reference: vertex transformed one by one before storage
+    float maxError = 0.0f;
+
+    for (int loop = 0; loop < loops; loop++)
+    {
+        for (int chunk = 0; chunk < VERTEX_COUNT/CHUNK_VERTEX; chunk++)
+        {
+            PushChunkTransform(chunk);
+            Matrix transform = rlGetMatrixTransform();
+
+            double start = GetTime();
+            rlBegin(RL_TRIANGLES);
+            for (int i = 0; i < CHUNK_VERTEX; i++) rlVertex3f(positions[i].x, positions[i].y, positions[i].z);
+            rlEnd();
+            double submitted = GetTime();
+            rlPopMatrix();
+            double transformed = GetTime();
+
+            submitTime += submitted - start;
+            transformTime += transformed - submitted;
+
+            if (loop == 0)
+            {
+                const rlVertexBuffer *buffer = &batch.vertexBuffer[batch.currentBuffer];
+                for (int i = 0; i < CHUNK_VERTEX; i += 97)
+                {
+                    Vector3 expected = Vector3Transform(positions[i], transform);
+                    Vector3 position = GetBatchPosition(buffer, i);
+                    float error = fmaxf(fabsf(expected.x - position.x), fmaxf(fabsf(expected.y - position.y), fabsf(expected.z - position.z)));
+                    if (error > maxError) maxError = error;
+                }
+            }
+
+            rlDrawRenderBatch(&batch);
+
+            // Reference: per-vertex transformation, no transform matrix active on batch
+            start = GetTime();
+            rlBegin(RL_TRIANGLES);
+            for (int i = 0; i < CHUNK_VERTEX; i++)
+            {
+                Vector3 position = Vector3Transform(positions[i], transform);
+                rlVertex3f(position.x, position.y, position.z);
+            }
+            rlEnd();
+            referenceTime += GetTime() - start;
+
+            rlDrawRenderBatch(&batch);
+        }
+    }
+
+    double vertexCount = (double)VERTEX_COUNT*loops;
+    printf("Batch vertex transform: %s, %i vertex x %i loops (maximum error: %f)\n",
+#if defined(RLGL_NO_SIMD)
+        "scalar kernel",
+#else
+        "SIMD kernels (runtime CPU dispatch)",
+#endif
+        VERTEX_COUNT, loops, maxError);
+    printf("    deferred transform: %.3f ms/1M vertex (%.1f Mvertex/s), submit: %.3f ms/1M vertex\n",
+        transformTime*1000.0/loops, vertexCount/transformTime/1000000.0, submitTime*1000.0/loops);
+    printf("    deferred total: %.3f ms/1M vertex, per-vertex transform reference: %.3f ms/1M vertex (%.2fx)\n",
+        (submitTime + transformTime)*1000.0/loops, referenceTime*1000.0/loops, referenceTime/(submitTime + transformTime));
+    CHECK(maxError < 0.001f);
+
+    rlSetRenderBatchActive(NULL);
+    rlUnloadRenderBatch(batch);
+    free(positions);
+    CloseGraph();
+
+    return (failed == 0)? 0 : 1;
+}
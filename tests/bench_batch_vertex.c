@@ -0,0 +1,79 @@
+// Render batch vertex throughput benchmark: immediate mode quads (position, texcoord, color) submitted and drawn,
+// built twice: default separate attribute buffers and RL_DEFAULT_BATCH_INTERLEAVED (bench_batch_vertex_interleaved)
+// Usage: bench_batch_vertex [frames]
+#include "raylib.h"
+#include "rlgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SCREEN_SIZE         256
+#define QUADS_PER_FRAME     100000
+#define DEFAULT_FRAMES      20
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED: %s (line %i)\n", #cond, __LINE__); failed++; } } while (0)
+
+static int failed = 0;
+
+// Submit frame quads, 1 pixel quads spread over the screen (rasterization cost kept low)
+static void DrawQuads(int frame)
+{
+    rlBegin(RL_QUADS);
+    for (int i = 0; i < QUADS_PER_FRAME; i++)
+    {
+        float x = (float)((i*7 + frame)%SCREEN_SIZE);
+        float y = (float)((i/SCREEN_SIZE*3)%SCREEN_SIZE);
+
+        rlColor4ub((unsigned char)i, (unsigned char)(i >> 8), 200, 255);
+        rlTexCoord2f(0.0f, 0.0f); rlVertex2f(x, y);
+        rlTexCoord2f(0.0f, 1.0f); rlVertex2f(x, y + 1.0f);
+        rlTexCoord2f(1.0f, 1.0f); rlVertex2f(x + 1.0f, y + 1.0f);
+        rlTexCoord2f(1.0f, 0.0f); rlVertex2f(x + 1.0f, y);
+    }
+    rlEnd();
+}
+
+int main(int argc, char *argv[])
+{
+    int frames = (argc > 1)? atoi(argv[1]) : DEFAULT_FRAMES;
+    if (frames < 1) frames = 1;
+
+    SetConfigFlags(FLAG_WINDOW_HEADLESS);
+    InitGraph(SCREEN_SIZE, SCREEN_SIZE, "rlgl batch vertex benchmark");
+    if (WindowShouldClose()) return 1;     // Headless device not available
+
+    // Warm up: batch buffers grow to their steady size
+    BeginDrawing();
+        ClearBackground(BLACK);
+        DrawQuads(0);
+    EndDrawing();
+
+    // Submit time: vertex submission and batch upload (draw calls issued), frame time includes GPU work
+    double submitTime = 0.0;
+    double start = GetTime();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        BeginDrawing();
+            ClearBackground(BLACK);
+            double submitStart = GetTime();
+            DrawQuads(frame);
+            rlDrawRenderBatchActive();
+            submitTime += GetTime() - submitStart;
+        EndDrawing();
+    }
+    double elapsed = GetTime() - start;
+
+    unsigned char *pixels = rlReadScreenPixels(SCREEN_SIZE, SCREEN_SIZE);
+    int covered = 0;
+    for (int i = 0; i < SCREEN_SIZE*SCREEN_SIZE; i++) if (pixels[4*i + 2] == 200) covered++;
+    free(pixels);
+    CHECK(covered > 0);
+
+    double vertexCount = 4.0*QUADS_PER_FRAME*frames;
+    printf("Batch vertex layout: %s, %i frames, %i vertex/frame\n", RL_DEFAULT_BATCH_INTERLEAVED? "interleaved" : "separate", frames, 4*QUADS_PER_FRAME);
+    printf("    submit: %.3f ms/frame, %.2f Mvertex/s\n", submitTime*1000.0/frames, vertexCount/submitTime/1000000.0);
+    printf("    frame: %.3f ms/frame, %.2f Mvertex/s\n", elapsed*1000.0/frames, vertexCount/elapsed/1000000.0);
+
+    CloseGraph();
+
+    return (failed == 0)? 0 : 1;
+}
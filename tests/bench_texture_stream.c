@@ -0,0 +1,115 @@
+// Texture streaming benchmark: full RGBA frames uploaded every frame at 1080p and 4K, synchronous UpdateTexture()
+// vs texture stream (UpdateTextureStream() copy and Begin/EndTextureStreamUpdate() direct write), render thread time
+// spent on upload calls and throughput until the GPU completes the last transfer
+// Usage: bench_texture_stream [frames]
+#include "raylib.h"
+#include "rlgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DEFAULT_FRAMES      8
+#define STREAM_BUFFERS      3
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED: %s (line %i)\n", #cond, __LINE__); failed++; } } while (0)
+
+static int failed = 0;
+
+typedef enum {
+    UPLOAD_SYNC = 0,        // UpdateTexture()
+    UPLOAD_STREAM_COPY,     // UpdateTextureStream()
+    UPLOAD_STREAM_DIRECT    // BeginTextureStreamUpdate()/EndTextureStreamUpdate(), frame written on mapped buffer
+} UploadMode;
+
+static const char *modeNames[3] = { "UpdateTexture", "UpdateTextureStream", "Begin/EndTextureStreamUpdate" };
+
+// Wait until GPU completes previous commands
+static void WaitGpu(void)
+{
+    void *fence = rlLoadFence();
+    while ((fence != NULL) && !rlIsFenceSignaled(fence)) { }
+    rlUnloadFence(fence);
+}
+
+// Upload frames with selected mode, frame is drawn after every upload (texture used right away)
+static void BenchUpload(int width, int height, UploadMode mode, int frames)
+{
+    int size = width*height*4;
+    Texture2D texture = { rlLoadTexture(NULL, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1), width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    TextureStream stream = LoadTextureStream(texture, STREAM_BUFFERS);
+    unsigned char *pixels = (unsigned char *)malloc(size);
+
+    double uploadTime = 0.0;    // Render thread time on upload calls (frame data generation excluded)
+    double start = GetTime();
+
+    for (int frame = 0; frame < frames; frame++)
+    {
+        unsigned char value = (unsigned char)(16*(frame + 1));
+        double uploadStart = 0.0;
+
+        if (mode == UPLOAD_STREAM_DIRECT)
+        {
+            uploadStart = GetTime();
+            unsigned char *data = (unsigned char *)BeginTextureStreamUpdate(&stream);
+            uploadTime += GetTime() - uploadStart;
+
+            if (data != NULL) memset(data, value, size);
+
+            uploadStart = GetTime();
+            EndTextureStreamUpdate(&stream);
+        }
+        else
+        {
+            memset(pixels, value, size);
+
+            uploadStart = GetTime();
+            if (mode == UPLOAD_SYNC) UpdateTexture(texture, pixels);
+            else UpdateTextureStream(&stream, pixels);
+        }
+        uploadTime += GetTime() - uploadStart;
+
+        BeginDrawing();
+            ClearBackground(BLACK);
+            DrawTexturePro(texture, (rayRect){ 0, 0, (float)width, (float)height }, (rayRect){ 0, 0, 64, 64 }, (Vector2){ 0 }, 0.0f, WHITE);
+        EndDrawing();
+    }
+
+    if (mode == UPLOAD_SYNC) WaitGpu();
+    else while (!IsTextureStreamUpdated(stream)) { }
+
+    double elapsed = GetTime() - start;
+
+    // Last frame must be on texture
+    unsigned char *result = (unsigned char *)rlReadTexturePixels(texture.id, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    CHECK((result != NULL) && (result[0] == (unsigned char)(16*frames)) && (result[size - 1] == (unsigned char)(16*frames)));
+    free(result);
+
+    printf("    %-30s upload calls: %8.3f ms/frame, total: %8.3f ms/frame, %8.1f MB/s\n", modeNames[mode],
+        uploadTime*1000.0/frames, elapsed*1000.0/frames, (double)size*frames/elapsed/(1024.0*1024.0));
+
+    free(pixels);
+    UnloadTextureStream(stream);
+    rlUnloadTexture(texture.id);
+}
+
+int main(int argc, char *argv[])
+{
+    int frames = (argc > 1)? atoi(argv[1]) : DEFAULT_FRAMES;
+    if (frames < 1) frames = 1;
+
+    SetConfigFlags(FLAG_WINDOW_HEADLESS);
+    InitGraph(64, 64, "texture stream benchmark");
+    if (WindowShouldClose()) return 1;     // Headless device not available
+
+    const int sizes[2][2] = { { 1920, 1080 }, { 3840, 2160 } };
+
+    for (int i = 0; i < 2; i++)
+    {
+        printf("Texture streaming %ix%i RGBA, %i frames (%i buffers stream):\n", sizes[i][0], sizes[i][1], frames, STREAM_BUFFERS);
+        for (int mode = UPLOAD_SYNC; mode <= UPLOAD_STREAM_DIRECT; mode++) BenchUpload(sizes[i][0], sizes[i][1], (UploadMode)mode, frames);
+    }
+
+    CloseGraph();
+
+    return (failed == 0)? 0 : 1;
+}
@@ -0,0 +1,115 @@
+// Render batch textures test: texture switches fitting the default shader texture slots are folded into
+// the current draw (no forced flush on many switches), textures beyond the slots still draw correctly,
+// custom vertex shader with default fragment shader (no texture slot output) must link and sample texture0
+#include "raylib.h"
+#include "rlgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SCREEN_SIZE         64
+#define CELL_SIZE            2          // Grid cell size in pixels, one textured quad by cell
+#define GRID_SIZE           (SCREEN_SIZE/CELL_SIZE)
+#define TEXTURE_COUNT        9          // One more than default batch texture slots
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED: %s (line %i)\n", #cond, __LINE__); failed++; } } while (0)
+
+static int failed = 0;
+
+static const Color textureColors[TEXTURE_COUNT] = {
+    { 255, 0, 0, 255 }, { 0, 255, 0, 255 }, { 0, 0, 255, 255 }, { 255, 255, 0, 255 }, { 255, 0, 255, 255 },
+    { 0, 255, 255, 255 }, { 255, 255, 255, 255 }, { 128, 0, 0, 255 }, { 0, 128, 0, 255 }
+};
+
+static const char *vsCode =
+    "#version 330\n"
+    "in vec3 vertexPosition;\n"
+    "in vec2 vertexTexCoord;\n"
+    "in vec4 vertexColor;\n"
+    "out vec2 fragTexCoord;\n"
+    "out vec4 fragColor;\n"
+    "uniform mat4 mvp;\n"
+    "void main() { fragTexCoord = vertexTexCoord; fragColor = vertexColor; gl_Position = mvp*vec4(vertexPosition, 1.0); }\n";
+
+// Draw grid cells switching texture on every cell, check every cell color and return batch statistics
+static rlRenderBatchStats DrawTextureGrid(const Texture2D *textures, int textureCount)
+{
+    BeginDrawing();
+        ClearBackground(BLACK);
+        rlDrawRenderBatchActive();
+        rlResetRenderBatchStats();
+
+        for (int i = 0; i < GRID_SIZE*GRID_SIZE; i++)
+        {
+            rayRect source = { 0, 0, (float)textures[0].width, (float)textures[0].height };
+            rayRect dest = { (float)(i%GRID_SIZE)*CELL_SIZE, (float)(i/GRID_SIZE)*CELL_SIZE, CELL_SIZE, CELL_SIZE };
+            DrawTexturePro(textures[i%textureCount], source, dest, (Vector2){ 0 }, 0.0f, WHITE);
+        }
+
+        rlDrawRenderBatchActive();
+        rlRenderBatchStats stats = rlGetRenderBatchStats();
+    EndDrawing();
+
+    unsigned char *pixels = rlReadScreenPixels(SCREEN_SIZE, SCREEN_SIZE);
+    int wrong = 0;
+    for (int i = 0; i < GRID_SIZE*GRID_SIZE; i++)
+    {
+        const unsigned char *pixel = &pixels[4*((i/GRID_SIZE)*CELL_SIZE*SCREEN_SIZE + (i%GRID_SIZE)*CELL_SIZE)];
+        Color color = textureColors[i%textureCount];
+        if ((pixel[0] != color.r) || (pixel[1] != color.g) || (pixel[2] != color.b)) wrong++;
+    }
+    free(pixels);
+
+    printf("Grid with %i textures: %i cells wrong, %i flushes, %i draw calls\n", textureCount, wrong, stats.flushCount, stats.drawCallCount);
+    CHECK(wrong == 0);
+
+    return stats;
+}
+
+int main(void)
+{
+    SetConfigFlags(FLAG_WINDOW_HEADLESS);
+    InitGraph(SCREEN_SIZE, SCREEN_SIZE, "rlgl batch textures test");
+    if (WindowShouldClose()) return 1;     // Headless device not available
+
+    Texture2D textures[TEXTURE_COUNT] = { 0 };
+    for (int i = 0; i < TEXTURE_COUNT; i++)
+    {
+        Image image = GenImageColor(4, 4, textureColors[i]);
+        textures[i] = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+
+    // Switches between textures fitting the slots: a single draw, one flush and one draw call
+    rlRenderBatchStats stats = DrawTextureGrid(textures, 4);
+    CHECK((stats.flushCount == 1) && (stats.drawCallCount == 1));
+
+    // More textures than slots: draws are split, they still fit the batch draws (no forced flush)
+    stats = DrawTextureGrid(textures, TEXTURE_COUNT);
+    CHECK(stats.flushCount == 1);
+
+    // Custom vertex shader with default fragment shader
+    Shader shader = LoadShaderFromMemory(vsCode, NULL);
+    CHECK(shader.id != rlGetShaderIdDefault());
+
+    BeginDrawing();
+        ClearBackground(BLACK);
+        rlSetShader(shader.id, shader.locs);
+            DrawTexturePro(textures[1], (rayRect){ 0, 0, 4, 4 }, (rayRect){ 0, 0, 16, 16 }, (Vector2){ 0 }, 0.0f, WHITE);
+            DrawTexturePro(textures[2], (rayRect){ 0, 0, 4, 4 }, (rayRect){ 16, 0, 16, 16 }, (Vector2){ 0 }, 0.0f, WHITE);
+        rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
+    EndDrawing();
+
+    unsigned char *pixels = rlReadScreenPixels(SCREEN_SIZE, SCREEN_SIZE);
+    const unsigned char *green = &pixels[4*(8*SCREEN_SIZE + 8)];
+    const unsigned char *blue = &pixels[4*(8*SCREEN_SIZE + 24)];
+    printf("Custom vertex shader pixels: %i %i %i, %i %i %i\n", green[0], green[1], green[2], blue[0], blue[1], blue[2]);
+    CHECK((green[0] == 0) && (green[1] == 255) && (green[2] == 0));
+    CHECK((blue[0] == 0) && (blue[1] == 0) && (blue[2] == 255));
+    free(pixels);
+
+    UnloadShader(shader);
+    for (int i = 0; i < TEXTURE_COUNT; i++) UnloadTexture(textures[i]);
+    CloseGraph();
+
+    return (failed == 0)? 0 : 1;
+}
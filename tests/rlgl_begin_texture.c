@@ -0,0 +1,106 @@
+// Immediate mode texture test: texture set by rlSetTexture() just before rlBegin() with another draw mode is kept,
+// both when the empty draw opened by rlSetTexture() is reused and when the texture is folded into current draw,
+// vertex drawn after rlSetTexture(0) use default texture again
+#include "raylib.h"
+#include "rlgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SCREEN_SIZE         64
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED: %s (line %i)\n", #cond, __LINE__); failed++; } } while (0)
+
+static int failed = 0;
+
+static const char *vsCode =
+    "#version 330\n"
+    "in vec3 vertexPosition;\n"
+    "in vec2 vertexTexCoord;\n"
+    "in vec4 vertexColor;\n"
+    "out vec2 fragTexCoord;\n"
+    "out vec4 fragColor;\n"
+    "uniform mat4 mvp;\n"
+    "void main() { fragTexCoord = vertexTexCoord; fragColor = vertexColor; gl_Position = mvp*vec4(vertexPosition, 1.0); }\n";
+
+// Draw white textured quad, texture set just before rlBegin()
+static void DrawTexturedQuad(unsigned int textureId, float x)
+{
+    rlSetTexture(textureId);
+    rlBegin(RL_QUADS);
+        rlColor4ub(255, 255, 255, 255);
+        rlTexCoord2f(0.0f, 0.0f); rlVertex2f(x, 0.0f);
+        rlTexCoord2f(0.0f, 1.0f); rlVertex2f(x, 16.0f);
+        rlTexCoord2f(1.0f, 1.0f); rlVertex2f(x + 16.0f, 16.0f);
+        rlTexCoord2f(1.0f, 0.0f); rlVertex2f(x + 16.0f, 0.0f);
+    rlEnd();
+    rlSetTexture(0);
+}
+
+// Check pixel color (rgb)
+static void CheckPixel(const char *name, const unsigned char *pixels, int x, int y, Color color)
+{
+    const unsigned char *pixel = &pixels[4*(y*SCREEN_SIZE + x)];
+    printf("%s: pixel (%i, %i) %i %i %i\n", name, x, y, pixel[0], pixel[1], pixel[2]);
+    CHECK((pixel[0] == color.r) && (pixel[1] == color.g) && (pixel[2] == color.b));
+}
+
+// Draw and check scene with current shader
+static void DrawScene(const char *name, Shader shader, Texture2D texture)
+{
+    BeginDrawing();
+        ClearBackground(BLACK);
+        rlSetShader(shader.id, shader.locs);
+
+        // Empty lines draw: rlSetTexture() sets its texture, rlBegin(RL_QUADS) reuses it
+        rlBegin(RL_LINES);
+        rlEnd();
+        DrawTexturedQuad(texture.id, 0.0f);
+
+        // Lines draw with vertex: texture is folded into it (default shader) or opens an empty draw (custom shader)
+        rlBegin(RL_LINES);
+            rlColor4ub(0, 0, 255, 255);
+            rlVertex2f(0.0f, 40.5f);
+            rlVertex2f(64.0f, 40.5f);
+        rlEnd();
+        DrawTexturedQuad(texture.id, 16.0f);
+
+        // Texture unset: triangles drawn with default texture (vertex color)
+        rlBegin(RL_TRIANGLES);
+            rlColor4ub(0, 255, 0, 255);
+            rlVertex2f(32.0f, 0.0f); rlVertex2f(32.0f, 16.0f); rlVertex2f(48.0f, 16.0f);
+            rlVertex2f(32.0f, 0.0f); rlVertex2f(48.0f, 16.0f); rlVertex2f(48.0f, 0.0f);
+        rlEnd();
+
+        rlDrawRenderBatchActive();
+        rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
+    EndDrawing();
+
+    unsigned char *pixels = rlReadScreenPixels(SCREEN_SIZE, SCREEN_SIZE);
+    CheckPixel(name, pixels, 8, 8, (Color){ 255, 0, 0, 255 });
+    CheckPixel(name, pixels, 24, 8, (Color){ 255, 0, 0, 255 });
+    CheckPixel(name, pixels, 40, 8, (Color){ 0, 255, 0, 255 });
+    free(pixels);
+}
+
+int main(void)
+{
+    SetConfigFlags(FLAG_WINDOW_HEADLESS);
+    InitGraph(SCREEN_SIZE, SCREEN_SIZE, "rlgl begin texture test");
+    if (WindowShouldClose()) return 1;     // Headless device not available
+
+    Image image = GenImageColor(4, 4, (Color){ 255, 0, 0, 255 });
+    Texture2D texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    Shader shader = LoadShaderFromMemory(vsCode, NULL);
+    CHECK(shader.id != rlGetShaderIdDefault());
+
+    DrawScene("Default shader", (Shader){ rlGetShaderIdDefault(), rlGetShaderLocsDefault() }, texture);
+    DrawScene("Custom shader", shader, texture);
+
+    UnloadShader(shader);
+    UnloadTexture(texture);
+    CloseGraph();
+
+    return (failed == 0)? 0 : 1;
+}
@@ -0,0 +1,91 @@
+// Command buffer recording test: mixed lines and textured quads keep their draw mode and texture,
+// recorded draws, submitted draws and immediate mode draws must match
+#include "raylib.h"
+#include "rlgl.h"
+#include <stdio.h>
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED: %s (line %i)\n", #cond, __LINE__); failed++; } } while (0)
+
+static int failed = 0;
+
+// Lines, textured quad, lines, textured quad: textures set with rlSetTexture() just before rlBegin()
+static void DrawMixed(unsigned int textureId)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        rlBegin(RL_LINES);
+            rlColor4ub(255, 0, 0, 255);
+            rlVertex2f(10.0f, 10.0f + 20*i);
+            rlVertex2f(50.0f, 10.0f + 20*i);
+        rlEnd();
+
+        rlSetTexture(textureId);
+        rlBegin(RL_QUADS);
+            rlColor4ub(255, 255, 255, 255);
+            rlTexCoord2f(0.0f, 0.0f); rlVertex2f(60.0f, 10.0f + 20*i);
+            rlTexCoord2f(0.0f, 1.0f); rlVertex2f(60.0f, 20.0f + 20*i);
+            rlTexCoord2f(1.0f, 1.0f); rlVertex2f(70.0f, 20.0f + 20*i);
+            rlTexCoord2f(1.0f, 0.0f); rlVertex2f(70.0f, 10.0f + 20*i);
+        rlEnd();
+        rlSetTexture(0);
+    }
+}
+
+// Check draws (empty draws skipped): lines with default texture, quads with texture
+// NOTE: Batch draws could fold several textures, draw vertex texture is selected by vertex slot (vertexSlots)
+static void CheckDraws(const char *name, const rlDrawCall *draws, int count, const unsigned char *vertexSlots, unsigned int textureId)
+{
+    int index = 0;
+    for (int i = 0, offset = 0; i < count; offset += (draws[i].vertexCount + draws[i].vertexAlignment), i++)
+    {
+        if (draws[i].vertexCount == 0) continue;
+
+        unsigned int drawTextureId = (draws[i].textureCount > 0)? draws[i].textureIds[vertexSlots[offset]] : draws[i].textureId;
+        bool lines = ((index%2) == 0);
+        printf("%s: draw %i mode %i vertex %i texture %u\n", name, index, draws[i].mode, draws[i].vertexCount, drawTextureId);
+        CHECK(draws[i].mode == (lines? RL_LINES : RL_QUADS));
+        CHECK(draws[i].vertexCount == (lines? 2 : 4));
+        CHECK(drawTextureId == (lines? rlGetTextureIdDefault() : textureId));
+        index++;
+    }
+    CHECK(index == 4);
+}
+
+int main(void)
+{
+    SetConfigFlags(FLAG_WINDOW_HEADLESS);
+    InitGraph(128, 128, "rlgl command buffer test");
+    if (WindowShouldClose()) return 1;     // Headless device not available
+
+    Image image = GenImageColor(4, 4, BLUE);
+    Texture2D texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    rlRenderBatch batch = rlLoadRenderBatch(1, 1024);
+    rlSetRenderBatchActive(&batch);
+
+    // Recorded draws
+    rlCommandBuffer buffer = rlLoadCommandBuffer(64);
+    rlBeginCommandBuffer(&buffer);
+    DrawMixed(texture.id);
+    rlEndCommandBuffer();
+    CheckDraws("recorded", buffer.draws, buffer.drawCount, NULL, texture.id);
+
+    // Submitted draws
+    rlSubmitCommandBuffers(&buffer, 1);
+    CheckDraws("submitted", batch.draws, batch.drawCounter, batch.vertexBuffer[0].textureSlots, texture.id);
+    rlDrawRenderBatch(&batch);
+
+    // Immediate mode draws
+    DrawMixed(texture.id);
+    CheckDraws("immediate", batch.draws, batch.drawCounter, batch.vertexBuffer[0].textureSlots, texture.id);
+    rlDrawRenderBatch(&batch);
+
+    rlSetRenderBatchActive(NULL);
+    rlUnloadRenderBatch(batch);
+    rlUnloadCommandBuffer(buffer);
+    UnloadTexture(texture);
+    CloseGraph();
+
+    return (failed == 0)? 0 : 1;
+}
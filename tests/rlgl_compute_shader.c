@@ -0,0 +1,103 @@
+// Compute shader test: dispatch reading and writing shader storage buffers and an image texture,
+// results read back must match; without compute shader support every call must be a safe no-op
+#include "raylib.h"
+#include "rlgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define ELEMENT_COUNT      256
+#define IMAGE_SIZE          16          // Image texture size, one pixel per element
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED: %s (line %i)\n", #cond, __LINE__); failed++; } } while (0)
+
+static int failed = 0;
+
+static const char *computeCode =
+    "#version 430\n"
+    "layout(local_size_x = 64) in;\n"
+    "layout(std430, binding = 0) readonly buffer InputData { uint inputs[]; };\n"
+    "layout(std430, binding = 1) writeonly buffer OutputData { uint outputs[]; };\n"
+    "layout(rgba8, binding = 0) writeonly uniform image2D image;\n"
+    "void main()\n"
+    "{\n"
+    "    uint i = gl_GlobalInvocationID.x;\n"
+    "    outputs[i] = inputs[i]*2u + 1u;\n"
+    "    imageStore(image, ivec2(int(i%16u), int(i/16u)), vec4(float(i%16u)/15.0, float(i/16u)/15.0, 0.0, 1.0));\n"
+    "}\n";
+
+int main(void)
+{
+    SetConfigFlags(FLAG_WINDOW_HEADLESS);
+    InitGraph(64, 64, "rlgl compute shader test");
+    if (WindowShouldClose()) return 1;     // Headless device not available
+
+    unsigned int inputs[ELEMENT_COUNT] = { 0 };
+    unsigned int outputs[ELEMENT_COUNT] = { 0 };
+    for (int i = 0; i < ELEMENT_COUNT; i++) inputs[i] = i*3;
+
+    unsigned int program = rlLoadComputeShaderProgram(rlCompileShader(computeCode, RL_COMPUTE_SHADER));
+    unsigned int inputBuffer = rlLoadShaderBuffer(sizeof(inputs), inputs, 0);
+    unsigned int outputBuffer = rlLoadShaderBuffer(sizeof(outputs), NULL, 0);
+    unsigned int texture = rlLoadTexture(NULL, IMAGE_SIZE, IMAGE_SIZE, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+
+    if ((program == 0) || (inputBuffer == 0))
+    {
+        // Not supported: calls are ignored with a warning, outputs are not touched
+        printf("Compute shaders not supported, checking calls are ignored\n");
+        rlBindShaderBuffer(inputBuffer, 0);
+        rlUpdateShaderBuffer(inputBuffer, inputs, sizeof(inputs), 0);
+        rlBindImageTexture(texture, 0, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, false);
+        rlComputeShaderDispatch(ELEMENT_COUNT/64, 1, 1);
+        rlMemoryBarrier(RL_BARRIER_ALL);
+        rlReadShaderBuffer(outputBuffer, outputs, sizeof(outputs), 0);
+        CHECK(outputs[1] == 0);
+        CHECK(rlGetShaderBufferSize(outputBuffer) == 0);
+    }
+    else
+    {
+        CHECK(rlGetShaderBufferSize(outputBuffer) == sizeof(outputs));
+
+        rlEnableShader(program);
+        rlBindShaderBuffer(inputBuffer, 0);
+        rlBindShaderBuffer(outputBuffer, 1);
+        rlBindImageTexture(texture, 0, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, false);
+        rlComputeShaderDispatch(ELEMENT_COUNT/64, 1, 1);
+        rlMemoryBarrier(RL_BARRIER_SHADER_STORAGE | RL_BARRIER_TEXTURE_UPDATE);
+        rlDisableShader();
+
+        rlReadShaderBuffer(outputBuffer, outputs, sizeof(outputs), 0);
+        int wrong = 0;
+        for (int i = 0; i < ELEMENT_COUNT; i++) if (outputs[i] != inputs[i]*2 + 1) wrong++;
+        printf("Shader buffer elements wrong: %i of %i\n", wrong, ELEMENT_COUNT);
+        CHECK(wrong == 0);
+
+        // Partial update of input buffer, dispatch again
+        unsigned int value = 1000;
+        rlUpdateShaderBuffer(inputBuffer, &value, sizeof(value), 5*sizeof(unsigned int));
+        rlEnableShader(program);
+        rlComputeShaderDispatch(ELEMENT_COUNT/64, 1, 1);
+        rlMemoryBarrier(RL_BARRIER_SHADER_STORAGE);
+        rlDisableShader();
+        rlReadShaderBuffer(outputBuffer, outputs, sizeof(outputs), 0);
+        CHECK((outputs[5] == 2001) && (outputs[6] == 6*3*2 + 1));
+
+        unsigned char *pixels = (unsigned char *)rlReadTexturePixels(texture, IMAGE_SIZE, IMAGE_SIZE, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        CHECK(pixels != NULL);
+        if (pixels != NULL)
+        {
+            // Pixel (15, 3): red 255, green 3/15*255
+            unsigned char *pixel = pixels + 4*(3*IMAGE_SIZE + 15);
+            printf("Image pixel (15, 3): %i %i %i %i\n", pixel[0], pixel[1], pixel[2], pixel[3]);
+            CHECK((pixel[0] == 255) && (abs(pixel[1] - 51) <= 1) && (pixel[2] == 0) && (pixel[3] == 255));
+            free(pixels);
+        }
+    }
+
+    rlUnloadShaderProgram(program);
+    rlUnloadShaderBuffer(inputBuffer);
+    rlUnloadShaderBuffer(outputBuffer);
+    rlUnloadTexture(texture);
+    CloseGraph();
+
+    return (failed == 0)? 0 : 1;
+}
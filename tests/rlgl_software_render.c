@@ -0,0 +1,113 @@
+// Software rasterizer test: rectangles, lines and textured quads rendered by software rasterizer
+// must match OpenGL rendering, only a few edge pixels are allowed to differ (different coverage rules),
+// worker threads are kept between flushes and every frame must match single thread rendering
+#include "raylib.h"
+#include "rlgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SCREEN_WIDTH        320
+#define SCREEN_HEIGHT       240
+#define PIXEL_TOLERANCE      16         // Maximum channel difference for matching pixels
+#define MAX_EDGE_PIXELS     (SCREEN_WIDTH*SCREEN_HEIGHT/500)    // Pixels allowed to differ (0.2%)
+#define THREADS_FRAMES       8          // Frames rendered with the same worker threads
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED: %s (line %i)\n", #cond, __LINE__); failed++; } } while (0)
+
+static int failed = 0;
+
+static void DrawScene(Texture2D texture)
+{
+    BeginDrawing();
+        ClearBackground((Color){ 30, 40, 50, 255 });
+
+        Camera3D camera = { { 4.0f, 3.0f, 5.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, 45.0f };
+        BeginMode3D(camera);
+            DrawCube((Vector3){ 0.0f, 0.0f, 0.0f }, 1.5f, 1.5f, 1.5f, RED);
+            DrawCube((Vector3){ 0.8f, 0.3f, 0.5f }, 1.0f, 1.0f, 1.0f, (Color){ 0, 200, 100, 255 });
+        EndMode3D();
+
+        DrawRectangle(10, 10, 80, 50, (Color){ 255, 255, 0, 128 });
+        DrawRectangle(40, 30, 60, 60, BLUE);
+        DrawLine(5, 230, 310, 150, GREEN);
+        DrawRectangleLines(220, 160, 80, 60, ORANGE);
+        DrawTexture(texture, 200, 20, WHITE);
+        DrawTextureEx(texture, (Vector2){ 150, 120 }, 30.0f, 1.5f, (Color){ 255, 255, 255, 200 });
+    EndDrawing();
+}
+
+// Count pixels differing more than tolerance on any channel
+static int CountDifferentPixels(const unsigned char *a, const unsigned char *b)
+{
+    int count = 0;
+
+    for (int i = 0; i < SCREEN_WIDTH*SCREEN_HEIGHT; i++)
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            if (abs(a[4*i + c] - b[4*i + c]) > PIXEL_TOLERANCE) { count++; break; }
+        }
+    }
+
+    return count;
+}
+
+int main(void)
+{
+    SetConfigFlags(FLAG_WINDOW_HEADLESS);
+    InitGraph(SCREEN_WIDTH, SCREEN_HEIGHT, "rlgl software render test");
+    if (WindowShouldClose()) return 1;     // Headless device not available
+
+    // Checked texture, nearest filtering
+    Image image = GenImageColor(32, 32, WHITE);
+    for (int y = 0; y < 32; y++)
+    {
+        for (int x = 0; x < 32; x++) ImageDrawPixel(&image, x, y, (((x/4 + y/4)%2) == 0)? RED : DARKBLUE);
+    }
+    Texture2D texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    DrawScene(texture);
+    unsigned char *glPixels = rlReadScreenPixels(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    CHECK(rlEnableSoftwareRender(SCREEN_WIDTH, SCREEN_HEIGHT, 1));
+    DrawScene(texture);
+    unsigned char *softwarePixels = rlReadScreenPixels(SCREEN_WIDTH, SCREEN_HEIGHT);
+    rlDisableSoftwareRender();
+
+    // Rasterizer threads work on screen tiles, result must be exactly the same on every frame
+    CHECK(rlEnableSoftwareRender(SCREEN_WIDTH, SCREEN_HEIGHT, 4));
+    unsigned char *threadsPixels = NULL;
+    int framesDifferent = 0;
+    for (int frame = 0; frame < THREADS_FRAMES; frame++)
+    {
+        DrawScene(texture);
+        free(threadsPixels);
+        threadsPixels = rlReadScreenPixels(SCREEN_WIDTH, SCREEN_HEIGHT);
+        for (int i = 0; i < SCREEN_WIDTH*SCREEN_HEIGHT*4; i++) if (softwarePixels[i] != threadsPixels[i]) { framesDifferent++; break; }
+    }
+    rlDisableSoftwareRender();
+
+    int different = CountDifferentPixels(glPixels, softwarePixels);
+    printf("OpenGL vs software: %i pixels differ (maximum %i)\n", different, MAX_EDGE_PIXELS);
+    CHECK(different <= MAX_EDGE_PIXELS);
+
+    different = 0;
+    for (int i = 0; i < SCREEN_WIDTH*SCREEN_HEIGHT*4; i++) if (softwarePixels[i] != threadsPixels[i]) different++;
+    printf("Software 1 thread vs 4 threads: %i bytes differ, %i of %i frames differ\n", different, framesDifferent, THREADS_FRAMES);
+    CHECK((different == 0) && (framesDifferent == 0));
+
+    // Scene must not be empty, shapes cover at least 5% of the screen
+    int covered = 0;
+    for (int i = 0; i < SCREEN_WIDTH*SCREEN_HEIGHT; i++) if ((glPixels[4*i] != 30) || (glPixels[4*i + 1] != 40) || (glPixels[4*i + 2] != 50)) covered++;
+    printf("Pixels covered by shapes: %i\n", covered);
+    CHECK(covered > SCREEN_WIDTH*SCREEN_HEIGHT/20);
+
+    free(glPixels);
+    free(softwarePixels);
+    free(threadsPixels);
+    UnloadTexture(texture);
+    CloseGraph();
+
+    return (failed == 0)? 0 : 1;
+}
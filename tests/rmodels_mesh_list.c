@@ -0,0 +1,174 @@
+// Mesh list drawing test: meshes packed into the mesh arena must draw updated data (UpdateMeshBuffer()),
+// keep drawing right after arena compaction (meshes unloaded) and after graphics re-initialization,
+// instanced drawing internal buffer must also be valid after re-initialization,
+// mesh lists and internal instance buffer are not available on other rlgl contexts (nothing drawn)
+#include "raylib.h"
+#include "rlgl.h"
+#include "raymath.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SCREEN_SIZE         64
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED: %s (line %i)\n", #cond, __LINE__); failed++; } } while (0)
+
+static int failed = 0;
+
+static const char *vsCode =
+    "#version 330\n"
+    "in vec3 vertexPosition;\n"
+    "in mat4 instanceTransform;\n"
+    "uniform mat4 mvp;\n"
+    "void main() { gl_Position = mvp*instanceTransform*vec4(vertexPosition, 1.0); }\n";
+
+static const char *fsCode =
+    "#version 330\n"
+    "uniform vec4 colDiffuse;\n"
+    "out vec4 finalColor;\n"
+    "void main() { finalColor = colDiffuse; }\n";
+
+// Set quad vertex positions (screen coordinates)
+static void SetQuadVertices(float *vertices, float x, float y, float size)
+{
+    float positions[12] = { x, y, 0.0f, x, y + size, 0.0f, x + size, y + size, 0.0f, x + size, y, 0.0f };
+    for (int i = 0; i < 12; i++) vertices[i] = positions[i];
+}
+
+// Load indexed quad mesh (indices kept in RAM, required for mesh list drawing)
+static Mesh LoadQuadMesh(float x, float y, float size)
+{
+    Mesh mesh = { 0 };
+    mesh.vertexCount = 4;
+    mesh.triangleCount = 2;
+    mesh.vertices = (float *)malloc(12*sizeof(float));
+    mesh.indices = (unsigned short *)malloc(6*sizeof(unsigned short));
+
+    SetQuadVertices(mesh.vertices, x, y, size);
+    unsigned short indices[6] = { 0, 1, 2, 0, 2, 3 };
+    for (int i = 0; i < 6; i++) mesh.indices[i] = indices[i];
+
+    UploadMesh(&mesh, true);
+
+    return mesh;
+}
+
+static Material LoadListMaterial(void)
+{
+    Material material = LoadMaterialDefault();
+    material.shader = LoadShaderFromMemory(vsCode, fsCode);
+    material.shader.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(material.shader, "instanceTransform");
+    material.maps[MATERIAL_MAP_DIFFUSE].color = RED;
+
+    return material;
+}
+
+// Draw meshes as a list and check screen pixels: covered (expected red) or background
+static unsigned char *DrawList(Mesh *meshes, Material material, int count)
+{
+    Matrix transforms[8] = { 0 };
+    for (int i = 0; i < count; i++) transforms[i] = MatrixIdentity();
+
+    BeginDrawing();
+        ClearBackground(BLACK);
+        rlDisableBackfaceCulling();
+        DrawMeshList(meshes, material, transforms, count);
+        rlEnableBackfaceCulling();
+    EndDrawing();
+
+    return rlReadScreenPixels(SCREEN_SIZE, SCREEN_SIZE);
+}
+
+// Draw mesh instances translated horizontally (16 pixels step)
+static unsigned char *DrawInstances(Mesh mesh, Material material, int count)
+{
+    Matrix transforms[8] = { 0 };
+    for (int i = 0; i < count; i++) transforms[i] = MatrixTranslate((float)i*16, 0.0f, 0.0f);
+
+    BeginDrawing();
+        ClearBackground(BLACK);
+        rlDisableBackfaceCulling();
+        DrawMeshInstanced(mesh, material, transforms, count);
+        rlEnableBackfaceCulling();
+    EndDrawing();
+
+    return rlReadScreenPixels(SCREEN_SIZE, SCREEN_SIZE);
+}
+
+static bool IsPixelRed(const unsigned char *pixels, int x, int y) { return (pixels[4*(y*SCREEN_SIZE + x)] > 200) && (pixels[4*(y*SCREEN_SIZE + x) + 1] < 50); }
+
+int main(void)
+{
+    SetConfigFlags(FLAG_WINDOW_HEADLESS);
+    InitGraph(SCREEN_SIZE, SCREEN_SIZE, "rmodels mesh list test");
+    if (WindowShouldClose()) return 1;     // Headless device not available
+
+    Material material = LoadListMaterial();
+    Mesh meshes[2] = { LoadQuadMesh(0, 0, 16), LoadQuadMesh(16, 0, 16) };
+
+    unsigned char *pixels = DrawList(meshes, material, 2);
+    CHECK(IsPixelRed(pixels, 8, 8) && IsPixelRed(pixels, 24, 8) && !IsPixelRed(pixels, 40, 40));
+    free(pixels);
+
+    pixels = DrawInstances(meshes[0], material, 4);
+    CHECK(IsPixelRed(pixels, 8, 8) && IsPixelRed(pixels, 56, 8) && !IsPixelRed(pixels, 8, 40));
+    free(pixels);
+
+    rlContext *context = rlCreateContext(SCREEN_SIZE, SCREEN_SIZE);
+    pixels = DrawList(meshes, material, 2);
+    CHECK(!IsPixelRed(pixels, 8, 8) && !IsPixelRed(pixels, 24, 8));
+    free(pixels);
+    pixels = DrawInstances(meshes[0], material, 4);
+    CHECK(!IsPixelRed(pixels, 8, 8));
+    free(pixels);
+    rlDestroyContext(context);
+
+    // Mesh updated every frame, packed data must follow it (updated in place)
+    for (int frame = 0; frame < 100; frame++)
+    {
+        SetQuadVertices(meshes[0].vertices, (float)(frame%2)*32, 32, 16);
+        UpdateMeshBuffer(meshes[0], 0, meshes[0].vertices, 12*sizeof(float), 0);
+
+        pixels = DrawList(meshes, material, 2);
+        bool moved = IsPixelRed(pixels, (frame%2)*32 + 8, 40) && !IsPixelRed(pixels, 8, 8) && IsPixelRed(pixels, 24, 8);
+        free(pixels);
+        if (!moved) { printf("Frame %i: updated mesh not drawn at its position\n", frame); failed++; break; }
+    }
+
+    // Meshes unloaded and loaded again, removed data is discarded once it is over half of the arena
+    for (int i = 0; i < 16; i++)
+    {
+        UnloadMesh(meshes[1]);
+        meshes[1] = LoadQuadMesh((float)(i%4)*16, 0, 16);
+
+        pixels = DrawList(meshes, material, 2);
+        bool drawn = IsPixelRed(pixels, (i%4)*16 + 8, 8) && IsPixelRed(pixels, 40, 40);
+        free(pixels);
+        if (!drawn) { printf("Iteration %i: mesh not drawn after reload\n", i); failed++; break; }
+    }
+
+    // Graphics re-initialization, arena must not keep objects of the previous OpenGL context
+    UnloadMesh(meshes[0]);
+    UnloadMesh(meshes[1]);
+    UnloadShader(material.shader);
+    CloseGraph();
+
+    InitGraph(SCREEN_SIZE, SCREEN_SIZE, "rmodels mesh list test");
+    if (WindowShouldClose()) return 1;
+
+    material = LoadListMaterial();
+    meshes[0] = LoadQuadMesh(48, 48, 16);
+
+    pixels = DrawList(meshes, material, 1);
+    CHECK(IsPixelRed(pixels, 56, 56) && !IsPixelRed(pixels, 8, 8));
+    free(pixels);
+
+    pixels = DrawInstances(meshes[0], material, 2);
+    CHECK(IsPixelRed(pixels, 56, 56) && !IsPixelRed(pixels, 8, 8));
+    free(pixels);
+
+    UnloadMesh(meshes[0]);
+    UnloadShader(material.shader);
+    CloseGraph();
+
+    return (failed == 0)? 0 : 1;
+}
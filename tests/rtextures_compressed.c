@@ -0,0 +1,314 @@
+// Compressed texture containers test: DDS, KTX and KTX 2.0 files built in memory must load
+// with mipmaps at the right offsets, truncated files keep complete levels only, invalid headers are rejected
+#include "raylib.h"
+#include <stdio.h>
+#include <string.h>
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED: %s (line %i)\n", #cond, __LINE__); failed++; } } while (0)
+
+static int failed = 0;
+
+static unsigned char fileData[1024*1024] = { 0 };    // Enough for oversized dimensions tests data
+static int fileSize = 0;
+
+static const int dxt1Blocks[4] = { 16, 4, 1, 1 };      // DXT1 16x16 mipmaps: 16x16, 8x8, 4x4, 2x2
+static unsigned short mipColors[4] = { 0 };            // RGB565 solid color per mipmap level
+
+static const unsigned char ktxIdentifier[12] = { 0xab, 'K', 'T', 'X', ' ', '1', '1', 0xbb, '\r', '\n', 0x1a, '\n' };
+static const unsigned char ktx2Identifier[12] = { 0xab, 'K', 'T', 'X', ' ', '2', '0', 0xbb, '\r', '\n', 0x1a, '\n' };
+
+static void WriteBytes(const void *data, int size) { memcpy(fileData + fileSize, data, size); fileSize += size; }
+static void WriteUInt(unsigned int value) { WriteBytes(&value, 4); }
+static void WriteULong(unsigned long long value) { WriteBytes(&value, 8); }
+
+static unsigned short GetColor565(Color color) { return (unsigned short)(((color.r >> 3) << 11) | ((color.g >> 2) << 5) | (color.b >> 3)); }
+
+// Write solid color DXT1 blocks (8 bytes) and DXT5 blocks (16 bytes)
+static void WriteDXT1(int blocks, unsigned short color)
+{
+    for (int i = 0; i < blocks; i++) { unsigned short colors[2] = { color, color }; WriteBytes(colors, 4); WriteUInt(0); }
+}
+
+static void WriteDXT5(int blocks, unsigned short color)
+{
+    for (int i = 0; i < blocks; i++)
+    {
+        unsigned char alpha[8] = { 255, 255, 0, 0, 0, 0, 0, 0 };
+        WriteBytes(alpha, 8);
+        WriteDXT1(1, color);
+    }
+}
+
+// Write DDS header (128 bytes), fourCC is used when pfFlags includes DDPF_FOURCC (0x4)
+static void WriteDDSHeader(unsigned int width, unsigned int height, int mipmaps, unsigned int pfFlags, unsigned int fourCC,
+                           int bitCount, unsigned int rMask, unsigned int gMask, unsigned int bMask, unsigned int aMask)
+{
+    fileSize = 0;
+    WriteBytes("DDS ", 4);
+    WriteUInt(124);
+    WriteUInt(0x1007 | ((mipmaps > 1)? 0x20000 : 0));
+    WriteUInt(height);
+    WriteUInt(width);
+    WriteUInt(0);
+    WriteUInt(0);
+    WriteUInt(mipmaps);
+    for (int i = 0; i < 11; i++) WriteUInt(0);
+    WriteUInt(32);
+    WriteUInt(pfFlags);
+    WriteUInt(fourCC);
+    WriteUInt(bitCount);
+    WriteUInt(rMask);
+    WriteUInt(gMask);
+    WriteUInt(bMask);
+    WriteUInt(aMask);
+    WriteUInt(0x1000);
+    for (int i = 0; i < 4; i++) WriteUInt(0);
+}
+
+// Write KTX 1.1 header (64 bytes) followed by key/value data
+static void WriteKTXHeader(unsigned int glType, unsigned int glFormat, unsigned int glInternalFormat, unsigned int width, unsigned int height,
+                           unsigned int faces, unsigned int mipmaps, unsigned int keyValueDataSize)
+{
+    fileSize = 0;
+    WriteBytes(ktxIdentifier, 12);
+    WriteUInt(0x04030201);
+    WriteUInt(glType);
+    WriteUInt(1);
+    WriteUInt(glFormat);
+    WriteUInt(glInternalFormat);
+    WriteUInt(0x1907);
+    WriteUInt(width);
+    WriteUInt(height);
+    WriteUInt(0);
+    WriteUInt(0);
+    WriteUInt(faces);
+    WriteUInt(mipmaps);
+    WriteUInt(keyValueDataSize);
+    for (unsigned int i = 0; i < keyValueDataSize; i++) fileData[fileSize++] = 0x5a;
+}
+
+static unsigned short GetBlockColor(Image image, int block) { return ((unsigned short *)image.data)[block*4]; }
+
+static void TestDDS(void)
+{
+    // DXT1 16x16 with 4 mipmaps, level 2 starts after 16 + 4 blocks
+    WriteDDSHeader(16, 16, 4, 0x4, 0x31545844, 0, 0, 0, 0, 0);
+    int headerSize = fileSize;
+    for (int i = 0; i < 4; i++) WriteDXT1(dxt1Blocks[i], mipColors[i]);
+
+    Image image = LoadImageFromMemory(".dds", fileData, fileSize);
+    CHECK((image.data != NULL) && (image.format == PIXELFORMAT_COMPRESSED_DXT1_RGB) && (image.width == 16) && (image.mipmaps == 4));
+    CHECK((image.data != NULL) && (memcmp(image.data, fileData + headerSize, (16 + 4 + 1 + 1)*8) == 0));
+    CHECK((image.data != NULL) && (GetBlockColor(image, 16 + 4) == mipColors[2]));
+    UnloadImage(image);
+
+    // Truncated file: last mipmap level missing
+    WriteDDSHeader(16, 16, 4, 0x4, 0x31545844, 0, 0, 0, 0, 0);
+    for (int i = 0; i < 3; i++) WriteDXT1(dxt1Blocks[i], mipColors[i]);
+    image = LoadImageFromMemory(".dds", fileData, fileSize);
+    CHECK(image.mipmaps == 3);
+    UnloadImage(image);
+
+    image = LoadImageFromMemory(".dds", fileData, 20);
+    CHECK(image.data == NULL);
+
+    // DXT5 6x6 with 3 mipmaps: incomplete border blocks are stored complete (4 + 1 + 1 blocks)
+    WriteDDSHeader(6, 6, 3, 0x4, 0x35545844, 0, 0, 0, 0, 0);
+    WriteDXT5(4, mipColors[0]);
+    WriteDXT5(1, mipColors[1]);
+    WriteDXT5(1, mipColors[2]);
+    image = LoadImageFromMemory(".dds", fileData, fileSize);
+    CHECK((image.format == PIXELFORMAT_COMPRESSED_DXT5_RGBA) && (image.mipmaps == 3));
+    UnloadImage(image);
+
+    // BGRX uncompressed, converted to RGBA with opaque alpha
+    WriteDDSHeader(2, 1, 1, 0x40, 0, 32, 0xff0000, 0xff00, 0xff, 0);
+    unsigned char pixels[8] = { 10, 20, 30, 0, 40, 50, 60, 0 };
+    WriteBytes(pixels, 8);
+    image = LoadImageFromMemory(".dds", fileData, fileSize);
+    unsigned char *data = (unsigned char *)image.data;
+    CHECK((image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (data != NULL) && (data[0] == 30) && (data[1] == 20) && (data[2] == 10) && (data[3] == 255) && (data[4] == 60));
+    UnloadImage(image);
+
+    // A1R5G5B5 converted to R5G5B5A1
+    WriteDDSHeader(1, 1, 1, 0x41, 0, 16, 0x7c00, 0x3e0, 0x1f, 0x8000);
+    unsigned short pixel = 0x8000 | (31 << 10);
+    WriteBytes(&pixel, 2);
+    image = LoadImageFromMemory(".dds", fileData, fileSize);
+    CHECK((image.data != NULL) && (((unsigned short *)image.data)[0] == ((31 << 11) | 1)));
+    UnloadImage(image);
+
+    // DX10 extended header with BC3 format
+    WriteDDSHeader(4, 4, 1, 0x4, 0x30315844, 0, 0, 0, 0, 0);
+    WriteUInt(77);
+    WriteUInt(3);
+    WriteUInt(0);
+    WriteUInt(1);
+    WriteUInt(0);
+    WriteDXT5(1, mipColors[3]);
+    image = LoadImageFromMemory(".dds", fileData, fileSize);
+    CHECK((image.format == PIXELFORMAT_COMPRESSED_DXT5_RGBA) && (image.mipmaps == 1));
+    UnloadImage(image);
+
+    // Oversized dimensions must be rejected, 262144x32772 DXT1 data size wraps to 524288 on 32-bit math
+    WriteDDSHeader(262144, 32772, 1, 0x4, 0x31545844, 0, 0, 0, 0, 0);
+    WriteDXT1(524288/8, mipColors[0]);
+    image = LoadImageFromMemory(".dds", fileData, fileSize);
+    CHECK(image.data == NULL);
+}
+
+static void TestKTX(void)
+{
+    // DXT1 16x16 with 4 mipmaps and key/value data, every level prefixed by its image size
+    WriteKTXHeader(0, 0, 0x83f0, 16, 16, 1, 4, 8);
+    for (int i = 0; i < 4; i++) { WriteUInt(dxt1Blocks[i]*8); WriteDXT1(dxt1Blocks[i], mipColors[i]); }
+    Image image = LoadImageFromMemory(".ktx", fileData, fileSize);
+    CHECK((image.data != NULL) && (image.format == PIXELFORMAT_COMPRESSED_DXT1_RGB) && (image.mipmaps == 4));
+    CHECK((image.data != NULL) && (GetBlockColor(image, 16 + 4) == mipColors[2]) && (GetBlockColor(image, 16 + 4 + 1) == mipColors[3]));
+    UnloadImage(image);
+
+    // RGB8 3x2, rows padded to 4 bytes (9 -> 12 bytes)
+    WriteKTXHeader(0x1401, 0x1907, 0x8051, 3, 2, 1, 1, 0);
+    WriteUInt(24);
+    for (int y = 0; y < 2; y++)
+    {
+        for (int x = 0; x < 9; x++) fileData[fileSize++] = (unsigned char)(y*100 + x);
+        for (int x = 0; x < 3; x++) fileData[fileSize++] = 0xee;
+    }
+    image = LoadImageFromMemory(".ktx", fileData, fileSize);
+    unsigned char *data = (unsigned char *)image.data;
+    CHECK((image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (data != NULL) && (data[8] == 8) && (data[9] == 100) && (data[17] == 108));
+    UnloadImage(image);
+
+    // Cubemap: first face is kept, next level starts after the 6 faces
+    WriteKTXHeader(0, 0, 0x83f0, 8, 8, 6, 2, 0);
+    WriteUInt(4*8);
+    for (int face = 0; face < 6; face++) WriteDXT1(4, (face == 0)? mipColors[0] : mipColors[3]);
+    WriteUInt(8);
+    for (int face = 0; face < 6; face++) WriteDXT1(1, (face == 0)? mipColors[1] : mipColors[3]);
+    image = LoadImageFromMemory(".ktx", fileData, fileSize);
+    CHECK((image.data != NULL) && (image.mipmaps == 2) && (GetBlockColor(image, 0) == mipColors[0]) && (GetBlockColor(image, 4) == mipColors[1]));
+    UnloadImage(image);
+
+    // Invalid faces count
+    WriteKTXHeader(0, 0, 0x83f0, 4, 4, 3, 1, 0);
+    WriteUInt(8);
+    WriteDXT1(1, mipColors[0]);
+    image = LoadImageFromMemory(".ktx", fileData, fileSize);
+    CHECK(image.data == NULL);
+
+    // Oversized dimensions
+    WriteKTXHeader(0, 0, 0x83f0, 262144, 32772, 1, 1, 0);
+    WriteUInt(524288);
+    WriteDXT1(524288/8, mipColors[0]);
+    image = LoadImageFromMemory(".ktx", fileData, fileSize);
+    CHECK(image.data == NULL);
+}
+
+static void TestKTX2(void)
+{
+    // BC1 16x16 with 4 mipmaps, levels stored smallest first (as libktx does) and located by level index
+    fileSize = 0;
+    WriteBytes(ktx2Identifier, 12);
+    WriteUInt(131);
+    WriteUInt(1);
+    WriteUInt(16);
+    WriteUInt(16);
+    WriteUInt(0);
+    WriteUInt(0);
+    WriteUInt(1);
+    WriteUInt(4);
+    for (int i = 0; i < 5; i++) WriteUInt(0);
+    WriteULong(0);
+    WriteULong(0);
+
+    int indexOffset = fileSize;
+    int levelOffsets[4] = { 0 };
+    fileSize += 4*24;
+    for (int i = 3; i >= 0; i--)
+    {
+        while ((fileSize%8) != 0) fileData[fileSize++] = 0;
+        levelOffsets[i] = fileSize;
+        WriteDXT1(dxt1Blocks[i], mipColors[i]);
+    }
+
+    int endOffset = fileSize;
+    for (int i = 0; i < 4; i++)
+    {
+        fileSize = indexOffset + i*24;
+        WriteULong(levelOffsets[i]);
+        WriteULong(dxt1Blocks[i]*8);
+        WriteULong(dxt1Blocks[i]*8);
+    }
+    fileSize = endOffset;
+
+    Image image = LoadImageFromMemory(".ktx2", fileData, fileSize);
+    CHECK((image.data != NULL) && (image.format == PIXELFORMAT_COMPRESSED_DXT1_RGB) && (image.mipmaps == 4));
+    CHECK((image.data != NULL) && (GetBlockColor(image, 0) == mipColors[0]) && (GetBlockColor(image, 16) == mipColors[1]) && (GetBlockColor(image, 16 + 4 + 1) == mipColors[3]));
+    UnloadImage(image);
+
+    // Level offset out of file data, previous levels kept
+    fileSize = indexOffset + 3*24;
+    WriteULong(1u << 30);
+    fileSize = endOffset;
+    image = LoadImageFromMemory(".ktx2", fileData, fileSize);
+    CHECK(image.mipmaps == 3);
+    UnloadImage(image);
+
+    // Supercompression scheme not supported
+    fileSize = 12 + 8*4;
+    WriteUInt(1);
+    fileSize = endOffset;
+    image = LoadImageFromMemory(".ktx2", fileData, fileSize);
+    CHECK(image.data == NULL);
+}
+
+int main(void)
+{
+    SetConfigFlags(FLAG_WINDOW_HEADLESS);
+    InitGraph(64, 64, "rtextures compressed containers test");
+    if (WindowShouldClose()) return 1;     // Headless device not available
+
+    mipColors[0] = GetColor565((Color){ 255, 0, 0, 255 });
+    mipColors[1] = GetColor565((Color){ 0, 255, 0, 255 });
+    mipColors[2] = GetColor565((Color){ 0, 0, 255, 255 });
+    mipColors[3] = GetColor565((Color){ 255, 255, 0, 255 });
+
+    // Block-aligned data sizes, sizes not fitting on an int are reported as 0
+    CHECK(GetPixelDataSize(6, 6, PIXELFORMAT_COMPRESSED_DXT1_RGB) == 32);
+    CHECK(GetPixelDataSize(1, 1, PIXELFORMAT_COMPRESSED_DXT5_RGBA) == 16);
+    CHECK(GetPixelDataSize(10, 3, PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA) == 32);
+    CHECK(GetPixelDataSize(4, 4, PIXELFORMAT_COMPRESSED_PVRT_RGB) == 32);
+    CHECK(GetPixelDataSize(262144, 32772, PIXELFORMAT_COMPRESSED_DXT1_RGB) == 0);
+
+    TestDDS();
+    TestKTX();
+    TestKTX2();
+
+    // Mipmapped DXT1 texture upload, minified draw samples level 2
+    WriteDDSHeader(16, 16, 4, 0x4, 0x31545844, 0, 0, 0, 0, 0);
+    for (int i = 0; i < 4; i++) WriteDXT1(dxt1Blocks[i], mipColors[i]);
+    Image image = LoadImageFromMemory(".dds", fileData, fileSize);
+    Texture2D texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+    CHECK(texture.id != 0);
+
+    BeginDrawing();
+        ClearBackground(BLACK);
+        DrawTexture(texture, 0, 0, WHITE);
+        DrawTexturePro(texture, (rayRect){ 0, 0, 16, 16 }, (rayRect){ 32, 32, 4, 4 }, (Vector2){ 0, 0 }, 0.0f, WHITE);
+    EndDrawing();
+
+    Image screen = LoadImageFromScreen();
+    Color level0 = GetImageColor(screen, 8, 8);
+    Color level2 = GetImageColor(screen, 33, 33);
+    printf("Level 0 color: %i %i %i, minified color: %i %i %i\n", level0.r, level0.g, level0.b, level2.r, level2.g, level2.b);
+    CHECK((level0.r > 240) && (level0.g < 10));
+    CHECK(level2.b > 200);
+    UnloadImage(screen);
+
+    UnloadTexture(texture);
+    CloseGraph();
+
+    return (failed == 0)? 0 : 1;
+}